@@ -0,0 +1,153 @@
+//
+//  AssetDataCache.cpp
+//  assignment-client/src/assets
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetDataCache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QMutexLocker>
+
+AssetDataCache::MappedAsset::MappedAsset(const QString& filePath) :
+    _file(filePath)
+{
+    if (!_file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    _size = _file.size();
+    if (_size > 0) {
+        _data = _file.map(0, _size);
+        _isValid = _data != nullptr;
+    } else {
+        // an empty file can't be mapped, but there's nothing to read either
+        _isValid = true;
+    }
+}
+
+void AssetDataCache::setMaxSize(qint64 maxSize) {
+    QMutexLocker locker(&_mutex);
+    _maxSize = maxSize;
+    evict(_maxSize, _maxEntries);
+}
+
+void AssetDataCache::setMaxEntries(int maxEntries) {
+    QMutexLocker locker(&_mutex);
+    _maxEntries = maxEntries;
+    evict(_maxSize, _maxEntries);
+}
+
+AssetDataCache::MappedAssetPointer AssetDataCache::get(const AssetUtils::AssetHash& hash, const QString& filePath) {
+    {
+        QMutexLocker locker(&_mutex);
+        auto itr = _entries.find(hash);
+        if (itr != _entries.end()) {
+            _lru.splice(_lru.begin(), _lru, itr->lruPosition);
+            ++_totalStats.hits;
+            ++_assetStats[hash].hits;
+            return itr->asset;
+        }
+        ++_totalStats.misses;
+        ++_assetStats[hash].misses;
+    }
+
+    // map the file without holding the lock, so other requests aren't held up by the disk
+    auto asset = std::make_shared<const MappedAsset>(filePath);
+    if (!asset->isValid()) {
+        return MappedAssetPointer();
+    }
+
+    QMutexLocker locker(&_mutex);
+    auto itr = _entries.find(hash);
+    if (itr != _entries.end()) {
+        // another request mapped it meanwhile
+        return itr->asset;
+    }
+
+    if (asset->getSize() <= _maxSize && _maxEntries > 0) {
+        evict(_maxSize - asset->getSize(), _maxEntries - 1);
+        _lru.push_front(hash);
+        _entries.insert(hash, { asset, _lru.begin() });
+        _size += asset->getSize();
+    }
+    return asset;
+}
+
+void AssetDataCache::remove(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+    auto itr = _entries.find(hash);
+    if (itr != _entries.end()) {
+        _size -= itr->asset->getSize();
+        _lru.erase(itr->lruPosition);
+        _entries.erase(itr);
+    }
+}
+
+void AssetDataCache::recordSent(const AssetUtils::AssetHash& hash, qint64 numBytes) {
+    QMutexLocker locker(&_mutex);
+    _totalStats.bytesSent += numBytes;
+    _assetStats[hash].bytesSent += numBytes;
+}
+
+void AssetDataCache::evict(qint64 maxSize, int maxEntries) {
+    while ((_size > maxSize || (int)_lru.size() > maxEntries) && !_lru.empty()) {
+        auto itr = _entries.find(_lru.back());
+        _size -= itr->asset->getSize();
+        _entries.erase(itr);
+        _lru.pop_back();
+        ++_numEvictions;
+    }
+}
+
+QJsonObject AssetDataCache::getStats() {
+    static const float MSECS_PER_SEC = 1000.0f;
+    static const float MEGABITS_PER_BYTE = 8.0f / 1000000.0f; // Bytes => Mbits
+    static const float MEGABYTES_PER_BYTE = 1.0f / (1024.0f * 1024.0f);
+    const int MAX_ASSETS_IN_STATS = 10;
+
+    QMutexLocker locker(&_mutex);
+
+    float elapsed = _statsTimer.isValid() ? (float)_statsTimer.elapsed() / MSECS_PER_SEC : 0.0f; // sec
+    float megabitsPerSecPerByte = elapsed > 0.0f ? MEGABITS_PER_BYTE / elapsed : 0.0f; // Bytes => Mb/s
+    _statsTimer.start();
+
+    QJsonObject cacheStats;
+    cacheStats["1. Cached Assets"] = _entries.size();
+    cacheStats["2. Cached (MB)"] = (float)_size * MEGABYTES_PER_BYTE;
+    cacheStats["3. Limit (MB)"] = (float)_maxSize * MEGABYTES_PER_BYTE;
+    cacheStats["4. Hits"] = _totalStats.hits;
+    cacheStats["5. Misses"] = _totalStats.misses;
+    cacheStats["6. Evictions"] = _numEvictions;
+    cacheStats["7. Sent (MB)"] = (float)_totalStats.bytesSent * MEGABYTES_PER_BYTE;
+
+    // the assets that were sent the most since the last stats
+    std::vector<std::pair<AssetUtils::AssetHash, AssetStats>> assetStats;
+    assetStats.reserve(_assetStats.size());
+    for (auto itr = _assetStats.cbegin(); itr != _assetStats.cend(); ++itr) {
+        assetStats.emplace_back(itr.key(), itr.value());
+    }
+    std::sort(assetStats.begin(), assetStats.end(), [](const auto& a, const auto& b) {
+        return a.second.bytesSent > b.second.bytesSent;
+    });
+    _assetStats.clear();
+
+    QJsonObject hotAssets;
+    for (size_t i = 0; i < assetStats.size() && i < (size_t)MAX_ASSETS_IN_STATS; ++i) {
+        QJsonObject stats;
+        stats["1. Hits"] = assetStats[i].second.hits;
+        stats["2. Misses"] = assetStats[i].second.misses;
+        stats["3. Up (Mb/s)"] = assetStats[i].second.bytesSent * megabitsPerSecPerByte;
+        hotAssets[assetStats[i].first] = stats;
+    }
+    cacheStats["8. Hot Assets"] = hotAssets;
+
+    return cacheStats;
+}
@@ -0,0 +1,95 @@
+//
+//  AssetDataCache.h
+//  assignment-client/src/assets
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetDataCache_h
+#define hifi_AssetDataCache_h
+
+#include <list>
+#include <memory>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+#include "AssetUtils.h"
+
+// Keeps the asset files that are being requested mapped into memory, so a popular asset is served to every client
+//   straight from the mapping instead of being read into a buffer for each request.
+//   Asset files are named by the hash of their contents and never change, so a mapping stays valid until the asset is
+//   deleted. The least recently requested assets are unmapped once the total size of the mapped files is over the limit,
+//   or once there are more of them than the limit on open files allows.
+class AssetDataCache {
+public:
+    // every mapped asset keeps its file open, which has to leave plenty of room under the usual limit of 1024
+    static const int DEFAULT_MAX_ENTRIES = 512;
+
+    class MappedAsset {
+    public:
+        MappedAsset(const QString& filePath);
+
+        bool isValid() const { return _isValid; }
+        const char* getData() const { return (const char*)_data; }
+        qint64 getSize() const { return _size; }
+
+    private:
+        QFile _file;
+        const uchar* _data { nullptr };
+        qint64 _size { 0 };
+        bool _isValid { false };
+    };
+    using MappedAssetPointer = std::shared_ptr<const MappedAsset>;
+
+    void setMaxSize(qint64 maxSize); // bytes, 0 turns the cache off
+    void setMaxEntries(int maxEntries); // assets, 0 turns the cache off
+
+    // returns the mapped asset file, or null if it can't be opened
+    MappedAssetPointer get(const AssetUtils::AssetHash& hash, const QString& filePath);
+
+    // call before deleting an asset file, which can't be deleted while it's mapped on some platforms
+    void remove(const AssetUtils::AssetHash& hash);
+
+    void recordSent(const AssetUtils::AssetHash& hash, qint64 numBytes);
+
+    // totals, and hits, misses and throughput for the assets that have been sent the most since the last call
+    QJsonObject getStats();
+
+private:
+    class AssetStats {
+    public:
+        int hits { 0 };
+        int misses { 0 };
+        qint64 bytesSent { 0 };
+    };
+
+    class CacheEntry {
+    public:
+        MappedAssetPointer asset;
+        std::list<AssetUtils::AssetHash>::iterator lruPosition;
+    };
+
+    void evict(qint64 maxSize, int maxEntries);
+
+    QMutex _mutex;
+    qint64 _maxSize { 0 };
+    int _maxEntries { DEFAULT_MAX_ENTRIES };
+    qint64 _size { 0 };
+    QHash<AssetUtils::AssetHash, CacheEntry> _entries;
+    std::list<AssetUtils::AssetHash> _lru; // most recently requested first
+
+    AssetStats _totalStats;
+    int _numEvictions { 0 };
+    QHash<AssetUtils::AssetHash, AssetStats> _assetStats; // since the last stats
+    QElapsedTimer _statsTimer;
+};
+
+#endif // hifi_AssetDataCache_h
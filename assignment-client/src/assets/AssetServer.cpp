@@ -25,6 +25,7 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QSaveFile>
 #include <QtCore/QString>
+#include <QtCore/QThread>
 #include <QtGui/QImageReader>
 #include <QtCore/QVector>
 #include <QtCore/QUrlQuery>
@@ -125,12 +126,65 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
         connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
         connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
 
-        _bakingTaskPool.start(task.get());
+        _queuedBakes[assetHash] = QFileInfo(filePath).size();
+        startQueuedBakes();
     } else {
         qDebug() << "Already in queue";
     }
 }
 
+// rough peak memory of an oven process baking a file of this size, textures are decompressed and models are expanded
+static qint64 estimateBakingMemory(qint64 fileSize) {
+    static const qint64 MIN_BAKING_MEMORY = 64 * 1024 * 1024; // bytes
+    static const qint64 BAKING_MEMORY_PER_FILE_BYTE = 16;
+    return std::max(MIN_BAKING_MEMORY, fileSize * BAKING_MEMORY_PER_FILE_BYTE);
+}
+
+void AssetServer::startQueuedBakes() {
+    while (!_queuedBakes.empty() && _runningBakes.size() < _bakingTaskPool.maxThreadCount()) {
+        // the bake most asked for by clients, then the smallest, since it'll be done soonest
+        auto next = _queuedBakes.cend();
+        int nextRequestCount = 0;
+        for (auto it = _queuedBakes.cbegin(); it != _queuedBakes.cend(); ++it) {
+            int requestCount = _assetRequestCounts.value(it.key());
+            if (next == _queuedBakes.cend() || requestCount > nextRequestCount ||
+                (requestCount == nextRequestCount && it.value() < next.value())) {
+                next = it;
+                nextRequestCount = requestCount;
+            }
+        }
+
+        // always let one bake run, however big it is
+        qint64 memory = estimateBakingMemory(next.value());
+        if (!_runningBakes.empty() && _runningBakesMemory + memory > _maxBakingMemory) {
+            break;
+        }
+
+        auto assetHash = next.key();
+        _runningBakes[assetHash] = next.value();
+        _runningBakesMemory += memory;
+        _queuedBakes.remove(assetHash);
+
+        qDebug() << "Queuing bake of" << assetHash << "requested" << nextRequestCount << "times," << _queuedBakes.size()
+            << "bakes waiting";
+        _bakingTaskPool.start(_pendingBakes[assetHash].get());
+    }
+}
+
+void AssetServer::finishBake(const AssetUtils::AssetHash& originalAssetHash) {
+    _pendingBakes.remove(originalAssetHash);
+
+    auto it = _runningBakes.find(originalAssetHash);
+    if (it != _runningBakes.end()) {
+        _runningBakesMemory -= estimateBakingMemory(it.value());
+        ++_numBakesFinishedSinceStats;
+        _bakedBytesSinceStats += it.value();
+        _runningBakes.erase(it);
+    }
+
+    startQueuedBakes();
+}
+
 QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash) {
     return _filesDirectory.absoluteFilePath(assetHash);
 }
@@ -304,7 +358,7 @@ AssetServer::AssetServer(ReceivedMessage& message) :
     // so the ideal is greater than the number of cores on the system.
     static const int TASK_POOL_THREAD_COUNT = 50;
     _transferTaskPool.setMaxThreadCount(TASK_POOL_THREAD_COUNT);
-    _bakingTaskPool.setMaxThreadCount(1);
+    _bakingTaskPool.setMaxThreadCount(1); // until the settings say otherwise
 
     // Queue all requests until the Asset Server is fully setup
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
@@ -333,6 +387,11 @@ void AssetServer::aboutToFinish() {
     // abort each of our still running bake tasks, remove pending bakes that were never put on the thread pool
     auto it = _pendingBakes.begin();
     while (it != _pendingBakes.end()) {
+        if (_queuedBakes.remove(it.key()) > 0) {
+            it = _pendingBakes.erase(it);
+            continue;
+        }
+
         auto pendingRunnable =  _bakingTaskPool.tryTake(it->get());
 
         if (pendingRunnable) {
@@ -424,6 +483,21 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    // get the number of assets to bake at once, and the memory they can take between them
+    static const QString BAKING_THREAD_COUNT_OPTION = "baking_thread_count";
+    static const QString BAKING_MEMORY_LIMIT_OPTION = "baking_memory_limit";
+    static const int DEFAULT_BAKING_THREAD_COUNT = 2;
+    static const int DEFAULT_BAKING_MEMORY_LIMIT = 2048; // MBytes
+    static const qint64 BYTES_PER_MEGABYTE = 1024 * 1024;
+    int bakingThreadCount = assetServerObject[BAKING_THREAD_COUNT_OPTION].toInt(DEFAULT_BAKING_THREAD_COUNT);
+    if (bakingThreadCount <= 0) {
+        bakingThreadCount = std::max(QThread::idealThreadCount(), 1);
+    }
+    _bakingTaskPool.setMaxThreadCount(bakingThreadCount);
+    _maxBakingMemory = assetServerObject[BAKING_MEMORY_LIMIT_OPTION].toInt(DEFAULT_BAKING_MEMORY_LIMIT) * BYTES_PER_MEGABYTE;
+    qCInfo(asset_server) << "Baking up to" << bakingThreadCount << "assets at once, in up to"
+        << _maxBakingMemory / BYTES_PER_MEGABYTE << "MB";
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -458,6 +532,13 @@ void AssetServer::completeSetup() {
         _filesizeLimit = assetsFilesizeLimit * BITS_PER_MEGABITS;
     }
 
+    // get the total size of the asset files to keep mapped for downloads
+    static const QString ASSETS_CACHE_SIZE_OPTION = "assets_cache_size";
+    static const int DEFAULT_ASSETS_CACHE_SIZE = 1024; // MBytes
+    auto assetsCacheSize = assetServerObject[ASSETS_CACHE_SIZE_OPTION].toInt(DEFAULT_ASSETS_CACHE_SIZE);
+    _dataCache->setMaxSize(std::max(assetsCacheSize, 0) * BYTES_PER_MEGABYTE);
+    qCDebug(asset_server) << "Keeping up to" << assetsCacheSize << "MB of assets mapped for downloads";
+
     PathUtils::removeTemporaryApplicationDirs();
     PathUtils::removeTemporaryApplicationDirs("Oven");
 
@@ -536,6 +617,7 @@ void AssetServer::cleanupUnmappedFiles() {
             }
             if (!matched) {
                 // remove the unmapped file
+                _dataCache->remove(filename);
                 QFile removeableFile { fileInfo.absoluteFilePath() };
 
                 if (removeableFile.remove()) {
@@ -866,8 +948,12 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
         return;
     }
 
+    // count the requests for each asset, so the most wanted assets are baked first
+    AssetUtils::AssetHash assetHash = message->getMessage().mid(sizeof(MessageID), AssetUtils::SHA256_HASH_LENGTH).toHex();
+    ++_assetRequestCounts[assetHash];
+
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _dataCache);
     _transferTaskPool.start(task);
 }
 
@@ -957,6 +1043,28 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    serverStats["Asset Cache"] = _dataCache->getStats();
+
+    static const float MSECS_PER_MINUTE = 60.0f * 1000.0f;
+    static const float MEGABYTES_PER_BYTE = 1.0f / (1024.0f * 1024.0f);
+    float elapsedMinutes = _bakingStatsTimer.isValid() ? (float)_bakingStatsTimer.restart() / MSECS_PER_MINUTE : 0.0f;
+    if (!_bakingStatsTimer.isValid()) {
+        _bakingStatsTimer.start();
+    }
+
+    QJsonObject bakingStats;
+    bakingStats["1. Queued"] = _queuedBakes.size();
+    bakingStats["2. Baking"] = _runningBakes.size();
+    bakingStats["3. Baking Memory (MB)"] = (float)_runningBakesMemory * MEGABYTES_PER_BYTE;
+    bakingStats["4. Completed"] = _numBakesCompleted;
+    bakingStats["5. Failed"] = _numBakesFailed;
+    bakingStats["6. Bakes/min"] = elapsedMinutes > 0.0f ? (float)_numBakesFinishedSinceStats / elapsedMinutes : 0.0f;
+    bakingStats["7. Baked (MB/min)"] = elapsedMinutes > 0.0f ?
+        (float)_bakedBytesSinceStats * MEGABYTES_PER_BYTE / elapsedMinutes : 0.0f;
+    serverStats["Baking"] = bakingStats;
+    _numBakesFinishedSinceStats = 0;
+    _bakedBytesSinceStats = 0;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1170,6 +1278,7 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
         // we now have a set of hashes that are unmapped - we will delete those asset files
         for (auto& hash : hashesToCheckForDeletion) {
             // remove the unmapped file
+            _dataCache->remove(hash);
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
             if (removeableFile.remove()) {
@@ -1309,7 +1418,8 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
-    _pendingBakes.remove(originalAssetHash);
+    ++_numBakesFailed;
+    finishBake(originalAssetHash);
 }
 
 void AssetServer::handleCompletedBake(QString originalAssetHash, QString originalAssetPath,
@@ -1332,7 +1442,12 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
-        _pendingBakes.remove(originalAssetHash);
+        if (errorCompletingBake) {
+            ++_numBakesFailed;
+        } else {
+            ++_numBakesCompleted;
+        }
+        finishBake(originalAssetHash);
     };
 
     bool errorCompletingBake { false };
@@ -1465,7 +1580,7 @@ void AssetServer::handleAbortedBake(QString originalAssetHash, QString assetPath
     qDebug() << "Aborted bake:" << originalAssetHash;
 
     // for an aborted bake we don't do anything but remove the BakeAssetTask from our pending bakes
-    _pendingBakes.remove(originalAssetHash);
+    finishBake(originalAssetHash);
 }
 
 static const QString BAKE_VERSION_KEY = "bake_version";
@@ -13,11 +13,13 @@
 #define hifi_AssetServer_h
 
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QThreadPool>
 #include <QRunnable>
 
 #include <ThreadedAssignment.h>
 
+#include "AssetDataCache.h"
 #include "AssetUtils.h"
 #include "ReceivedMessage.h"
 
@@ -136,6 +138,10 @@ private:
     bool needsToBeBaked(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& assetHash);
     void bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
 
+    /// Start the queued bakes that are most requested, then smallest, while there are threads and memory for them
+    void startQueuedBakes();
+    void finishBake(const AssetUtils::AssetHash& originalAssetHash);
+
     /// Move baked content for asset to baked directory and update baked status
     void handleCompletedBake(QString originalAssetHash, QString assetPath, QString bakedTempOutputDir);
     void handleFailedBake(QString originalAssetHash, QString assetPath, QString errors);
@@ -156,9 +162,24 @@ private:
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
+    /// Asset files mapped for the downloads, shared with the transfer tasks
+    std::shared_ptr<AssetDataCache> _dataCache { std::make_shared<AssetDataCache>() };
+
     QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
     QThreadPool _bakingTaskPool;
 
+    QHash<AssetUtils::AssetHash, qint64> _queuedBakes; // file size of the pending bakes that haven't been started
+    QHash<AssetUtils::AssetHash, qint64> _runningBakes; // file size of the bakes that have been started
+    qint64 _runningBakesMemory { 0 };
+    qint64 _maxBakingMemory { 0 };
+    QHash<AssetUtils::AssetHash, int> _assetRequestCounts;
+
+    int _numBakesCompleted { 0 };
+    int _numBakesFailed { 0 };
+    int _numBakesFinishedSinceStats { 0 };
+    qint64 _bakedBytesSinceStats { 0 };
+    QElapsedTimer _bakingStatsTimer;
+
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
     using RequestQueue = QVector<QPair<QSharedPointer<ReceivedMessage>, SharedNodePointer>>;
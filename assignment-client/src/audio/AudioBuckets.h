@@ -0,0 +1,157 @@
+//
+//  AudioBuckets.h
+//  assignment-client/src/audio
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioBuckets_h
+#define hifi_AudioBuckets_h
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+// distance only shapes the near-field and distance filters (attenuation is already in the gain),
+// so a fixed fraction of an octave is plenty
+static const float DISTANCE_BUCKETS_PER_OCTAVE = 8.0f;
+
+// quieter than this every listener shares one bucket, it is effectively silent
+static const float MIN_GAIN_DB = -120.0f;
+
+// Where a listener hears a source from, rounded to a bucket.
+struct AudioBucket {
+    int azimuth { 0 };
+    int distance { 0 };
+    int gain { 0 };
+
+    bool operator==(const AudioBucket& other) const {
+        return azimuth == other.azimuth && distance == other.distance && gain == other.gain;
+    }
+
+    size_t hash(size_t seed) const {
+        size_t hash = seed * 31 + size_t(azimuth);
+        hash = hash * 31 + size_t(distance);
+        return hash * 31 + size_t(gain);
+    }
+};
+
+// Rounds the azimuth, distance and gain a listener hears a source at to buckets, and gives back the bucket centres.
+//   Listeners in the same bucket can share one render at its centre and stay within the configured error bounds.
+class AudioBucketQuantizer {
+public:
+    AudioBucketQuantizer(float maxAzimuthErrorDegrees, float maxGainErrorDB) {
+        setErrorBounds(maxAzimuthErrorDegrees, maxGainErrorDB);
+    }
+
+    // the largest difference between the azimuth/gain a listener gets and the centre of its bucket
+    void setErrorBounds(float maxAzimuthErrorDegrees, float maxGainErrorDB) {
+        // rounding to the nearest bucket centre is off by at most half a step
+        _azimuthStep = 2.0f * glm::radians(glm::max(maxAzimuthErrorDegrees, 0.01f));
+        _gainStepDB = 2.0f * glm::max(maxGainErrorDB, 0.01f);
+    }
+
+    AudioBucket quantize(float azimuth, float distance, float gain) const {
+        AudioBucket bucket;
+        bucket.azimuth = (int)lroundf(azimuth / _azimuthStep);
+        bucket.distance = (int)lroundf(log2f(distance) * DISTANCE_BUCKETS_PER_OCTAVE);
+        bucket.gain = quantizeGain(gain);
+        return bucket;
+    }
+
+    int quantizeGain(float gain) const {
+        float gainDB = gain > 0.0f ? glm::max(20.0f * log10f(gain), MIN_GAIN_DB) : MIN_GAIN_DB;
+        return (int)lroundf(gainDB / _gainStepDB);
+    }
+
+    float getAzimuth(const AudioBucket& bucket) const { return bucket.azimuth * _azimuthStep; }
+    float getDistance(const AudioBucket& bucket) const { return exp2f(bucket.distance / DISTANCE_BUCKETS_PER_OCTAVE); }
+    float getGain(const AudioBucket& bucket) const {
+        return bucket.gain * _gainStepDB <= MIN_GAIN_DB ? 0.0f : powf(10.0f, bucket.gain * _gainStepDB / 20.0f);
+    }
+
+private:
+    float _azimuthStep { 0.0f };
+    float _gainStepDB { 0.0f };
+};
+
+// Entries that live for as long as some listener uses them every frame.
+//   Entries are split across shards so that slaves looking up different keys rarely contend.
+//   Entry needs a std::atomic<unsigned int> usedFrame member, which findOrCreate() stamps with the current frame.
+//   findOrCreate() is thread-safe, beginFrame() and clear() must be called while no slaves are mixing.
+template <typename Key, typename Entry, typename KeyHasher>
+class AudioBucketMap {
+public:
+    unsigned int getFrame() const { return _frame; }
+
+    // create(key) returns a new Entry*, it is only called if there is no entry for the key yet
+    template <typename Create>
+    Entry& findOrCreate(Key key, Create create) {
+        Entry* entry = nullptr;
+        {
+            auto& shard = _shards[KeyHasher()(key) % NUM_SHARDS];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto it = shard.entries.find(key);
+            if (it == shard.entries.end()) {
+                std::unique_ptr<Entry> newEntry(create(key));
+                it = shard.entries.emplace(std::move(key), std::move(newEntry)).first;
+            }
+            entry = it->second.get();
+        }
+
+        // entries are only erased in beginFrame, never while slaves are mixing
+        entry->usedFrame.store(_frame);
+        return *entry;
+    }
+
+    // drops entries that were not used in the last frame, and calls kept(entry) on the others
+    template <typename Kept>
+    void beginFrame(Kept kept) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+                if (it->second->usedFrame.load() != _frame) {
+                    it = shard.entries.erase(it);
+                } else {
+                    kept(*it->second);
+                    ++it;
+                }
+            }
+        }
+
+        ++_frame;
+    }
+
+    void beginFrame() { beginFrame([](Entry&) {}); }
+
+    void clear() {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.entries.clear();
+        }
+    }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<Key, std::unique_ptr<Entry>, KeyHasher> entries;
+    };
+    static const int NUM_SHARDS = 32;
+
+    unsigned int _frame { 1 };
+
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+#endif // hifi_AudioBuckets_h
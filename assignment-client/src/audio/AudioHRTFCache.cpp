@@ -0,0 +1,58 @@
+//
+//  AudioHRTFCache.cpp
+//  assignment-client/src/audio
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioHRTFCache.h"
+
+#include <cstring>
+
+const float AudioHRTFCache::DEFAULT_MAX_AZIMUTH_ERROR_DEGREES = 2.5f; // half of the HRTF's 5-degree azimuth steps
+const float AudioHRTFCache::DEFAULT_MAX_GAIN_ERROR_DB = 0.5f;
+
+static const int HRTF_DATASET_INDEX = 1;
+
+size_t AudioHRTFCache::KeyHasher::operator()(const Key& key) const {
+    return key.bucket.hash(qHash(key.streamID) ^ (size_t(key.sourceID) << 16));
+}
+
+void AudioHRTFCache::setErrorBounds(float maxAzimuthErrorDegrees, float maxGainErrorDB) {
+    _quantizer.setErrorBounds(maxAzimuthErrorDegrees, maxGainErrorDB);
+
+    // buckets from the old steps would now be wrong
+    clear();
+}
+
+const float* AudioHRTFCache::render(const NodeIDStreamID& source, int16_t* input, float azimuth, float distance,
+                                    float gain, bool& wasShared) {
+    Key key;
+    key.sourceID = source.nodeLocalID;
+    key.streamID = source.streamID;
+    key.bucket = _quantizer.quantize(azimuth, distance, gain);
+
+    Entry& entry = _entries.findOrCreate(key, [](const Key&) { return new Entry; });
+    unsigned int frame = _entries.getFrame();
+
+    std::lock_guard<std::mutex> lock(entry.mutex);
+
+    if (entry.renderedFrame == frame) {
+        wasShared = true;
+        return entry.output;
+    }
+
+    // render at the bucket centre, so every listener in the bucket is within the error bounds of what they'd hear
+    memset(entry.output, 0, sizeof(entry.output));
+    entry.hrtf.render(input, entry.output, HRTF_DATASET_INDEX, _quantizer.getAzimuth(key.bucket),
+                      _quantizer.getDistance(key.bucket), _quantizer.getGain(key.bucket),
+                      AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    entry.renderedFrame = frame;
+
+    wasShared = false;
+    return entry.output;
+}
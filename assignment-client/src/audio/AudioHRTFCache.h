@@ -0,0 +1,81 @@
+//
+//  AudioHRTFCache.h
+//  assignment-client/src/audio
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioHRTFCache_h
+#define hifi_AudioHRTFCache_h
+
+#include <atomic>
+#include <mutex>
+
+#include <AudioConstants.h>
+#include <AudioHRTF.h>
+#include <PositionalAudioStream.h>
+
+#include "AudioBuckets.h"
+
+// Shares HRTF renders of a mono source between the listeners that hear it from (nearly) the same place.
+//   Listener azimuth and gain are quantized to within the configured error bounds, and the first listener in a
+//   bucket to be mixed in a frame renders the source through the bucket's own HRTF. Every other listener in that
+//   bucket mixes in the same rendered frame. Buckets keep their HRTF (and so its filter state) for as long as
+//   some listener lands in them every frame.
+//   render() is thread-safe, beginFrame() and the setters must be called while no slaves are mixing.
+class AudioHRTFCache {
+public:
+    static const float DEFAULT_MAX_AZIMUTH_ERROR_DEGREES;
+    static const float DEFAULT_MAX_GAIN_ERROR_DB;
+
+    AudioHRTFCache() : _quantizer(DEFAULT_MAX_AZIMUTH_ERROR_DEGREES, DEFAULT_MAX_GAIN_ERROR_DB) {}
+
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+    bool isEnabled() const { return _isEnabled; }
+
+    // the largest difference between the azimuth/gain a listener gets and what it would get from its own render
+    void setErrorBounds(float maxAzimuthErrorDegrees, float maxGainErrorDB);
+
+    // drops buckets that no listener used in the last frame
+    void beginFrame() { _entries.beginFrame(); }
+
+    // returns the stereo frame of the source rendered for this azimuth, distance and gain
+    // wasShared is set if another listener already rendered it this frame
+    const float* render(const NodeIDStreamID& source, int16_t* input, float azimuth, float distance, float gain,
+                        bool& wasShared);
+
+    void clear() { _entries.clear(); }
+
+private:
+    struct Key {
+        Node::LocalID sourceID;
+        StreamID streamID;
+        AudioBucket bucket;
+
+        bool operator==(const Key& other) const {
+            return sourceID == other.sourceID && streamID == other.streamID && bucket == other.bucket;
+        }
+    };
+
+    struct KeyHasher {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        std::mutex mutex;
+        AudioHRTF hrtf;
+        unsigned int renderedFrame { 0 };
+        std::atomic<unsigned int> usedFrame { 0 };
+        float output[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    };
+
+    bool _isEnabled { false };
+    AudioBucketQuantizer _quantizer;
+    AudioBucketMap<Key, Entry, KeyHasher> _entries;
+};
+
+#endif // hifi_AudioHRTFCache_h
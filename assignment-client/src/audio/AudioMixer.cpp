@@ -270,12 +270,10 @@ void AudioMixer::sendStatsPacket() {
         return;
     }
 
-#ifdef DEBUG_EVENT_QUEUE
     QJsonObject qtStats;
 
     _slavePool.queueStats(qtStats);
     statsObject["audio_thread_event_queue"] = qtStats;
-#endif
 
     // general stats
     statsObject["useDynamicJitterBuffers"] = _numStaticJitterFrames == DISABLE_STATIC_JITTER_FRAMES;
@@ -286,6 +284,7 @@ void AudioMixer::sendStatsPacket() {
     statsObject["throttling_ratio"] = _throttlingRatio;
 
     statsObject["avg_streams_per_frame"] = (float)_stats.sumStreams / (float)_numStatFrames;
+    statsObject["avg_decoded_packets_per_frame"] = (float)_stats.decodedPackets / (float)_numStatFrames;
     statsObject["avg_listeners_per_frame"] = (float)_stats.sumListeners / (float)_numStatFrames;
     statsObject["avg_listeners_(silent)_per_frame"] = (float)_stats.sumListenersSilent / (float)_numStatFrames;
 
@@ -306,6 +305,7 @@ void AudioMixer::sendStatsPacket() {
     addTiming(_sleepTiming, "sleep");
     addTiming(_frameTiming, "frame");
     addTiming(_packetsTiming, "packets");
+    addTiming(_decodeTiming, "decode");
     addTiming(_mixTiming, "mix");
     addTiming(_eventsTiming, "events");
 
@@ -327,6 +327,15 @@ void AudioMixer::sendStatsPacket() {
     mixStats["1_hrtf_resets"] = (int)(_stats.hrtfResets / (float)_numStatFrames);
     mixStats["1_hrtf_updates"] = (int)(_stats.hrtfUpdates / (float)_numStatFrames);
 
+    int hrtfCacheLookups = _stats.hrtfCacheHits + _stats.hrtfCacheMisses;
+    mixStats["1_hrtf_cache_hits"] = (int)(_stats.hrtfCacheHits / (float)_numStatFrames);
+    mixStats["1_hrtf_cache_hit_rate"] = (hrtfCacheLookups > 0) ? (float)_stats.hrtfCacheHits / hrtfCacheLookups : 0.0f;
+
+    // every listener served from a shared mix beyond the first is a mix and an encode saved
+    mixStats["1_shared_mixes"] = (int)(_stats.sharedMixes / (float)_numStatFrames);
+    mixStats["1_shared_mix_listeners"] = (int)(_stats.sharedMixListeners / (float)_numStatFrames);
+    mixStats["1_shared_mix_encodes_saved"] = (int)((_stats.sharedMixListeners - _stats.sharedMixes) / (float)_numStatFrames);
+
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
     mixStats["2_active_streams"] = (int)(_stats.active / (float)_numStatFrames);
@@ -441,6 +450,15 @@ void AudioMixer::start() {
             });
         }
 
+        // decode the audio packets that came in this frame across slave threads, and pop each stream's frame to mix
+        {
+            auto decodeTimer = _decodeTiming.timer();
+
+            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+                _slavePool.decodeStreams(cbegin, cend);
+            });
+        }
+
         // process queued events (networking, global audio packets, &c.)
         {
             auto eventsTimer = _eventsTiming.timer();
@@ -458,6 +476,10 @@ void AudioMixer::start() {
         if (_throttlingRatio > EPSILON) {
             numToRetain = nodeList->size() * (1.0f - _throttlingRatio);
         }
+        // drop shared HRTF renders and mixes nobody used last frame, before the slaves start filling them again
+        _workerSharedData.hrtfCache.beginFrame();
+        _workerSharedData.sharedMixes.beginFrame();
+
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
@@ -555,6 +577,21 @@ void AudioMixer::clearDomainSettings() {
     _zoneReverbSettings.clear();
 }
 
+// AudioHRTFCache and AudioSharedMixes are set up by the same three settings: "<key>", "<key>_azimuth_error"
+// and "<key>_gain_error"
+template <typename SharedRenders>
+static void parseSharingSettings(const QJsonObject& groupObject, const QString& key, const char* name,
+                                 SharedRenders& sharedRenders) {
+    sharedRenders.setEnabled(groupObject[key].toBool());
+
+    float maxAzimuthError = groupObject[key + "_azimuth_error"].toDouble(SharedRenders::DEFAULT_MAX_AZIMUTH_ERROR_DEGREES);
+    float maxGainError = groupObject[key + "_gain_error"].toDouble(SharedRenders::DEFAULT_MAX_GAIN_ERROR_DB);
+    sharedRenders.setErrorBounds(maxAzimuthError, maxGainError);
+
+    qCDebug(audio) << name << (sharedRenders.isEnabled() ? "enabled" : "disabled")
+        << "Azimuth error:" << maxAzimuthError << "Gain error:" << maxGainError;
+}
+
 void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
     qCDebug(audio) << "AVX2 Support:" << (cpuSupportsAVX2() ? "enabled" : "disabled");
 
@@ -588,6 +625,9 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
         }
 
         qCDebug(audio) << "Throttle Start:" << _throttleStartTarget << "Throttle Backoff:" << _throttleBackoffTarget;
+
+        parseSharingSettings(audioThreadingGroupObject, "hrtf_cache", "Shared HRTF cache:", _workerSharedData.hrtfCache);
+        parseSharingSettings(audioThreadingGroupObject, "shared_mix", "Shared mixes:", _workerSharedData.sharedMixes);
     }
 
     if (settingsObject.contains(AUDIO_BUFFER_GROUP_KEY)) {
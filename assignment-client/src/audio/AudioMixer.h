@@ -137,6 +137,7 @@ private:
     Timer _mixTiming;
     Timer _eventsTiming;
     Timer _packetsTiming;
+    Timer _decodeTiming;
 
     static int _numStaticJitterFrames; // -1 denotes dynamic jitter buffering
     static float _noiseMutingThreshold;
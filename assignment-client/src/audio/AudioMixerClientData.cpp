@@ -57,11 +57,13 @@ void AudioMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message,
     _packetQueue.push(message);
 }
 
-int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
+void AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
     SharedNodePointer node = _packetQueue.node;
     assert(_packetQueue.empty() || node);
     _packetQueue.node.clear();
 
+    prepareStreamDecodes();
+
     while (!_packetQueue.empty()) {
         auto& packet = _packetQueue.front();
 
@@ -74,7 +76,7 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
                     setupCodecForReplicatedAgent(packet);
                 }
 
-                processStreamPacket(*packet, addedStreams);
+                processStreamPacket(packet, addedStreams);
 
                 optionallyReplicatePacket(*packet, *node);
                 break;
@@ -114,10 +116,6 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
         _packetQueue.pop();
     }
     assert(_packetQueue.empty());
-
-    // now that we have processed all packets for this frame
-    // we can prepare the sources from this client to be ready for mixing
-    return checkBuffersBeforeFrameSend();
 }
 
 bool isReplicatedPacket(PacketType packetType) {
@@ -433,16 +431,16 @@ bool AudioMixerClientData::containsValidPosition(ReceivedMessage& message) const
     return true;
 }
 
-void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, ConcurrentAddedStreams &addedStreams) {
+void AudioMixerClientData::processStreamPacket(QSharedPointer<ReceivedMessage> message, ConcurrentAddedStreams& addedStreams) {
 
-    if (!containsValidPosition(message)) {
-        qDebug() << "Refusing to process audio stream from" << message.getSourceID() << "with invalid position";
+    if (!containsValidPosition(*message)) {
+        qDebug() << "Refusing to process audio stream from" << message->getSourceID() << "with invalid position";
         return;
     }
 
     SharedStreamPointer matchingStream;
 
-    auto packetType = message.getType();
+    auto packetType = message->getType();
     bool newStream = false;
 
     if (packetType == PacketType::MicrophoneAudioWithEcho
@@ -457,20 +455,20 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
             // we don't have a mic stream yet, so add it
 
             // hop past the sequence number that leads the packet
-            message.seek(sizeof(StreamSequenceNumber));
+            message->seek(sizeof(StreamSequenceNumber));
 
             // pull the codec string from the packet
-            auto codecString = message.readString();
+            auto codecString = message->readString();
 
             // determine if the stream is stereo or not
             bool isStereo;
             if (packetType == PacketType::SilentAudioFrame || packetType == PacketType::ReplicatedSilentAudioFrame) {
                 SilentSamplesBytes numSilentSamples;
-                message.readPrimitive(&numSilentSamples);
+                message->readPrimitive(&numSilentSamples);
                 isStereo = numSilentSamples == AudioConstants::NETWORK_FRAME_SAMPLES_STEREO;
             } else {
                 ChannelFlag channelFlag;
-                message.readPrimitive(&channelFlag);
+                message->readPrimitive(&channelFlag);
                 isStereo = channelFlag == 1;
             }
 
@@ -499,10 +497,10 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
 
         // this is injected audio
         // skip the sequence number and codec string and grab the stream identifier for this injected audio
-        message.seek(sizeof(StreamSequenceNumber));
-        message.readString();
+        message->seek(sizeof(StreamSequenceNumber));
+        message->readString();
 
-        QUuid streamIdentifier = QUuid::fromRfc4122(message.readWithoutCopy(NUM_BYTES_RFC4122_UUID));
+        QUuid streamIdentifier = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
 
         auto streamIt = std::find_if(_audioStreams.begin(), _audioStreams.end(), [&streamIdentifier](const SharedStreamPointer& stream) {
             return stream->getStreamIdentifier() == streamIdentifier;
@@ -510,7 +508,7 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
 
         if (streamIt == _audioStreams.end()) {
             bool isStereo;
-            message.readPrimitive(&isStereo);
+            message->readPrimitive(&isStereo);
 
             // we don't have this injected stream yet, so add it
             auto injectorStream = new InjectedAudioStream(streamIdentifier, isStereo, AudioMixer::getStaticJitterFrames());
@@ -529,17 +527,15 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
         }
     }
 
-    // seek to the beginning of the packet so that the next reader is in the right spot
-    message.seek(0);
-
-    // check the overflow count before we parse data
-    auto overflowBefore = matchingStream->getOverflowCount();
-    matchingStream->parseData(message);
-
-    if (matchingStream->getOverflowCount() > overflowBefore) {
-        qCDebug(audio) << "Just overflowed on stream" << matchingStream->getStreamIdentifier()
-            << "from" << message.getSourceID();
+    // the audio itself is decoded with every other stream's, once all packets for this frame are processed
+    auto streamDecodeIt = std::find_if(_streamDecodes.begin(), _streamDecodes.end(), [&](const StreamDecode& streamDecode) {
+        return streamDecode.stream == matchingStream;
+    });
+    if (streamDecodeIt == _streamDecodes.end()) {
+        _streamDecodes.push_back({ matchingStream, {} });
+        streamDecodeIt = std::prev(_streamDecodes.end());
     }
+    streamDecodeIt->packets.push_back(message);
 
     if (newStream) {
         // whenever a stream is added, push it to the concurrent vector of streams added this frame
@@ -547,19 +543,15 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
     }
 }
 
-int AudioMixerClientData::checkBuffersBeforeFrameSend() {
+void AudioMixerClientData::prepareStreamDecodes() {
+    static const int INJECTOR_MAX_INACTIVE_BLOCKS = 500;
+
+    // if we don't have new data for an injected stream in the last INJECTOR_MAX_INACTIVE_BLOCKS then
+    // we remove the injector from our streams
     auto it = _audioStreams.begin();
     while (it != _audioStreams.end()) {
         SharedStreamPointer stream = *it;
 
-        if (stream->popFrames(1, true) > 0) {
-            stream->updateLastPopOutputLoudnessAndTrailingLoudness();
-        }
-
-        static const int INJECTOR_MAX_INACTIVE_BLOCKS = 500;
-
-        // if we don't have new data for an injected stream in the last INJECTOR_MAX_INACTIVE_BLOCKS then
-        // we remove the injector from our streams
         if (stream->getType() == PositionalAudioStream::Injector
             && stream->getConsecutiveNotMixedCount() > INJECTOR_MAX_INACTIVE_BLOCKS) {
             // this is an inactive injector, pull it from our streams
@@ -574,7 +566,48 @@ int AudioMixerClientData::checkBuffersBeforeFrameSend() {
         }
     }
 
-    return (int)_audioStreams.size();
+    // every stream pops a frame, whether or not any audio came in for it
+    _streamDecodes.resize(_audioStreams.size());
+    for (size_t i = 0; i < _audioStreams.size(); ++i) {
+        _streamDecodes[i].stream = _audioStreams[i];
+        _streamDecodes[i].packets.clear();
+    }
+}
+
+int AudioMixerClientData::parseStreamPackets(StreamDecode& streamDecode) {
+    auto& stream = streamDecode.stream;
+    int numParsedPackets = (int)streamDecode.packets.size();
+
+    for (auto& message : streamDecode.packets) {
+        // seek to the beginning of the packet so that the stream reads it from the start
+        message->seek(0);
+
+        // check the overflow count before we parse data
+        auto overflowBefore = stream->getOverflowCount();
+        stream->parseData(*message);
+
+        if (stream->getOverflowCount() > overflowBefore) {
+            qCDebug(audio) << "Just overflowed on stream" << stream->getStreamIdentifier()
+                << "from" << message->getSourceID();
+        }
+    }
+
+    // keep the capacity, it is needed again next frame
+    streamDecode.packets.clear();
+
+    return numParsedPackets;
+}
+
+int AudioMixerClientData::decodeStream(StreamDecode& streamDecode) {
+    int numDecodedPackets = parseStreamPackets(streamDecode);
+
+    // now that we have decoded all audio for this frame the stream can be made ready for mixing
+    auto& stream = streamDecode.stream;
+    if (stream->popFrames(1, true) > 0) {
+        stream->updateLastPopOutputLoudnessAndTrailingLoudness();
+    }
+
+    return numDecodedPackets;
 }
 
 void AudioMixerClientData::parseStopInjectorPacket(QSharedPointer<ReceivedMessage> packet) {
@@ -585,6 +618,13 @@ void AudioMixerClientData::parseStopInjectorPacket(QSharedPointer<ReceivedMessag
     });
 
     if (it != std::end(_audioStreams)) {
+        auto streamDecodeIt = std::find_if(_streamDecodes.begin(), _streamDecodes.end(), [&](const StreamDecode& streamDecode) {
+            return streamDecode.stream == *it;
+        });
+        if (streamDecodeIt != _streamDecodes.end()) {
+            _streamDecodes.erase(streamDecodeIt);
+        }
+
         _audioStreams.erase(it);
         emit injectorStreamFinished(streamID);
     }
@@ -758,6 +798,11 @@ void AudioMixerClientData::encodeFrameOfZeros(QByteArray& encodedZeros) {
 }
 
 void AudioMixerClientData::setupCodec(CodecPluginPointer codec, const QString& codecName) {
+    // audio that arrived before the switch is decoded with the codec it was sent with
+    for (auto& streamDecode : _streamDecodes) {
+        parseStreamPackets(streamDecode);
+    }
+
     cleanupCodec(); // cleanup any previously allocated coders first
     _codec = codec;
     _selectedCodecName = codecName;
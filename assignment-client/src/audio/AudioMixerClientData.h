@@ -13,6 +13,7 @@
 #define hifi_AudioMixerClientData_h
 
 #include <queue>
+#include <vector>
 
 #include <tbb/concurrent_vector.h>
 
@@ -50,7 +51,22 @@ public:
     using AudioStreamVector = std::vector<SharedStreamPointer>;
 
     void queuePacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer node);
-    int processPackets(ConcurrentAddedStreams& addedStreams); // returns the number of available streams this frame
+    void processPackets(ConcurrentAddedStreams& addedStreams);
+
+    // a stream, and the audio packets processPackets queued for it this frame in the order they arrived
+    //   Each stream decodes with its own codec state, so the pool decodes streams, not nodes, across slave threads.
+    struct StreamDecode {
+        SharedStreamPointer stream;
+        std::vector<QSharedPointer<ReceivedMessage>> packets;
+    };
+    using StreamDecodes = std::vector<StreamDecode>;
+
+    // one per stream, rebuilt by processPackets each frame
+    StreamDecodes& getStreamDecodes() { return _streamDecodes; }
+
+    // decodes the stream's queued packets into its ring buffer, then pops its frame to mix
+    // returns the number of packets decoded
+    static int decodeStream(StreamDecode& streamDecode);
 
     AudioStreamVector& getAudioStreams() { return _audioStreams; }
     AvatarAudioStream* getAvatarAudioStream();
@@ -59,7 +75,7 @@ public:
 
     // packet parsers
     int parseData(ReceivedMessage& message) override;
-    void processStreamPacket(ReceivedMessage& message, ConcurrentAddedStreams& addedStreams);
+    void processStreamPacket(QSharedPointer<ReceivedMessage> message, ConcurrentAddedStreams& addedStreams);
     void negotiateAudioFormat(ReceivedMessage& message, const SharedNodePointer& node);
     void parseRequestsDomainListData(ReceivedMessage& message);
     void parsePerAvatarGainSet(ReceivedMessage& message, const SharedNodePointer& node);
@@ -69,9 +85,6 @@ public:
     void parseSoloRequest(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& node);
     void parseStopInjectorPacket(QSharedPointer<ReceivedMessage> packet);
 
-    // attempt to pop a frame from each audio stream, and return the number of streams from this client
-    int checkBuffersBeforeFrameSend();
-
     QJsonObject getAudioStreamStats();
 
     void sendAudioStreamStatsPackets(const SharedNodePointer& destinationNode);
@@ -104,6 +117,7 @@ public:
     bool shouldFlushEncoder() { return _shouldFlushEncoder; }
 
     QString getCodecName() { return _selectedCodecName; }
+    CodecPluginPointer getCodec() const { return _codec; }
 
     bool shouldMuteClient() { return _shouldMuteClient; }
     void setShouldMuteClient(bool shouldMuteClient) { _shouldMuteClient = shouldMuteClient; }
@@ -174,6 +188,12 @@ private:
     };
     PacketQueue _packetQueue;
 
+    // drops injectors that have gone quiet, and starts this frame's decodes with one per remaining stream
+    void prepareStreamDecodes();
+    static int parseStreamPackets(StreamDecode& streamDecode);
+
+    StreamDecodes _streamDecodes;
+
     AudioStreamVector _audioStreams; // microphone stream from avatar has a null stream ID
 
     void optionallyReplicatePacket(ReceivedMessage& packet, const Node& node);
@@ -58,11 +58,15 @@ inline float computeAzimuth(const AvatarAudioStream& listeningNodeStream, const
 void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
     if (data) {
-        // process packets and collect the number of streams available for this frame
-        stats.sumStreams += data->processPackets(_sharedData.addedStreams);
+        data->processPackets(_sharedData.addedStreams);
     }
 }
 
+void AudioMixerSlave::decodeStream(AudioMixerClientData::StreamDecode& streamDecode) {
+    stats.decodedPackets += AudioMixerClientData::decodeStream(streamDecode);
+    ++stats.sumStreams;
+}
+
 void AudioMixerSlave::configureMix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain) {
     _begin = begin;
     _end = end;
@@ -96,25 +100,61 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
     if (node->getType() == NodeType::Agent && node->getActiveSocket()) {
         ++stats.sumListeners;
 
-        // mix the audio
-        bool mixHasAudio = prepareMix(node);
+        // work out what the listener hears
+        prepareMix(node);
+
+        // listeners that hear the same thing share one mix, and one encode of it
+        AudioSharedMixes::Mix* sharedMix = nullptr;
+        if (_sharedData.sharedMixes.isEnabled() && !_streamsToMix.empty()) {
+            sharedMix = _sharedData.sharedMixes.join(data->getCodecName(), data->getCodec(), _streamsToMix);
+        }
 
-        // send audio packet
-        if (mixHasAudio || data->shouldFlushEncoder()) {
+        if (sharedMix) {
             QByteArray encodedBuffer;
-            if (mixHasAudio) {
-                // encode the audio
-                QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
-                data->encode(decodedBuffer, encodedBuffer);
-            } else {
-                // time to flush (resets shouldFlush until the next encode)
-                data->encodeFrameOfZeros(encodedBuffer);
+            {
+                std::lock_guard<std::mutex> lock(sharedMix->mutex);
+                if (sharedMix->mixedFrame != _frame) {
+                    mixSharedStreams(*sharedMix);
+                    sharedMix->mixedFrame = _frame;
+                    ++stats.sharedMixes;
+                }
+                encodedBuffer = sharedMix->encodedBuffer;
+            }
+            ++stats.sharedMixListeners;
+
+            // keep this listener's own HRTFs following along, so it picks up smoothly when it mixes on its own again
+            for (const auto& stream : _streamsToMix) {
+                stream.hrtf->setParameterHistory(stream.azimuth, stream.distance, stream.gain);
             }
 
-            sendMixPacket(node, *data, encodedBuffer);
+            // send audio packet, with this listener's own sequence number
+            if (!encodedBuffer.isEmpty()) {
+                sendMixPacket(node, *data, encodedBuffer);
+            } else {
+                ++stats.sumListenersSilent;
+                sendSilentPacket(node, *data);
+            }
         } else {
-            ++stats.sumListenersSilent;
-            sendSilentPacket(node, *data);
+            // mix the audio
+            bool mixHasAudio = mixStreams(*data);
+
+            // send audio packet
+            if (mixHasAudio || data->shouldFlushEncoder()) {
+                QByteArray encodedBuffer;
+                if (mixHasAudio) {
+                    // encode the audio
+                    QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+                    data->encode(decodedBuffer, encodedBuffer);
+                } else {
+                    // time to flush (resets shouldFlush until the next encode)
+                    data->encodeFrameOfZeros(encodedBuffer);
+                }
+
+                sendMixPacket(node, *data, encodedBuffer);
+            } else {
+                ++stats.sumListenersSilent;
+                sendSilentPacket(node, *data);
+            }
         }
 
         // send environment packet
@@ -306,12 +346,11 @@ float approximateVolume(const MixableStream& stream, const AvatarAudioStream* li
     return stream.positionalStream->getLastPopOutputTrailingLoudness() * gain;
 };
 
-bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
+void AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     AvatarAudioStream* listenerAudioStream = static_cast<AudioMixerClientData*>(listener->getLinkedData())->getAvatarAudioStream();
     AudioMixerClientData* listenerData = static_cast<AudioMixerClientData*>(listener->getLinkedData());
 
-    // zero out the mix for this listener
-    memset(_mixSamples, 0, sizeof(_mixSamples));
+    _streamsToMix.clear();
 
     bool isThrottling = _numToRetain != -1;
     bool isSoloing = !listenerData->getSoloedNodes().empty();
@@ -472,21 +511,56 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     auto mixTime = std::chrono::duration_cast<std::chrono::nanoseconds>(mixEnd - mixStart);
     stats.mixTime += mixTime.count();
 #endif
+}
 
-    // check for silent audio before limiting
-    // limiting uses a dither and can only guarantee abs(sample) <= 1
-    bool hasAudio = false;
+// check for silent audio before limiting
+// limiting uses a dither and can only guarantee abs(sample) <= 1
+static bool hasAudio(const float* mixSamples) {
     for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; ++i) {
-        if (_mixSamples[i] != 0.0f) {
-            hasAudio = true;
-            break;
+        if (mixSamples[i] != 0.0f) {
+            return true;
         }
     }
+    return false;
+}
+
+bool AudioMixerSlave::mixStreams(AudioMixerClientData& listenerData) {
+    // zero out the mix for this listener
+    memset(_mixSamples, 0, sizeof(_mixSamples));
+
+    for (const auto& stream : _streamsToMix) {
+        mixStream(stream, *stream.hrtf, stream.azimuth, stream.distance, stream.gain);
+    }
+
+    bool mixHasAudio = hasAudio(_mixSamples);
 
     // use the per listener AudioLimiter to render the mixed data
-    listenerData->audioLimiter.render(_mixSamples, _bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    listenerData.audioLimiter.render(_mixSamples, _bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+    return mixHasAudio;
+}
+
+void AudioMixerSlave::mixSharedStreams(AudioSharedMixes::Mix& sharedMix) {
+    // zero out the mix for this group
+    memset(_mixSamples, 0, sizeof(_mixSamples));
+
+    // join() sorted _streamsToMix into the group's order
+    for (size_t i = 0; i < _streamsToMix.size(); ++i) {
+        const auto& parameters = sharedMix.parameters[i];
+        mixStream(_streamsToMix[i], sharedMix.getHRTF(i), parameters.azimuth, parameters.distance, parameters.gain);
+    }
+
+    bool mixHasAudio = hasAudio(_mixSamples);
 
-    return hasAudio;
+    // use the group's AudioLimiter to render the mixed data
+    sharedMix.getLimiter().render(_mixSamples, _bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+    if (mixHasAudio) {
+        QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+        sharedMix.encode(decodedBuffer);
+    } else {
+        sharedMix.encodeSilence();
+    }
 }
 
 void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStream,
@@ -494,8 +568,6 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
                                 float masterAvatarGain,
                                 float masterInjectorGain,
                                 bool isSoloing) {
-    ++stats.totalMixes;
-
     auto streamToAdd = mixableStream.positionalStream;
 
     // check if this is a server echo of a source back to itself
@@ -510,7 +582,8 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
                                                    relativePosition, distance));
     float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
 
-    const int HRTF_DATASET_INDEX = 1;
+    StreamToMix::Type type = streamToAdd->isStereo() ? StreamToMix::Stereo
+                                                     : (isEcho ? StreamToMix::Echo : StreamToMix::HRTF);
 
     if (!streamToAdd->lastPopSucceeded()) {
         bool forceSilentBlock = true;
@@ -534,44 +607,79 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
         if (forceSilentBlock) {
             // call renderSilent with a forced silent block to reduce artifacts
             // (this is not done for stereo streams since they do not go through the HRTF)
-            if (!streamToAdd->isStereo() && !isEcho) {
-                static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
-                mixableStream.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
-                ++stats.hrtfRenders;
+            if (type != StreamToMix::HRTF) {
+                return;
             }
-
-            return;
+            type = StreamToMix::SilentHRTF;
         }
     }
 
+    _streamsToMix.push_back({ mixableStream.nodeStreamID, streamToAdd, mixableStream.hrtf.get(), type,
+                              azimuth, distance, gain });
+}
+
+void AudioMixerSlave::mixStream(const StreamToMix& stream, AudioHRTF& hrtf, float azimuth, float distance, float gain) {
+    ++stats.totalMixes;
+
+    const int HRTF_DATASET_INDEX = 1;
+
+    if (stream.type == StreamToMix::SilentHRTF) {
+        static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
+        hrtf.render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
+                    AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+        ++stats.hrtfRenders;
+        return;
+    }
+
     // grab the stream from the ring buffer
-    AudioRingBuffer::ConstIterator streamPopOutput = streamToAdd->getLastPopOutput();
+    AudioRingBuffer::ConstIterator streamPopOutput = stream.positionalStream->getLastPopOutput();
 
-    if (streamToAdd->isStereo()) {
+    if (stream.type == StreamToMix::Stereo) {
 
         streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
 
         // stereo sources are not passed through HRTF
-        mixableStream.hrtf->mixStereo(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        hrtf.mixStereo(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualStereoMixes;
-    } else if (isEcho) {
+    } else if (stream.type == StreamToMix::Echo) {
 
         streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         // echo sources are not passed through HRTF
-        mixableStream.hrtf->mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        hrtf.mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualEchoMixes;
     } else {
 
         streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
-        mixableStream.hrtf->render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-        ++stats.hrtfRenders;
+        if (_sharedData.hrtfCache.isEnabled()) {
+            // the shared HRTF has no gain adjustment of its own, apply this listener's for the source up front
+            float adjustedGain = gain * hrtf.getGainAdjustment() / HRTF_GAIN;
+
+            bool wasShared = false;
+            const float* rendered = _sharedData.hrtfCache.render(stream.nodeStreamID, _bufferSamples,
+                                                                 azimuth, distance, adjustedGain, wasShared);
+            for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; ++i) {
+                _mixSamples[i] += rendered[i];
+            }
+
+            // keep the HRTF following along, so it picks up smoothly if the cache is turned off
+            hrtf.setParameterHistory(azimuth, distance, gain);
+
+            if (wasShared) {
+                ++stats.hrtfCacheHits;
+            } else {
+                ++stats.hrtfCacheMisses;
+                ++stats.hrtfRenders;
+            }
+        } else {
+            hrtf.render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
+                        AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            ++stats.hrtfRenders;
+        }
     }
 }
 
@@ -22,8 +22,10 @@
 #include <NodeList.h>
 #include <PositionalAudioStream.h>
 
+#include "AudioHRTFCache.h"
 #include "AudioMixerClientData.h"
 #include "AudioMixerStats.h"
+#include "AudioSharedMixes.h"
 
 class AvatarAudioStream;
 class AudioHRTF;
@@ -36,6 +38,8 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioHRTFCache hrtfCache;
+        AudioSharedMixes sharedMixes;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -43,6 +47,9 @@ public:
     // process packets for a given node (requires no configuration)
     void processPackets(const SharedNodePointer& node);
 
+    // decode the audio packets queued for a given stream, and pop a frame from it (requires no configuration)
+    void decodeStream(AudioMixerClientData::StreamDecode& streamDecode);
+
     // configure a round of mixing
     void configureMix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain);
 
@@ -53,8 +60,13 @@ public:
     AudioMixerStats stats;
 
 private:
-    // create mix, returns true if mix has audio
-    bool prepareMix(const SharedNodePointer& listener);
+    // work out which streams the listener hears and how, into _streamsToMix
+    void prepareMix(const SharedNodePointer& listener);
+    // create mix through the listener's own HRTFs and limiter, returns true if mix has audio
+    bool mixStreams(AudioMixerClientData& listenerData);
+    // create mix through the group's HRTFs and limiter, and encode it for every listener in the group
+    void mixSharedStreams(AudioSharedMixes::Mix& sharedMix);
+    void mixStream(const StreamToMix& stream, AudioHRTF& hrtf, float azimuth, float distance, float gain);
     void addStream(AudioMixerClientData::MixableStream& mixableStream,
                    AvatarAudioStream& listeningNodeStream,
                    float masterAvatarGain,
@@ -71,6 +83,7 @@ private:
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    std::vector<StreamToMix> _streamsToMix;
 
     // frame state
     ConstIter _begin;
@@ -18,12 +18,25 @@ void AudioMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
+        auto frameStart = p_high_resolution_clock::now();
+
+        // iterate over all available nodes (or streams)
+        uint32_t index;
+        while (try_pop(index)) {
+            if (_streamFunction) {
+                (this->*_streamFunction)(*_pool._frameStreams[index]);
+                continue;
+            }
+
+            const SharedNodePointer& node = _pool._frameNodes[index];
+            auto nodeStart = p_high_resolution_clock::now();
             (this->*_function)(node);
+            auto nodeCost = std::chrono::duration_cast<std::chrono::nanoseconds>(p_high_resolution_clock::now() - nodeStart);
+            _nodeCosts.emplace_back(node->getLocalID(), nodeCost.count());
         }
 
+        _frameBusyTime = std::chrono::duration_cast<std::chrono::nanoseconds>(p_high_resolution_clock::now() - frameStart).count();
+
         bool stopping = _stop;
         notify(stopping);
         if (stopping) {
@@ -46,6 +59,7 @@ void AudioMixerSlaveThread::wait() {
         _pool._configure(*this);
     }
     _function = _pool._function;
+    _streamFunction = _pool._streamFunction;
 }
 
 void AudioMixerSlaveThread::notify(bool stopping) {
@@ -60,18 +74,75 @@ void AudioMixerSlaveThread::notify(bool stopping) {
     _pool._poolCondition.notify_one();
 }
 
-bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
-    return _pool._queue.try_pop(node);
+bool AudioMixerSlaveThread::try_pop(uint32_t& index) {
+    if (popFront(index)) {
+        return true;
+    }
+
+    // out of our own work - steal from the other slaves, starting with our neighbour
+    int numThreads = (int)_pool._slaves.size();
+    for (int i = 1; i < numThreads; ++i) {
+        auto& victim = _pool._slaves[(_index + i) % numThreads];
+        if (victim->stealBack(index)) {
+            ++_numStolen;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static const uint64_t RANGE_BACK_MASK = 0xFFFFFFFF;
+
+bool AudioMixerSlaveThread::popFront(uint32_t& index) {
+    uint64_t range = _range.load();
+    while (true) {
+        uint64_t front = range >> 32;
+        uint64_t back = range & RANGE_BACK_MASK;
+        if (front >= back) {
+            return false;
+        }
+
+        if (_range.compare_exchange_weak(range, ((front + 1) << 32) | back)) {
+            index = (uint32_t)front;
+            return true;
+        }
+    }
+}
+
+bool AudioMixerSlaveThread::stealBack(uint32_t& index) {
+    uint64_t range = _range.load();
+    while (true) {
+        uint64_t front = range >> 32;
+        uint64_t back = range & RANGE_BACK_MASK;
+        if (front >= back) {
+            return false;
+        }
+
+        if (_range.compare_exchange_weak(range, (front << 32) | (back - 1))) {
+            index = (uint32_t)(back - 1);
+            return true;
+        }
+    }
 }
 
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
     _function = &AudioMixerSlave::processPackets;
+    _streamFunction = nullptr;
+    _configure = [](AudioMixerSlave& slave) {};
+    run(begin, end);
+}
+
+void AudioMixerSlavePool::decodeStreams(ConstIter begin, ConstIter end) {
+    _function = nullptr;
+    _streamFunction = &AudioMixerSlave::decodeStream;
     _configure = [](AudioMixerSlave& slave) {};
     run(begin, end);
 }
 
 void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain) {
     _function = &AudioMixerSlave::mix;
+    _streamFunction = nullptr;
     _configure = [=](AudioMixerSlave& slave) {
         slave.configureMix(_begin, _end, frame, numToRetain);
     };
@@ -83,10 +154,14 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
-    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
-    });
+    // fill the slave deques
+    if (_streamFunction) {
+        scheduleStreams();
+    } else {
+        scheduleNodes();
+    }
+
+    auto frameStart = p_high_resolution_clock::now();
 
     {
         Lock lock(_mutex);
@@ -104,7 +179,110 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
         assert(_numStarted == _numThreads);
     }
 
-    assert(_queue.empty());
+    collectFrameStats(p_high_resolution_clock::now() - frameStart);
+}
+
+std::unordered_map<Node::LocalID, uint64_t>* AudioMixerSlavePool::getLastCosts() {
+    // packet processing is cheap and even, only mixing is worth scheduling by cost
+    // (decoding is scheduled by the packets queued for each stream, see scheduleStreams)
+    if (_function == &AudioMixerSlave::mix) {
+        return &_lastMixCosts;
+    }
+    return nullptr;
+}
+
+void AudioMixerSlavePool::scheduleNodes() {
+    auto lastCosts = getLastCosts();
+
+    std::vector<std::pair<uint64_t, SharedNodePointer>> nodes;
+    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+        uint64_t lastCost = 0;
+        if (lastCosts) {
+            auto cost = lastCosts->find(node->getLocalID());
+            lastCost = cost != lastCosts->end() ? cost->second : 0;
+        }
+        nodes.emplace_back(lastCost, node);
+    });
+
+    if (lastCosts) {
+        // heaviest nodes first, so they start early and what is left to steal at the end is cheap
+        std::stable_sort(nodes.begin(), nodes.end(), [](const std::pair<uint64_t, SharedNodePointer>& a,
+                                                        const std::pair<uint64_t, SharedNodePointer>& b) {
+            return a.first > b.first;
+        });
+    }
+
+    deal(nodes, _frameNodes);
+}
+
+void AudioMixerSlavePool::scheduleStreams() {
+    // a stream's decode cost is its queued packets, and every stream pops a frame even with none
+    std::vector<std::pair<uint64_t, AudioMixerClientData::StreamDecode*>> streams;
+    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
+        if (data) {
+            for (auto& streamDecode : data->getStreamDecodes()) {
+                streams.emplace_back(streamDecode.packets.size(), &streamDecode);
+            }
+        }
+    });
+
+    std::stable_sort(streams.begin(), streams.end(), [](const std::pair<uint64_t, AudioMixerClientData::StreamDecode*>& a,
+                                                        const std::pair<uint64_t, AudioMixerClientData::StreamDecode*>& b) {
+        return a.first > b.first;
+    });
+
+    deal(streams, _frameStreams);
+}
+
+template <typename T>
+void AudioMixerSlavePool::deal(std::vector<std::pair<uint64_t, T>>& items, std::vector<T>& frameItems) {
+    // deal the items out round-robin, each slave's share is a contiguous run of frameItems
+    frameItems.clear();
+    frameItems.reserve(items.size());
+
+    int numThreads = (int)_slaves.size();
+    for (int i = 0; i < numThreads; ++i) {
+        uint64_t front = frameItems.size();
+        for (size_t j = i; j < items.size(); j += numThreads) {
+            frameItems.push_back(std::move(items[j].second));
+        }
+        uint64_t back = frameItems.size();
+
+        // the pool mutex taken to start the frame publishes this to the slaves
+        _slaves[i]->_range.store((front << 32) | back, std::memory_order_relaxed);
+    }
+}
+
+void AudioMixerSlavePool::collectFrameStats(p_high_resolution_clock::duration frameTime) {
+    auto frameNanoseconds = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(frameTime).count();
+    auto lastCosts = getLastCosts();
+
+    if (lastCosts) {
+        // only keep costs for nodes run this frame, so nodes that have gone don't linger
+        lastCosts->clear();
+    }
+
+    for (auto& slave : _slaves) {
+        assert((slave->_range.load() >> 32) >= (slave->_range.load() & RANGE_BACK_MASK));
+
+        if (lastCosts) {
+            for (auto& nodeCost : slave->_nodeCosts) {
+                (*lastCosts)[nodeCost.first] = nodeCost.second;
+            }
+        }
+        slave->_nodeCosts.clear();
+
+        slave->_busyTime += slave->_frameBusyTime;
+        slave->_idleTime += frameNanoseconds - std::min(frameNanoseconds, slave->_frameBusyTime);
+        slave->_frameBusyTime = 0;
+    }
+
+    // don't hold on to the nodes between frames
+    _frameNodes.clear();
+    _frameStreams.clear();
+
+    ++_numFramesRun;
 }
 
 void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> functor) {
@@ -113,18 +291,30 @@ void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> funct
     }
 }
 
-#ifdef DEBUG_EVENT_QUEUE
 void AudioMixerSlavePool::queueStats(QJsonObject& stats) {
     unsigned i = 0;
     for (auto& slave : _slaves) {
+#ifdef DEBUG_EVENT_QUEUE
         int queueSize = ::hifi::qt::getEventQueueSize(slave.get());
         QString queueName = QString("audio_thread_event_queue_%1").arg(i);
         stats[queueName] = queueSize;
+#endif // DEBUG_EVENT_QUEUE
+
+        // the pool runs three times a frame (packets, decode, then mix), so these are per pool run
+        float numFramesRun = (float)std::max(_numFramesRun, 1);
+        stats[QString("audio_thread_%1_busy_us_per_run").arg(i)] = (float)slave->_busyTime / 1000.0f / numFramesRun;
+        stats[QString("audio_thread_%1_idle_us_per_run").arg(i)] = (float)slave->_idleTime / 1000.0f / numFramesRun;
+        stats[QString("audio_thread_%1_stolen_per_run").arg(i)] = (float)slave->_numStolen / numFramesRun;
+
+        slave->_busyTime = 0;
+        slave->_idleTime = 0;
+        slave->_numStolen = 0;
 
         i++;
     }
+
+    _numFramesRun = 0;
 }
-#endif // DEBUG_EVENT_QUEUE
 
 void AudioMixerSlavePool::setNumThreads(int numThreads) {
     // clamp to allowed size
@@ -157,6 +347,7 @@ void AudioMixerSlavePool::resize(int numThreads) {
         // start new slaves
         for (int i = 0; i < numThreads - _numThreads; ++i) {
             auto slave = new AudioMixerSlaveThread(*this, _workerSharedData);
+            slave->_index = (int)_slaves.size();
             slave->start();
             _slaves.emplace_back(slave);
         }
@@ -12,13 +12,16 @@
 #ifndef hifi_AudioMixerSlavePool_h
 #define hifi_AudioMixerSlavePool_h
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include <QJsonObject>
 #include <QThread>
 #include <shared/QtHelpers.h>
-#include <TBBHelpers.h>
+#include <PortableHighResolutionClock.h>
 
 #include "AudioMixerSlave.h"
 
@@ -41,17 +44,34 @@ private:
 
     void wait();
     void notify(bool stopping);
-    bool try_pop(SharedNodePointer& node);
+    bool try_pop(uint32_t& index);
+
+    // this slave's deque is a range of the pool's frame nodes (or streams), packed as (front << 32 | back) so that
+    // the owner popping the front and thieves stealing the back agree with a single compare-and-swap
+    bool popFront(uint32_t& index);
+    bool stealBack(uint32_t& index);
 
     AudioMixerSlavePool& _pool;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
+    void (AudioMixerSlave::*_streamFunction)(AudioMixerClientData::StreamDecode& streamDecode) { nullptr };
     bool _stop { false };
+    int _index { 0 };
+    std::atomic<uint64_t> _range { 0 };
+
+    // frame stats, written by this slave while it runs and read by the pool between frames
+    std::vector<std::pair<Node::LocalID, uint64_t>> _nodeCosts; // nanoseconds spent on each node this frame
+    uint64_t _frameBusyTime { 0 };
+    uint64_t _busyTime { 0 }; // nanoseconds, since the last queueStats
+    uint64_t _idleTime { 0 }; // nanoseconds, since the last queueStats
+    int _numStolen { 0 }; // nodes (or streams) taken from other slaves, since the last queueStats
 };
 
 // Slave pool for audio mixers
 //   AudioMixerSlavePool is not thread-safe! It should be instantiated and used from a single thread.
+//   Each run the nodes are dealt out to per-slave deques, heaviest last-frame mix cost first, and a slave that
+//   runs out of work steals the lightest remaining nodes from the others. Decoding is dealt out the same way
+//   stream by stream, most queued packets first, so one node's many injectors don't end up on a single slave.
 class AudioMixerSlavePool {
-    using Queue = tbb::concurrent_queue<SharedNodePointer>;
     using Mutex = std::mutex;
     using Lock = std::unique_lock<Mutex>;
     using ConditionVariable = std::condition_variable;
@@ -66,15 +86,17 @@ public:
     // process packets on slave threads
     void processPackets(ConstIter begin, ConstIter end);
 
+    // decode the audio packets that were processed, stream by stream on slave threads
+    void decodeStreams(ConstIter begin, ConstIter end);
+
     // mix on slave threads
     void mix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain);
 
     // iterate over all slaves
     void each(std::function<void(AudioMixerSlave& slave)> functor);
 
-#ifdef DEBUG_EVENT_QUEUE
+    // per-slave busy/idle time and steals since the last call (and event queue sizes with DEBUG_EVENT_QUEUE)
     void queueStats(QJsonObject& stats);
-#endif
 
     void setNumThreads(int numThreads);
     int numThreads() { return _numThreads; }
@@ -82,18 +104,27 @@ public:
 private:
     void run(ConstIter begin, ConstIter end);
     void resize(int numThreads);
+    void scheduleNodes();
+    void scheduleStreams();
+    template <typename T>
+    void deal(std::vector<std::pair<uint64_t, T>>& items, std::vector<T>& frameItems);
+    std::unordered_map<Node::LocalID, uint64_t>* getLastCosts();
+    void collectFrameStats(p_high_resolution_clock::duration frameTime);
 
     std::vector<std::unique_ptr<AudioMixerSlaveThread>> _slaves;
 
     friend void AudioMixerSlaveThread::wait();
     friend void AudioMixerSlaveThread::notify(bool stopping);
-    friend bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node);
+    friend bool AudioMixerSlaveThread::try_pop(uint32_t& index);
+    friend bool AudioMixerSlaveThread::popFront(uint32_t& index);
+    friend bool AudioMixerSlaveThread::stealBack(uint32_t& index);
 
     // synchronization state
     Mutex _mutex;
     ConditionVariable _slaveCondition;
     ConditionVariable _poolCondition;
-    void (AudioMixerSlave::*_function)(const SharedNodePointer& node);
+    void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
+    void (AudioMixerSlave::*_streamFunction)(AudioMixerClientData::StreamDecode& streamDecode) { nullptr };
     std::function<void(AudioMixerSlave&)> _configure;
     int _numThreads { 0 };
     int _numStarted { 0 }; // guarded by _mutex
@@ -101,10 +132,14 @@ private:
     int _numStopped { 0 }; // guarded by _mutex
 
     // frame state
-    Queue _queue;
+    std::vector<SharedNodePointer> _frameNodes; // grouped by the slave they were dealt to
+    std::vector<AudioMixerClientData::StreamDecode*> _frameStreams; // likewise, when decoding
     ConstIter _begin;
     ConstIter _end;
 
+    std::unordered_map<Node::LocalID, uint64_t> _lastMixCosts; // nanoseconds, from the last mix frame
+    int _numFramesRun { 0 }; // since the last queueStats
+
     AudioMixerSlave::SharedData& _workerSharedData;
 };
 
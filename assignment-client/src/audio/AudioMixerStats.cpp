@@ -13,6 +13,7 @@
 
 void AudioMixerStats::reset() {
     sumStreams = 0;
+    decodedPackets = 0;
     sumListeners = 0;
     sumListenersSilent = 0;
 
@@ -22,6 +23,12 @@ void AudioMixerStats::reset() {
     hrtfResets = 0;
     hrtfUpdates = 0;
 
+    hrtfCacheHits = 0;
+    hrtfCacheMisses = 0;
+
+    sharedMixes = 0;
+    sharedMixListeners = 0;
+
     manualStereoMixes = 0;
     manualEchoMixes = 0;
 
@@ -43,6 +50,7 @@ void AudioMixerStats::reset() {
 
 void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     sumStreams += otherStats.sumStreams;
+    decodedPackets += otherStats.decodedPackets;
     sumListeners += otherStats.sumListeners;
     sumListenersSilent += otherStats.sumListenersSilent;
 
@@ -52,6 +60,12 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     hrtfResets += otherStats.hrtfResets;
     hrtfUpdates += otherStats.hrtfUpdates;
 
+    hrtfCacheHits += otherStats.hrtfCacheHits;
+    hrtfCacheMisses += otherStats.hrtfCacheMisses;
+
+    sharedMixes += otherStats.sharedMixes;
+    sharedMixListeners += otherStats.sharedMixListeners;
+
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
 
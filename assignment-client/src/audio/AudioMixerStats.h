@@ -18,6 +18,7 @@
 
 struct AudioMixerStats {
     int sumStreams { 0 };
+    int decodedPackets { 0 };
     int sumListeners { 0 };
     int sumListenersSilent { 0 };
 
@@ -27,6 +28,12 @@ struct AudioMixerStats {
     int hrtfResets { 0 };
     int hrtfUpdates { 0 };
 
+    int hrtfCacheHits { 0 };
+    int hrtfCacheMisses { 0 };
+
+    int sharedMixes { 0 };
+    int sharedMixListeners { 0 };
+
     int manualStereoMixes { 0 };
     int manualEchoMixes { 0 };
 
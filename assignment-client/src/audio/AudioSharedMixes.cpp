@@ -0,0 +1,160 @@
+//
+//  AudioSharedMixes.cpp
+//  assignment-client/src/audio
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSharedMixes.h"
+
+#include <algorithm>
+
+#include <AudioConstants.h>
+
+const float AudioSharedMixes::DEFAULT_MAX_AZIMUTH_ERROR_DEGREES = 5.0f;
+const float AudioSharedMixes::DEFAULT_MAX_GAIN_ERROR_DB = 1.0f;
+
+// about a tenth of a second, long enough that sources drifting across a bucket edge don't flap listeners between
+// their own mix and the group's
+const int AudioSharedMixes::MIN_SHARED_FRAMES = 10;
+
+AudioSharedMixes::Mix::State::State(const CodecPluginPointer& codec, size_t numStreams) :
+    limiter(AudioConstants::SAMPLE_RATE, AudioConstants::STEREO),
+    codec(codec)
+{
+    hrtfs.reserve(numStreams);
+    for (size_t i = 0; i < numStreams; ++i) {
+        hrtfs.emplace_back(new AudioHRTF);
+    }
+
+    if (codec) {
+        encoder = codec->createEncoder(AudioConstants::SAMPLE_RATE, AudioConstants::STEREO);
+    }
+}
+
+AudioSharedMixes::Mix::State::~State() {
+    if (codec && encoder) {
+        codec->releaseEncoder(encoder);
+    }
+}
+
+AudioSharedMixes::Mix::Mix(const CodecPluginPointer& codec, std::vector<Parameters> bucketParameters) :
+    parameters(std::move(bucketParameters)),
+    _codec(codec)
+{
+}
+
+void AudioSharedMixes::Mix::setShared(bool shared) {
+    if (shared && !_state) {
+        _state.reset(new State(_codec, parameters.size()));
+    } else if (!shared && _state) {
+        _state.reset();
+        encodedBuffer.clear();
+    }
+}
+
+void AudioSharedMixes::Mix::encode(const QByteArray& decodedBuffer) {
+    if (_state->encoder) {
+        _state->encoder->encode(decodedBuffer, encodedBuffer);
+    } else {
+        encodedBuffer = decodedBuffer;
+    }
+    // once you have encoded, you need to flush eventually.
+    _state->shouldFlushEncoder = true;
+}
+
+void AudioSharedMixes::Mix::encodeSilence() {
+    static QByteArray zeros(AudioConstants::NETWORK_FRAME_BYTES_STEREO, 0);
+    if (!_state->shouldFlushEncoder) {
+        encodedBuffer.clear();
+    } else if (_state->encoder) {
+        _state->encoder->encode(zeros, encodedBuffer);
+    } else {
+        encodedBuffer = zeros;
+    }
+    _state->shouldFlushEncoder = false;
+}
+
+size_t AudioSharedMixes::KeyHasher::operator()(const Key& key) const {
+    size_t hash = qHash(key.codecName);
+    for (const auto& stream : key.streams) {
+        hash = hash * 31 + (qHash(stream.streamID) ^ (size_t(stream.sourceID) << 16));
+        hash = stream.bucket.hash(hash * 31 + size_t(stream.type));
+    }
+    return hash;
+}
+
+void AudioSharedMixes::setErrorBounds(float maxAzimuthErrorDegrees, float maxGainErrorDB) {
+    _quantizer.setErrorBounds(maxAzimuthErrorDegrees, maxGainErrorDB);
+
+    // groups from the old steps would now be wrong
+    clear();
+}
+
+void AudioSharedMixes::beginFrame() {
+    _mixes.beginFrame([](Mix& mix) {
+        mix.numListenersLastFrame = mix.numListeners.exchange(0);
+        mix.numSharedFrames = mix.numListenersLastFrame > 1 ? mix.numSharedFrames + 1 : 0;
+        mix.setShared(mix.numSharedFrames >= MIN_SHARED_FRAMES);
+    });
+}
+
+AudioSharedMixes::Mix* AudioSharedMixes::join(const QString& codecName, const CodecPluginPointer& codec,
+                                              std::vector<StreamToMix>& streams) {
+    // every listener that hears the same streams has to list them in the same order
+    std::sort(streams.begin(), streams.end(), [](const StreamToMix& a, const StreamToMix& b) {
+        if (a.nodeStreamID.nodeLocalID != b.nodeStreamID.nodeLocalID) {
+            return a.nodeStreamID.nodeLocalID < b.nodeStreamID.nodeLocalID;
+        }
+        return a.nodeStreamID.streamID < b.nodeStreamID.streamID;
+    });
+
+    Key key;
+    key.codecName = codecName;
+    key.streams.reserve(streams.size());
+    for (const auto& stream : streams) {
+        // the shared HRTFs have no gain adjustment of their own, so the listener's has to match too
+        float gain = stream.gain * stream.hrtf->getGainAdjustment() / HRTF_GAIN;
+
+        KeyStream keyStream;
+        keyStream.sourceID = stream.nodeStreamID.nodeLocalID;
+        keyStream.streamID = stream.nodeStreamID.streamID;
+        keyStream.type = stream.type;
+
+        // stereo and echo streams don't go through the HRTF, only their gain matters
+        bool isSpatialized = stream.type == StreamToMix::HRTF || stream.type == StreamToMix::SilentHRTF;
+        if (isSpatialized) {
+            keyStream.bucket = _quantizer.quantize(stream.azimuth, stream.distance, gain);
+        } else {
+            keyStream.bucket.gain = _quantizer.quantizeGain(gain);
+        }
+
+        key.streams.push_back(keyStream);
+    }
+
+    Mix& mix = _mixes.findOrCreate(std::move(key), [this, &codec](const Key& newKey) {
+        return new Mix(codec, getBucketParameters(newKey));
+    });
+    ++mix.numListeners;
+
+    // only beginFrame() starts or stops sharing a group
+    return mix.isShared() ? &mix : nullptr;
+}
+
+std::vector<AudioSharedMixes::Mix::Parameters> AudioSharedMixes::getBucketParameters(const Key& key) const {
+    // mix at the bucket centres, so every listener in the group is within the error bounds of what they'd hear
+    std::vector<Mix::Parameters> parameters;
+    parameters.reserve(key.streams.size());
+    for (const auto& stream : key.streams) {
+        Mix::Parameters bucketParameters;
+        bucketParameters.azimuth = _quantizer.getAzimuth(stream.bucket);
+        bucketParameters.distance = _quantizer.getDistance(stream.bucket);
+        bucketParameters.gain = _quantizer.getGain(stream.bucket);
+        parameters.push_back(bucketParameters);
+    }
+    return parameters;
+}
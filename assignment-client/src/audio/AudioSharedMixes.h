@@ -0,0 +1,167 @@
+//
+//  AudioSharedMixes.h
+//  assignment-client/src/audio
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSharedMixes_h
+#define hifi_AudioSharedMixes_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+
+#include <AudioHRTF.h>
+#include <AudioLimiter.h>
+#include <PositionalAudioStream.h>
+#include <plugins/CodecPlugin.h>
+
+#include "AudioBuckets.h"
+
+// a stream a listener hears this frame, and how it hears it
+struct StreamToMix {
+    enum Type {
+        HRTF,
+        SilentHRTF, // flushes the HRTF with a silent block
+        Stereo,
+        Echo
+    };
+
+    NodeIDStreamID nodeStreamID;
+    PositionalAudioStream* positionalStream;
+    AudioHRTF* hrtf; // the listener's own HRTF for the stream
+    Type type;
+    float azimuth;
+    float distance;
+    float gain;
+};
+
+// Shares one mix, and one encode of it, between the listeners that hear the same thing.
+//   Two listeners hear the same thing when they are sent the same codec and mix the same streams, the same way, at
+//   an azimuth and gain for each that is within the configured error bounds. The first listener in a group to be mixed
+//   in a frame mixes, limits and encodes it with the group's own HRTFs, limiter and encoder, and every listener in the
+//   group sends that encoded buffer on with its own sequence number.
+//   Moving a listener onto a group's encoder and HRTFs (or back onto its own) restarts the stream its client decodes,
+//   which can click, and groups come and go as sources cross buckets. So a group is only shared once it has had more
+//   than one listener for MIN_SHARED_FRAMES frames in a row, and only a shared group builds its HRTFs, limiter and
+//   encoder; every other group is just the key and a listener count.
+//   join() is thread-safe, beginFrame() and the setters must be called while no slaves are mixing.
+class AudioSharedMixes {
+public:
+    static const float DEFAULT_MAX_AZIMUTH_ERROR_DEGREES;
+    static const float DEFAULT_MAX_GAIN_ERROR_DB;
+    static const int MIN_SHARED_FRAMES;
+
+    class Mix {
+    public:
+        struct Parameters {
+            float azimuth;
+            float distance;
+            float gain; // already includes the listeners' gain adjustment for the source
+        };
+
+        Mix(const CodecPluginPointer& codec, std::vector<Parameters> bucketParameters);
+
+        bool isShared() const { return (bool)_state; }
+
+        // only valid while the group is shared
+        AudioHRTF& getHRTF(size_t index) { return *_state->hrtfs[index]; }
+        AudioLimiter& getLimiter() { return _state->limiter; }
+
+        // encodes the limited mix, or flushes the encoder once the mix goes silent (leaving encodedBuffer empty after)
+        void encode(const QByteArray& decodedBuffer);
+        void encodeSilence();
+
+        std::mutex mutex;
+        unsigned int mixedFrame { 0 };
+
+        // what to mix each stream at, in the order join() sorted the streams
+        const std::vector<Parameters> parameters;
+
+        QByteArray encodedBuffer; // empty when the group hears silence this frame
+
+        std::atomic<unsigned int> usedFrame { 0 };
+        std::atomic<int> numListeners { 0 };
+        int numListenersLastFrame { 0 };
+        int numSharedFrames { 0 }; // frames in a row that had more than one listener
+
+    private:
+        friend class AudioSharedMixes;
+
+        // what a group needs to mix and encode, built when it starts being shared and dropped when it stops
+        struct State {
+            State(const CodecPluginPointer& codec, size_t numStreams);
+            ~State();
+
+            std::vector<std::unique_ptr<AudioHRTF>> hrtfs;
+            AudioLimiter limiter;
+            CodecPluginPointer codec;
+            Encoder* encoder { nullptr };
+            bool shouldFlushEncoder { false };
+        };
+
+        void setShared(bool shared);
+
+        CodecPluginPointer _codec;
+        std::unique_ptr<State> _state;
+    };
+
+    AudioSharedMixes() : _quantizer(DEFAULT_MAX_AZIMUTH_ERROR_DEGREES, DEFAULT_MAX_GAIN_ERROR_DB) {}
+
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+    bool isEnabled() const { return _isEnabled; }
+
+    // the largest difference between the azimuth/gain a listener gets and what it would get from its own mix
+    void setErrorBounds(float maxAzimuthErrorDegrees, float maxGainErrorDB);
+
+    // drops groups that no listener joined in the last frame, and starts or stops sharing the others
+    void beginFrame();
+
+    // puts the listener in the group that hears the same streams, sorting them into the group's order
+    // returns the group's mix if it is shared this frame, or null if the listener should mix on its own
+    Mix* join(const QString& codecName, const CodecPluginPointer& codec, std::vector<StreamToMix>& streams);
+
+    void clear() { _mixes.clear(); }
+
+private:
+    struct KeyStream {
+        Node::LocalID sourceID;
+        StreamID streamID;
+        StreamToMix::Type type;
+        AudioBucket bucket;
+
+        bool operator==(const KeyStream& other) const {
+            return sourceID == other.sourceID && streamID == other.streamID && type == other.type
+                && bucket == other.bucket;
+        }
+    };
+
+    struct Key {
+        QString codecName;
+        std::vector<KeyStream> streams;
+
+        bool operator==(const Key& other) const {
+            return codecName == other.codecName && streams == other.streams;
+        }
+    };
+
+    struct KeyHasher {
+        size_t operator()(const Key& key) const;
+    };
+
+    std::vector<Mix::Parameters> getBucketParameters(const Key& key) const;
+
+    bool _isEnabled { false };
+    AudioBucketQuantizer _quantizer;
+    AudioBucketMap<Key, Mix, KeyHasher> _mixes;
+};
+
+#endif // hifi_AudioSharedMixes_h
@@ -0,0 +1,100 @@
+//
+//  AvatarEncodeCache.cpp
+//  assignment-client/src/avatars
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarEncodeCache.h"
+
+#include <cstring>
+
+size_t AvatarEncodeCache::KeyHasher::operator()(const Key& key) const {
+    uint32_t minRotationDOTBits;
+    memcpy(&minRotationDOTBits, &key.minRotationDOT, sizeof(minRotationDOTBits));
+
+    size_t hash = std::hash<uint64_t>()(key.baseline) ^ (size_t(key.avatarID) << 8);
+    hash = hash * 31 + size_t(key.detail);
+    hash = hash * 31 + size_t(minRotationDOTBits);
+    return hash;
+}
+
+void AvatarEncodeCache::beginFrame() {
+    ++_frame;
+    clear();
+}
+
+void AvatarEncodeCache::clear() {
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.encodings.clear();
+    }
+}
+
+bool AvatarEncodeCache::isFullUpdateFrame(Node::LocalID avatarID) const {
+    // splitmix64 of (frame, avatar), so every avatar gets its own spread of full update frames
+    uint64_t mix = (_frame << 16) ^ avatarID;
+    mix += 0x9e3779b97f4a7c15ULL;
+    mix = (mix ^ (mix >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    mix = (mix ^ (mix >> 27)) * 0x94d049bb133111ebULL;
+    mix ^= mix >> 31;
+
+    float sample = float(mix >> 40) / float(1 << 24);
+    return sample < AVATAR_SEND_FULL_UPDATE_RATIO;
+}
+
+AvatarEncodeCache::Key AvatarEncodeCache::makeKey(Node::LocalID avatarID, AvatarData::AvatarDataDetail detail,
+                                                  Baseline listenerBaseline, float minRotationDOT) const {
+    Key key;
+    key.avatarID = avatarID;
+    key.detail = detail;
+
+    // everything in SendAllData is sent regardless of what the listener already has
+    key.baseline = detail == AvatarData::SendAllData ? NO_BASELINE : listenerBaseline;
+
+    // only CullSmallData uses the viewer distance based tolerance
+    key.minRotationDOT = detail == AvatarData::CullSmallData ? minRotationDOT : 0.0f;
+    return key;
+}
+
+bool AvatarEncodeCache::isShareable(const Key& key) const {
+    if (!_isEnabled || key.detail == AvatarData::NoData) {
+        return false;
+    }
+    return key.detail == AvatarData::SendAllData || key.baseline != NO_BASELINE;
+}
+
+bool AvatarEncodeCache::find(const Key& key, Encoding& encoding) const {
+    const auto& shard = shardFor(key.avatarID);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.encodings.find(key);
+    if (it == shard.encodings.end()) {
+        return false;
+    }
+
+    encoding = it->second;
+    return true;
+}
+
+AvatarEncodeCache::Baseline AvatarEncodeCache::insert(const Key& key, const QByteArray& bytes,
+                                                      const QVector<JointData>& sentJoints) {
+    auto& shard = shardFor(key.avatarID);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.encodings.find(key);
+    if (it != shard.encodings.end()) {
+        return it->second.baseline;
+    }
+
+    Encoding encoding;
+    encoding.bytes = bytes;
+    encoding.sentJoints = sentJoints;
+    encoding.baseline = _nextBaseline++;
+    shard.encodings.emplace(key, encoding);
+    return encoding.baseline;
+}
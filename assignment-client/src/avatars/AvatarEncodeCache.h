@@ -0,0 +1,98 @@
+//
+//  AvatarEncodeCache.h
+//  assignment-client/src/avatars
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarEncodeCache_h
+#define hifi_AvatarEncodeCache_h
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+#include <AvatarData.h>
+#include <Node.h>
+
+// Per-frame cache of AvatarData::toByteArray results, shared by every listener the avatar is sent to.
+//   What toByteArray writes depends on the detail level, and for the delta-encoded parts on when the listener was
+//   last sent the avatar and which joints it was last sent. That last part is tracked as a baseline: every cached
+//   encode gets a new baseline id, and each listener remembers the id of the encode it was last sent of each avatar.
+//   Listeners holding the same baseline were sent the same data in the same frame, so the same detail encodes to the
+//   same bytes for all of them. SendAllData does not depend on the baseline at all and is shared by everyone.
+//   find() and insert() are thread-safe, beginFrame() and setEnabled() must be called while no slaves are broadcasting.
+class AvatarEncodeCache {
+public:
+    using Baseline = uint64_t;
+    static const Baseline NO_BASELINE = 0;
+
+    struct Key {
+        Node::LocalID avatarID { 0 };
+        AvatarData::AvatarDataDetail detail { AvatarData::NoData };
+        Baseline baseline { NO_BASELINE };
+        float minRotationDOT { 0.0f }; // joint rotation tolerance, which CullSmallData scales with viewer distance
+
+        bool operator==(const Key& other) const {
+            return avatarID == other.avatarID && detail == other.detail && baseline == other.baseline
+                && minRotationDOT == other.minRotationDOT;
+        }
+    };
+
+    struct Encoding {
+        QByteArray bytes;
+        QVector<JointData> sentJoints; // what the listener's last sent joints become once it is sent the bytes
+        Baseline baseline { NO_BASELINE };
+    };
+
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+    bool isEnabled() const { return _isEnabled; }
+
+    void beginFrame();
+
+    // whether listeners sending this avatar in view should get SendAllData this frame - decided once per avatar,
+    // rather than per listener, so that all of its listeners pick up the same baseline together
+    bool isFullUpdateFrame(Node::LocalID avatarID) const;
+
+    Key makeKey(Node::LocalID avatarID, AvatarData::AvatarDataDetail detail, Baseline listenerBaseline,
+                float minRotationDOT) const;
+    bool isShareable(const Key& key) const;
+
+    bool find(const Key& key, Encoding& encoding) const;
+
+    // stores a complete (not split) encode, returns the baseline the listener that made it now holds
+    // if another listener got there first, the stored encode wins and its baseline is returned
+    Baseline insert(const Key& key, const QByteArray& bytes, const QVector<JointData>& sentJoints);
+
+    void clear();
+
+private:
+    struct KeyHasher {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, Encoding, KeyHasher> encodings;
+    };
+    static const int NUM_SHARDS = 16;
+
+    Shard& shardFor(Node::LocalID avatarID) { return _shards[avatarID % NUM_SHARDS]; }
+    const Shard& shardFor(Node::LocalID avatarID) const { return _shards[avatarID % NUM_SHARDS]; }
+
+    bool _isEnabled { true };
+    uint64_t _frame { 0 };
+    std::atomic<Baseline> _nextBaseline { NO_BASELINE + 1 };
+
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+#endif // hifi_AvatarEncodeCache_h
@@ -838,6 +838,10 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["sent_5_averageTraitsBytes"] = TIGHT_LOOP_STAT(aggregateStats.numTraitsBytesSent);
     slavesAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     slavesAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
+    float averageOthersSkippedBySpatialGrid = averageNodes ? aggregateStats.numOthersSkippedBySpatialGrid / averageNodes : 0.0f;
+    slavesAggregatObject["sent_8_averageOthersSkippedBySpatialGrid"] = TIGHT_LOOP_STAT(averageOthersSkippedBySpatialGrid);
+    slavesAggregatObject["sent_9_encodes"] = TIGHT_LOOP_STAT(aggregateStats.numEncodes);
+    slavesAggregatObject["sent_10_encodesSaved"] = TIGHT_LOOP_STAT(aggregateStats.numEncodesSaved);
 
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
@@ -875,6 +879,12 @@ void AvatarMixer::sendStatsPacket() {
         avatarStats[NODE_OUTBOUND_KBPS_STAT_KEY] = outboundAvatarDataKbps;
         avatarStats[NODE_INBOUND_KBPS_STAT_KEY] = node->getInboundKbps();
 
+        // packets that went out in batched writes, and how many send syscalls that saved
+        auto& connectionStats = node->getConnectionStats();
+        avatarStats["outbound_batched_packets"] = (double)connectionStats.sentBatchedPackets;
+        avatarStats["outbound_batch_syscalls_saved"] =
+            (double)connectionStats.sentBatchedPackets - (double)connectionStats.sentBatchSyscalls;
+
         AvatarMixerClientData* clientData = static_cast<AvatarMixerClientData*>(node->getLinkedData());
         if (clientData) {
             MutexTryLocker lock(clientData->getMutex());
@@ -1029,6 +1039,42 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    {   // Share avatar data encodes between the listeners that get the same bytes:
+        static const QString ENCODE_CACHE_KEY = "encode_cache";
+        bool encodeCacheEnabled = avatarMixerGroupObject[ENCODE_CACHE_KEY].toBool(true);
+        _slaveSharedData.encodeCache.setEnabled(encodeCacheEnabled);
+        qCDebug(avatars) << "Avatar mixer shared encode cache" << (encodeCacheEnabled ? "enabled" : "disabled");
+    }
+
+    {   // Per-frame spatial grid used to narrow down which avatars each listener considers:
+        static const QString SPATIAL_GRID_KEY = "spatial_grid";
+        static const QString SPATIAL_GRID_MIN_AVATARS_KEY = "spatial_grid_min_avatars";
+        static const QString SPATIAL_GRID_NEAR_RADIUS_KEY = "spatial_grid_near_radius";
+        static const QString SPATIAL_GRID_FAR_BUDGET_KEY = "spatial_grid_far_budget";
+
+        bool spatialGridEnabled = avatarMixerGroupObject[SPATIAL_GRID_KEY].toBool(false);
+        _slavePool.setSpatialGridEnabled(spatialGridEnabled);
+
+        bool ok;
+        int minAvatars = avatarMixerGroupObject[SPATIAL_GRID_MIN_AVATARS_KEY].toString().toInt(&ok);
+        _slavePool.setSpatialGridMinAvatars(ok ? std::max(0, minAvatars) : AvatarSpatialGrid::DEFAULT_MIN_AVATARS);
+
+        auto& grid = _slavePool.getSpatialGrid();
+        float nearRadius = avatarMixerGroupObject[SPATIAL_GRID_NEAR_RADIUS_KEY].toString().toFloat(&ok);
+        grid.setNearRadius(ok ? std::max(0.0f, nearRadius) : AvatarSpatialGrid::DEFAULT_NEAR_RADIUS);
+        grid.setCellSize(std::max(grid.getNearRadius() / 2.0f, 1.0f));
+
+        int farBudget = avatarMixerGroupObject[SPATIAL_GRID_FAR_BUDGET_KEY].toString().toInt(&ok);
+        grid.setFarBudget(ok ? std::max(0, farBudget) : AvatarSpatialGrid::DEFAULT_FAR_BUDGET);
+
+        if (spatialGridEnabled) {
+            qCDebug(avatars) << "Avatar mixer spatial grid enabled from" << _slavePool.getSpatialGridMinAvatars() << "avatars, near radius"
+                << grid.getNearRadius() << "far budget" << grid.getFarBudget();
+        } else {
+            qCDebug(avatars) << "Avatar mixer spatial grid disabled";
+        }
+    }
+
     const QString AVATARS_SETTINGS_KEY = "avatars";
 
     static const QString MIN_HEIGHT_OPTION = "min_avatar_height";
@@ -45,6 +45,18 @@ void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID other
     }
 }
 
+uint64_t AvatarMixerClientData::getLastOtherAvatarEncodeBaseline(NLPacket::LocalID otherAvatar) const {
+    const auto itr = _lastOtherAvatarEncodeBaseline.find(otherAvatar);
+    if (itr != _lastOtherAvatarEncodeBaseline.end()) {
+        return itr->second;
+    }
+    return 0;
+}
+
+void AvatarMixerClientData::setLastOtherAvatarEncodeBaseline(NLPacket::LocalID otherAvatar, uint64_t baseline) {
+    _lastOtherAvatarEncodeBaseline[otherAvatar] = baseline;
+}
+
 void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
     if (!_packetQueue.node) {
         _packetQueue.node = node;
@@ -508,6 +520,7 @@ AvatarMixerClientData::TraitsCheckTimestamp AvatarMixerClientData::getLastOtherA
 void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLocalID) {
     removeLastBroadcastSequenceNumber(nodeLocalID);
     removeLastBroadcastTime(nodeLocalID);
+    _lastOtherAvatarEncodeBaseline.erase(nodeLocalID);
     _lastSentTraitsTimestamps.erase(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
@@ -104,6 +104,7 @@ public:
     bool isRadiusIgnoring(const QUuid& other) const;
     void addToRadiusIgnoringSet(const QUuid& other);
     void removeFromRadiusIgnoringSet(const QUuid& other);
+    const std::vector<QUuid>& getRadiusIgnoredOthers() const { return _radiusIgnoredOthers; }
     void ignoreOther(SharedNodePointer self, SharedNodePointer other);
     void ignoreOther(const Node* self, const Node* other);
 
@@ -121,11 +122,18 @@ public:
     bool getPrevRequestsDomainListData() { return _prevRequestsDomainListData; }
     void setPrevRequestsDomainListData(bool requesting) { _prevRequestsDomainListData = requesting; }
 
+    size_t getSpatialGridCursor() const { return _spatialGridCursor; }
+    void setSpatialGridCursor(size_t cursor) { _spatialGridCursor = cursor; }
+
     const ConicalViewFrustums& getViewFrustums() const { return _currentViewFrustums; }
 
     uint64_t getLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar) const;
     void setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time);
 
+    // id of the shared encode (see AvatarEncodeCache) this node was last sent of the other avatar
+    uint64_t getLastOtherAvatarEncodeBaseline(NLPacket::LocalID otherAvatar) const;
+    void setLastOtherAvatarEncodeBaseline(NLPacket::LocalID otherAvatar, uint64_t baseline);
+
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
@@ -173,6 +181,7 @@ private:
     // this is a map of the last time we encoded an "other" avatar for
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
+    std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeBaseline;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
 
     uint64_t _identityChangeTimestamp;
@@ -196,6 +205,7 @@ private:
     QString _baseDisplayName{}; // The santized key used in determinging unique sessionDisplayName, so that we can remove from dictionary.
     bool _requestsDomainListData { false };
     bool _prevRequestsDomainListData{ false };
+    size_t _spatialGridCursor { 0 }; // where this listener's share of far avatars from the spatial grid continues
 
     AvatarTraits::TraitVersions _lastReceivedTraitVersions;
     TraitsCheckTimestamp _lastReceivedTraitsChange;
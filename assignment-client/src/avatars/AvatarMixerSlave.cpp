@@ -33,6 +33,7 @@
 
 #include "AvatarMixer.h"
 #include "AvatarMixerClientData.h"
+#include "AvatarSpatialGrid.h"
 
 namespace chrono = std::chrono;
 
@@ -44,13 +45,14 @@ void AvatarMixerSlave::configure(ConstIter begin, ConstIter end) {
 void AvatarMixerSlave::configureBroadcast(ConstIter begin, ConstIter end, 
                                 p_high_resolution_clock::time_point lastFrameTimestamp,
                                 float maxKbpsPerNode, float throttlingRatio,
-                                float priorityReservedFraction) {
+                                float priorityReservedFraction, const AvatarSpatialGrid* avatarGrid) {
     _begin = begin;
     _end = end;
     _lastFrameTimestamp = lastFrameTimestamp;
     _maxKbpsPerNode = maxKbpsPerNode;
     _throttlingRatio = throttlingRatio;
     _avatarHeroFraction = priorityReservedFraction;
+    _avatarGrid = avatarGrid;
 }
 
 void AvatarMixerSlave::harvestStats(AvatarMixerSlaveStats& stats) {
@@ -384,10 +386,36 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge}
     };
 
-    avatarPriorityQueues[kNonhero].reserve(_end - _begin);
+    // With the spatial grid, only avatars that are near, could be in view, heroes, or this frame's share of the
+    // far ones are considered - everything in view still sorts exactly as it would against the full list.
+    // A PAL that is (or just stopped being) open needs every avatar, so those listeners still look at all of them.
+    if (_avatarGrid && !PALIsOpen && !PALWasOpen) {
+        size_t farCursor = destinationNodeData->getSpatialGridCursor();
+        _stats.numOthersSkippedBySpatialGrid += _avatarGrid->selectCandidates(destinationPosition, destinationNodeBox,
+            cameraViews, farCursor, _selectedGridCells, _candidateNodes);
+        destinationNodeData->setSpatialGridCursor(farCursor);
+
+        // Every avatar whose bubble could touch ours is a candidate, so one that was left out has moved out of range.
+        // Stop radius ignoring it now, as the loop below would have, so that it is killed again if it comes back.
+        auto radiusIgnoredOthers = destinationNodeData->getRadiusIgnoredOthers();
+        for (const auto& otherID : radiusIgnoredOthers) {
+            int cell = -1;
+            const Node* otherNode = _avatarGrid->findAvatar(otherID, cell);
+            if (otherNode && !_selectedGridCells[cell] && !destinationNode->isIgnoringNodeWithID(otherID)
+                && !otherNode->isIgnoringNodeWithID(destinationNode->getUUID())) {
+                destinationNodeData->removeFromRadiusIgnoringSet(otherID);
+            }
+        }
+    } else {
+        _candidateNodes.clear();
+        std::for_each(_begin, _end, [&](const SharedNodePointer& listedNode) {
+            _candidateNodes.push_back(listedNode.data());
+        });
+    }
+
+    avatarPriorityQueues[kNonhero].reserve(_candidateNodes.size());
 
-    for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
-        Node* otherNodeRaw = (*listedNode).data();
+    for (const Node* otherNodeRaw : _candidateNodes) {
         if (otherNodeRaw->getType() != NodeType::Agent
             || !otherNodeRaw->getLinkedData()
             || otherNodeRaw == destinationNode) {
@@ -500,11 +528,16 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
     auto avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
     const int avatarPacketCapacity = avatarPacket->getPayloadCapacity();
+
+    // full bulk avatar packets are held here and handed to the NodeList as one burst once this listener is done
+    std::vector<std::unique_ptr<NLPacket>> avatarPackets;
     int avatarSpaceAvailable = avatarPacketCapacity;
     int numPacketsSent = 0;
     int numAvatarsSent = 0;
     auto identityPacketList = NLPacketList::create(PacketType::AvatarIdentity, QByteArray(), true, true);
 
+    auto& encodeCache = _sharedData->encodeCache;
+
     // Loop over two priorities - hero avatars then everyone else:
     for (PriorityVariants currentVariant = kHero; currentVariant <= kNonhero; ++((int&)currentVariant)) {
         const auto& sortedAvatarVector = avatarPriorityQueues[currentVariant].getSortedVector(numToSendEst);
@@ -548,7 +581,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 detail = PALIsOpen ? AvatarData::PALMinimum : AvatarData::MinimumData;
                 destinationNodeData->incrementAvatarOutOfView();
             } else if (!overBudget) {
-                detail = distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO ? AvatarData::SendAllData : AvatarData::CullSmallData;
+                bool sendAllData = encodeCache.isEnabled() ? encodeCache.isFullUpdateFrame(sourceNode->getLocalID())
+                    : distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO;
+                detail = sendAllData ? AvatarData::SendAllData : AvatarData::CullSmallData;
                 destinationNodeData->incrementAvatarInView();
 
                 // If the time that the mixer sent AVATAR DATA about Avatar B to Node A is BEFORE OR EQUAL TO
@@ -569,26 +604,60 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarDataPacket::SendStatus sendStatus;
             sendStatus.sendUUID = true;
 
-            do {
-                auto startSerialize = chrono::high_resolution_clock::now();
-                QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
-                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
-                auto endSerialize = chrono::high_resolution_clock::now();
-                _stats.toByteArrayElapsedTime +=
-                    (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
-
-                avatarPacket->write(bytes);
-                avatarSpaceAvailable -= bytes.size();
-                numAvatarDataBytes += bytes.size();
-                if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
-                    // Weren't able to fit everything.
-                    nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+            // listeners holding the same baseline of this avatar get the same bytes for the same detail,
+            // so the first of them to be sent it this frame encodes it and the rest copy that encode
+            auto encodeKey = encodeCache.makeKey(sourceNode->getLocalID(), detail,
+                destinationNodeData->getLastOtherAvatarEncodeBaseline(sourceNode->getLocalID()),
+                sourceAvatar->getDistanceBasedMinRotationDOT(destinationPosition));
+            bool isShareable = encodeCache.isShareable(encodeKey);
+            AvatarEncodeCache::Baseline encodeBaseline = AvatarEncodeCache::NO_BASELINE;
+
+            AvatarEncodeCache::Encoding sharedEncoding;
+            if (isShareable && encodeCache.find(encodeKey, sharedEncoding)
+                && sharedEncoding.bytes.size() <= avatarSpaceAvailable) {
+                avatarPacket->write(sharedEncoding.bytes);
+                avatarSpaceAvailable -= sharedEncoding.bytes.size();
+                numAvatarDataBytes += sharedEncoding.bytes.size();
+                lastSentJointsForOther = sharedEncoding.sentJoints;
+                encodeBaseline = sharedEncoding.baseline;
+                _stats.numEncodesSaved++;
+
+                if (avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                    avatarPackets.push_back(std::move(avatarPacket));
                     ++numPacketsSent;
                     avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
                     avatarSpaceAvailable = avatarPacketCapacity;
                 }
-            } while (!sendStatus);
+            } else {
+                bool isFirstPart = true;
+                do {
+                    auto startSerialize = chrono::high_resolution_clock::now();
+                    QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
+                        sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
+                        &lastSentJointsForOther, avatarSpaceAvailable);
+                    auto endSerialize = chrono::high_resolution_clock::now();
+                    _stats.toByteArrayElapsedTime +=
+                        (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
+                    _stats.numEncodes++;
+
+                    if (isShareable && isFirstPart && sendStatus) {
+                        // it all fit in one go, so it is exactly what any other listener with this key would get
+                        encodeBaseline = encodeCache.insert(encodeKey, bytes, lastSentJointsForOther);
+                    }
+                    isFirstPart = false;
+
+                    avatarPacket->write(bytes);
+                    avatarSpaceAvailable -= bytes.size();
+                    numAvatarDataBytes += bytes.size();
+                    if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                        // Weren't able to fit everything.
+                        avatarPackets.push_back(std::move(avatarPacket));
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    }
+                } while (!sendStatus);
+            }
 
             if (detail != AvatarData::NoData) {
                 _stats.numOthersIncluded++;
@@ -603,6 +672,7 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 destinationNodeData->setLastBroadcastSequenceNumber(sourceNode->getLocalID(),
                     sourceNodeData->getLastReceivedSequenceNumber());
                 destinationNodeData->setLastOtherAvatarEncodeTime(sourceNode->getLocalID(), usecTimestampNow());
+                destinationNodeData->setLastOtherAvatarEncodeBaseline(sourceNode->getLocalID(), encodeBaseline);
             }
 
             auto endAvatarDataPacking = chrono::high_resolution_clock::now();
@@ -632,10 +702,12 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     quint64 startPacketSending = usecTimestampNow();
 
     if (avatarPacket->getPayloadSize() != 0) {
-        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+        avatarPackets.push_back(std::move(avatarPacket));
         ++numPacketsSent;
     }
 
+    nodeList->sendUnreliablePackets(std::move(avatarPackets), *destinationNode);
+
     _stats.numDataPacketsSent += numPacketsSent;
     _stats.numDataBytesSent += numAvatarDataBytes;
 
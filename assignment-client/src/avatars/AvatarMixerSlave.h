@@ -14,7 +14,10 @@
 
 #include <NodeList.h>
 
+#include "AvatarEncodeCache.h"
+
 class AvatarMixerClientData;
+class AvatarSpatialGrid;
 
 class AvatarMixerSlaveStats {
 public:
@@ -33,6 +36,9 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numOthersSkippedBySpatialGrid { 0 };
+    int numEncodes { 0 };
+    int numEncodesSaved { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
@@ -59,6 +65,9 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numOthersSkippedBySpatialGrid = 0;
+        numEncodes = 0;
+        numEncodesSaved = 0;
 
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
@@ -83,6 +92,9 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numOthersSkippedBySpatialGrid += rhs.numOthersSkippedBySpatialGrid;
+        numEncodes += rhs.numEncodes;
+        numEncodesSaved += rhs.numEncodesSaved;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
@@ -100,6 +112,7 @@ struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    AvatarEncodeCache encodeCache;
 };
 
 class AvatarMixerSlave {
@@ -111,7 +124,7 @@ public:
     void configureBroadcast(ConstIter begin, ConstIter end, 
                     p_high_resolution_clock::time_point lastFrameTimestamp, 
                     float maxKbpsPerNode, float throttlingRatio,
-                    float priorityReservedFraction);
+                    float priorityReservedFraction, const AvatarSpatialGrid* avatarGrid);
 
     void processIncomingPackets(const SharedNodePointer& node);
     void broadcastAvatarData(const SharedNodePointer& node);
@@ -143,6 +156,11 @@ private:
     float _throttlingRatio { 0.0f };
     float _avatarHeroFraction { 0.4f };
 
+    // null when every listener should consider every other avatar this frame
+    const AvatarSpatialGrid* _avatarGrid { nullptr };
+    std::vector<bool> _selectedGridCells;
+    std::vector<const Node*> _candidateNodes;
+
     AvatarMixerSlaveStats _stats;
     SlaveSharedData* _sharedData;
 };
@@ -74,10 +74,22 @@ void AvatarMixerSlavePool::processIncomingPackets(ConstIter begin, ConstIter end
 void AvatarMixerSlavePool::broadcastAvatarData(ConstIter begin, ConstIter end, 
                                                p_high_resolution_clock::time_point lastFrameTimestamp,
                                                float maxKbpsPerNode, float throttlingRatio) {
+    // build the spatial grid once for the frame, the slaves only read it
+    const AvatarSpatialGrid* avatarGrid = nullptr;
+    if (_isSpatialGridEnabled && (end - begin) >= _spatialGridMinAvatars) {
+        _avatarGrid.rebuild(begin, end);
+        avatarGrid = &_avatarGrid;
+    } else {
+        _avatarGrid.clear();
+    }
+
+    // encodes are only shared within a frame
+    _slaveSharedData->encodeCache.beginFrame();
+
     _function = &AvatarMixerSlave::broadcastAvatarData;
     _configure = [=](AvatarMixerSlave& slave) { 
         slave.configureBroadcast(begin, end, lastFrameTimestamp, maxKbpsPerNode, throttlingRatio,
-            _priorityReservedFraction);
+            _priorityReservedFraction, avatarGrid);
    };
     run(begin, end);
 }
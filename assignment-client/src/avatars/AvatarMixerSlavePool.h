@@ -23,6 +23,7 @@
 #include <shared/QtHelpers.h>
 
 #include "AvatarMixerSlave.h"
+#include "AvatarSpatialGrid.h"
 
 
 class AvatarMixerSlavePool;
@@ -84,6 +85,12 @@ public:
     void setPriorityReservedFraction(float fraction) { _priorityReservedFraction = fraction; }
     float getPriorityReservedFraction() const { return  _priorityReservedFraction; }
 
+    void setSpatialGridEnabled(bool enabled) { _isSpatialGridEnabled = enabled; }
+    bool isSpatialGridEnabled() const { return _isSpatialGridEnabled; }
+    void setSpatialGridMinAvatars(int minAvatars) { _spatialGridMinAvatars = minAvatars; }
+    int getSpatialGridMinAvatars() const { return _spatialGridMinAvatars; }
+    AvatarSpatialGrid& getSpatialGrid() { return _avatarGrid; }
+
 private:
     void run(ConstIter begin, ConstIter end);
     void resize(int numThreads);
@@ -104,6 +111,8 @@ private:
     // Set from Domain Settings:
     float _priorityReservedFraction { 0.4f };
     int _numThreads { 0 };
+    bool _isSpatialGridEnabled { true };
+    int _spatialGridMinAvatars { AvatarSpatialGrid::DEFAULT_MIN_AVATARS };
 
     int _numStarted { 0 }; // guarded by _mutex
     int _numFinished { 0 }; // guarded by _mutex
@@ -113,6 +122,7 @@ private:
     Queue _queue;
     ConstIter _begin;
     ConstIter _end;
+    AvatarSpatialGrid _avatarGrid;
 
     SlaveSharedData* _slaveSharedData;
 };
@@ -0,0 +1,289 @@
+//
+//  AvatarSpatialGrid.cpp
+//  assignment-client/src/avatars
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarSpatialGrid.h"
+
+#include <algorithm>
+
+#include "AvatarMixerClientData.h"
+
+const float AvatarSpatialGrid::DEFAULT_CELL_SIZE = 16.0f;
+const float AvatarSpatialGrid::DEFAULT_NEAR_RADIUS = 32.0f;
+const int AvatarSpatialGrid::DEFAULT_FAR_BUDGET = 32;
+const int AvatarSpatialGrid::DEFAULT_MIN_AVATARS = 100;
+
+const int AvatarSpatialGrid::BLOCK_SIZE = 8;
+
+namespace {
+    // 21 bits per axis, which at the default cell size covers far more than any domain
+    const int CELL_COORDINATE_BITS = 21;
+    const int64_t CELL_COORDINATE_OFFSET = 1LL << (CELL_COORDINATE_BITS - 1);
+    const int64_t CELL_COORDINATE_MASK = (1LL << CELL_COORDINATE_BITS) - 1;
+
+    // same radius that SortableAvatar in AvatarMixerSlave.cpp hands to the priority sort
+    float sortRadiusFor(const MixerAvatar* avatar) {
+        const float MIN_RADIUS = 0.1f;
+        glm::vec3 nodeBoxScale = avatar->getGlobalBoundingBox().getScale();
+        return glm::max(0.5f * glm::max(nodeBoxScale.x, glm::max(nodeBoxScale.y, nodeBoxScale.z)), MIN_RADIUS);
+    }
+
+    // rounds towards negative infinity, so that blocks are the same size on both sides of the origin
+    glm::ivec3 blockCoordinatesFor(const glm::ivec3& cellCoordinates, int blockSize) {
+        glm::ivec3 coordinates;
+        for (int i = 0; i < 3; ++i) {
+            int cell = cellCoordinates[i];
+            coordinates[i] = cell >= 0 ? cell / blockSize : -((blockSize - 1 - cell) / blockSize);
+        }
+        return coordinates;
+    }
+
+    // how far the box reaches past the cube of side size at coordinates
+    float overhangOf(const AABox& box, const glm::ivec3& coordinates, float size) {
+        if (box.isInvalid()) {
+            return 0.0f;
+        }
+        glm::vec3 cubeMinimum = glm::vec3(coordinates) * size;
+        glm::vec3 below = cubeMinimum - box.getMinimumPoint();
+        glm::vec3 above = box.getMaximumPoint() - (cubeMinimum + glm::vec3(size));
+        glm::vec3 overhang = glm::max(below, above);
+        return glm::max(0.0f, glm::max(overhang.x, glm::max(overhang.y, overhang.z)));
+    }
+}
+
+AvatarSpatialGrid::Coordinates AvatarSpatialGrid::cellCoordinatesFor(const glm::vec3& position) const {
+    glm::vec3 cellPosition = glm::floor(position / _cellSize);
+    return Coordinates(glm::clamp(cellPosition, glm::vec3((float)-CELL_COORDINATE_OFFSET),
+                                  glm::vec3((float)(CELL_COORDINATE_OFFSET - 1))));
+}
+
+int64_t AvatarSpatialGrid::keyFor(const Coordinates& coordinates) {
+    int64_t key = 0;
+    for (int i = 0; i < 3; ++i) {
+        key = (key << CELL_COORDINATE_BITS) | ((coordinates[i] + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK);
+    }
+    return key;
+}
+
+void AvatarSpatialGrid::clear() {
+    _entries.clear();
+    _cells.clear();
+    _blocks.clear();
+    _heroes.clear();
+    _cellIndices.clear();
+    _blockIndices.clear();
+    _entriesByNodeID.clear();
+    _maxCellOverhang = 0.0f;
+}
+
+void AvatarSpatialGrid::rebuild(ConstIter begin, ConstIter end) {
+    clear();
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        if (node->getType() != NodeType::Agent || !node->getLinkedData()) {
+            return;
+        }
+
+        auto nodeData = reinterpret_cast<const AvatarMixerClientData*>(node->getLinkedData());
+        const MixerAvatar* avatar = nodeData->getConstAvatarData();
+
+        if (avatar->getHasPriority()) {
+            // heroes are few and always considered, they don't need a cell
+            _heroes.push_back(node.data());
+        } else {
+            auto coordinates = cellCoordinatesFor(avatar->getClientGlobalPosition());
+            _entries.push_back({ node.data(), coordinates, keyFor(coordinates), -1 });
+        }
+    });
+
+    std::sort(_entries.begin(), _entries.end(), [](const Entry& left, const Entry& right) {
+        if (left.cellKey != right.cellKey) {
+            return left.cellKey < right.cellKey;
+        }
+        return left.node->getLocalID() < right.node->getLocalID();
+    });
+
+    for (int i = 0; i < (int)_entries.size(); ++i) {
+        auto& entry = _entries[i];
+        if (_cells.empty() || _entries[_cells.back().firstEntry].cellKey != entry.cellKey) {
+            _cells.emplace_back();
+            _cells.back().coordinates = entry.coordinates;
+            _cells.back().firstEntry = i;
+            _cellIndices[entry.cellKey] = (int)_cells.size() - 1;
+        }
+
+        auto& cell = _cells.back();
+        cell.endEntry = i + 1;
+        entry.cell = (int)_cells.size() - 1;
+        _entriesByNodeID[entry.node->getUUID()] = i;
+
+        auto nodeData = reinterpret_cast<const AvatarMixerClientData*>(entry.node->getLinkedData());
+        const MixerAvatar* avatar = nodeData->getConstAvatarData();
+
+        float radius = sortRadiusFor(avatar);
+        glm::vec3 position = avatar->getClientGlobalPosition();
+        cell.avatarBounds += AABox(position - glm::vec3(radius), glm::vec3(2.0f * radius));
+        cell.bubbleBounds += avatar->getDefaultBubbleBox();
+    }
+
+    for (int i = 0; i < (int)_cells.size(); ++i) {
+        const auto& cell = _cells[i];
+
+        if (i == 0) {
+            _minCoordinates = cell.coordinates;
+            _maxCoordinates = cell.coordinates;
+        } else {
+            _minCoordinates = glm::min(_minCoordinates, cell.coordinates);
+            _maxCoordinates = glm::max(_maxCoordinates, cell.coordinates);
+        }
+
+        _maxCellOverhang = glm::max(_maxCellOverhang, glm::max(overhangOf(cell.avatarBounds, cell.coordinates, _cellSize),
+                                                               overhangOf(cell.bubbleBounds, cell.coordinates, _cellSize)));
+
+        int64_t blockKey = keyFor(blockCoordinatesFor(cell.coordinates, BLOCK_SIZE));
+        auto blockIndex = _blockIndices.find(blockKey);
+        if (blockIndex == _blockIndices.end()) {
+            blockIndex = _blockIndices.emplace(blockKey, (int)_blocks.size()).first;
+            _blocks.emplace_back();
+        }
+
+        auto& block = _blocks[blockIndex->second];
+        block.avatarBounds += cell.avatarBounds;
+        block.cells.push_back(i);
+    }
+}
+
+const Node* AvatarSpatialGrid::findAvatar(const QUuid& nodeID, int& cell) const {
+    auto entry = _entriesByNodeID.find(nodeID);
+    if (entry == _entriesByNodeID.end()) {
+        return nullptr;
+    }
+    cell = _entries[entry->second].cell;
+    return _entries[entry->second].node;
+}
+
+template <typename Visit>
+void AvatarSpatialGrid::forEachTouching(const AABox& box, int cellsPerSide, const Indices& indices, int numOccupied,
+                                        Visit visit) const {
+    if (numOccupied == 0) {
+        return;
+    }
+
+    // the bounds of a cell can reach past it, so widen the box by as much as any of them do,
+    // and there is nothing to find outside the occupied cells
+    glm::vec3 minimum = box.getMinimumPoint() - glm::vec3(_maxCellOverhang);
+    glm::vec3 maximum = box.getMaximumPoint() + glm::vec3(_maxCellOverhang);
+    Coordinates minCoordinates = glm::max(cellCoordinatesFor(minimum), _minCoordinates);
+    Coordinates maxCoordinates = glm::min(cellCoordinatesFor(maximum), _maxCoordinates);
+    if (cellsPerSide > 1) {
+        minCoordinates = blockCoordinatesFor(minCoordinates, cellsPerSide);
+        maxCoordinates = blockCoordinatesFor(maxCoordinates, cellsPerSide);
+    }
+
+    if (glm::any(glm::lessThan(maxCoordinates, minCoordinates))) {
+        return;
+    }
+
+    glm::vec3 range = glm::vec3(maxCoordinates - minCoordinates) + glm::vec3(1.0f);
+    if (range.x * range.y * range.z > (float)numOccupied) {
+        // a view reaching across the domain covers more of it than there are occupied cells
+        for (int i = 0; i < numOccupied; ++i) {
+            visit(i);
+        }
+        return;
+    }
+
+    Coordinates coordinates;
+    for (coordinates.x = minCoordinates.x; coordinates.x <= maxCoordinates.x; ++coordinates.x) {
+        for (coordinates.y = minCoordinates.y; coordinates.y <= maxCoordinates.y; ++coordinates.y) {
+            for (coordinates.z = minCoordinates.z; coordinates.z <= maxCoordinates.z; ++coordinates.z) {
+                auto index = indices.find(keyFor(coordinates));
+                if (index != indices.end()) {
+                    visit(index->second);
+                }
+            }
+        }
+    }
+}
+
+int AvatarSpatialGrid::selectCandidates(const glm::vec3& listenerPosition, const AABox& listenerBubbleBox,
+                                        const ConicalViewFrustums& views, size_t& farCursor,
+                                        std::vector<bool>& selectedCells, std::vector<const Node*>& candidates) const {
+    candidates.clear();
+    candidates.insert(candidates.end(), _heroes.begin(), _heroes.end());
+
+    selectedCells.assign(_cells.size(), false);
+
+    auto selectCell = [&](int cellIndex) {
+        if (!selectedCells[cellIndex]) {
+            selectedCells[cellIndex] = true;
+            const auto& cell = _cells[cellIndex];
+            for (int entry = cell.firstEntry; entry < cell.endEntry; ++entry) {
+                candidates.push_back(_entries[entry].node);
+            }
+        }
+    };
+
+    AABox nearBox(listenerPosition - glm::vec3(_nearRadius), glm::vec3(2.0f * _nearRadius));
+    forEachTouching(nearBox, 1, _cellIndices, (int)_cells.size(), [&](int cellIndex) {
+        if (_cells[cellIndex].avatarBounds.touchesSphere(listenerPosition, _nearRadius)) {
+            selectCell(cellIndex);
+        }
+    });
+
+    forEachTouching(listenerBubbleBox, 1, _cellIndices, (int)_cells.size(), [&](int cellIndex) {
+        if (_cells[cellIndex].bubbleBounds.touches(listenerBubbleBox)) {
+            selectCell(cellIndex);
+        }
+    });
+
+    for (const auto& view : views) {
+        float reach = glm::max(view.getFarClip(), view.getRadius());
+        AABox viewBox(view.getPosition() - glm::vec3(reach), glm::vec3(2.0f * reach));
+        forEachTouching(viewBox, BLOCK_SIZE, _blockIndices, (int)_blocks.size(), [&](int blockIndex) {
+            const auto& block = _blocks[blockIndex];
+            if (!view.intersects(block.avatarBounds)) {
+                return;
+            }
+            for (int cellIndex : block.cells) {
+                if (!selectedCells[cellIndex] && view.intersects(_cells[cellIndex].avatarBounds)) {
+                    selectCell(cellIndex);
+                }
+            }
+        });
+    }
+
+    int numSelected = (int)(candidates.size() - _heroes.size());
+    int numFar = (int)_entries.size() - numSelected;
+    int farBudget = std::min(_farBudget, numFar);
+
+    // round-robin through everything that was not selected, jumping over selected cells a whole cell at a time
+    int entry = _entries.empty() ? 0 : (int)(farCursor % _entries.size());
+    int numVisited = 0;
+    while (farBudget > 0 && numVisited < (int)_entries.size()) {
+        const auto& cell = _cells[_entries[entry].cell];
+        if (selectedCells[_entries[entry].cell]) {
+            numVisited += cell.endEntry - entry;
+            entry = cell.endEntry;
+        } else {
+            candidates.push_back(_entries[entry].node);
+            --farBudget;
+            ++numVisited;
+            ++entry;
+        }
+
+        if (entry == (int)_entries.size()) {
+            entry = 0;
+        }
+    }
+    farCursor = entry;
+
+    return (int)(_entries.size() + _heroes.size() - candidates.size());
+}
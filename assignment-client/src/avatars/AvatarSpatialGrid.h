@@ -0,0 +1,124 @@
+//
+//  AvatarSpatialGrid.h
+//  assignment-client/src/avatars
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarSpatialGrid_h
+#define hifi_AvatarSpatialGrid_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+#include <NodeList.h>
+#include <UUIDHasher.h>
+#include <shared/ConicalViewFrustum.h>
+
+// Uniform grid over the positions of every avatar in the mixer, rebuilt once per broadcast frame
+// so that each listener only has to look at the avatars that can matter to it instead of at every node.
+// Occupied cells are hashed by their coordinates, and grouped into coarser blocks for view frustums, so a listener
+// only visits the cells around it and the blocks its views reach rather than every cell.
+// Built on the mixer thread before the slaves start, then only read (concurrently) by the slaves.
+class AvatarSpatialGrid {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    static const float DEFAULT_CELL_SIZE;
+    static const float DEFAULT_NEAR_RADIUS;
+    static const int DEFAULT_FAR_BUDGET;
+    static const int DEFAULT_MIN_AVATARS;
+
+    void setCellSize(float cellSize) { _cellSize = cellSize; }
+    float getCellSize() const { return _cellSize; }
+
+    void setNearRadius(float nearRadius) { _nearRadius = nearRadius; }
+    float getNearRadius() const { return _nearRadius; }
+
+    void setFarBudget(int farBudget) { _farBudget = farBudget; }
+    int getFarBudget() const { return _farBudget; }
+
+    void rebuild(ConstIter begin, ConstIter end);
+    void clear();
+
+    int getNumAvatars() const { return (int)_entries.size() + (int)_heroes.size(); }
+    int getNumCells() const { return (int)_cells.size(); }
+
+    // Finds a (non-hero) avatar and the cell it is in this frame, returns null if it isn't in the grid
+    const Node* findAvatar(const QUuid& nodeID, int& cell) const;
+
+    // Collects the avatars a listener has to consider this frame:
+    //   - every hero avatar
+    //   - every avatar in a cell within the near radius of the listener, or whose bubble could touch its bubble box
+    //   - every avatar in a cell that could be inside one of the listener's view frustums
+    //   - up to the far budget of the remaining avatars, round-robin from farCursor (which is advanced)
+    // Cells are tested against the bounds of the avatars actually in them, so any avatar that would sort as
+    // in view by PrioritySortUtil is always a candidate. Returns the number of avatars left out.
+    int selectCandidates(const glm::vec3& listenerPosition, const AABox& listenerBubbleBox,
+                         const ConicalViewFrustums& views, size_t& farCursor,
+                         std::vector<bool>& selectedCells, std::vector<const Node*>& candidates) const;
+
+private:
+    using Coordinates = glm::ivec3;
+    using Indices = std::unordered_map<int64_t, int>;
+
+    struct Entry {
+        const Node* node;
+        Coordinates coordinates;
+        int64_t cellKey;
+        int cell;
+    };
+
+    struct Cell {
+        AABox avatarBounds; // encloses the sort sphere of each avatar in the cell
+        AABox bubbleBounds; // encloses the default bubble box of each avatar in the cell
+        Coordinates coordinates;
+        int firstEntry { 0 };
+        int endEntry { 0 };
+    };
+
+    // BLOCK_SIZE cells a side
+    struct Block {
+        AABox avatarBounds;
+        std::vector<int> cells;
+    };
+    static const int BLOCK_SIZE;
+
+    Coordinates cellCoordinatesFor(const glm::vec3& position) const;
+    static int64_t keyFor(const Coordinates& coordinates);
+
+    // calls visit with the index of every occupied cell (or block) that could touch the box - either by looking up
+    // each cell in range, or by going through all the occupied ones if there are fewer of those
+    template <typename Visit>
+    void forEachTouching(const AABox& box, int cellsPerSide, const Indices& indices, int numOccupied,
+                         Visit visit) const;
+
+    float _cellSize { DEFAULT_CELL_SIZE };
+    float _nearRadius { DEFAULT_NEAR_RADIUS };
+    int _farBudget { DEFAULT_FAR_BUDGET };
+
+    // entries are grouped by cell so that each cell owns a contiguous range of them,
+    // and ordered the same way frame to frame so that far cursors keep walking through everyone
+    std::vector<Entry> _entries;
+    std::vector<Cell> _cells;
+    std::vector<Block> _blocks;
+    std::vector<const Node*> _heroes;
+
+    Indices _cellIndices;
+    Indices _blockIndices;
+    std::unordered_map<QUuid, int, UUIDHasher> _entriesByNodeID;
+
+    // the range of occupied cells, and how far past its own cell the bounds of any cell reach
+    Coordinates _minCoordinates;
+    Coordinates _maxCoordinates;
+    float _maxCellOverhang { 0.0f };
+};
+
+#endif // hifi_AvatarSpatialGrid_h
@@ -48,6 +48,9 @@ public:
     const QUuid& getScreenshareZone() const { return _screenshareZone; }
     void setScreenshareZone(QUuid zone) { _screenshareZone = zone; }
 
+    // shared encodes are keyed on the joint rotation tolerance each viewer gets
+    using AvatarData::getDistanceBasedMinRotationDOT;
+
 private:
     bool _needsHeroCheck { false };
     static const char* stateToName(VerifyState state);
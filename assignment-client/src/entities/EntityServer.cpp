@@ -339,6 +339,12 @@ void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectio
     tree->setWantEditLogging(wantEditLogging);
     tree->setWantTerseEditLogging(wantTerseEditLogging);
 
+    // on unless turned off
+    bool shareTraversals = false;
+    readOptionBool(QString("shareTraversals"), settingsSectionObject, shareTraversals);
+    _sharedTraversals.setEnabled(shareTraversals);
+    qDebug("shareTraversals=%s", debug::valueOf(_sharedTraversals.isEnabled()));
+
     QString entityScriptSourceWhitelist;
     if (readOptionString("entityScriptSourceWhitelist", settingsSectionObject, entityScriptSourceWhitelist)) {
         tree->setEntityScriptSourceWhitelist(entityScriptSourceWhitelist);
@@ -414,6 +420,20 @@ QString EntityServer::serverSubclassStats() {
     statsString += QString().sprintf("       EntityItem size... %ld bytes\r\n", sizeof(EntityItem));
     statsString += "\r\n\r\n";
 
+    statsString += "<b>Entity Server Shared Traversal Statistics</b>\r\n";
+    statsString += QString("           Traversals run... %1\r\n")
+        .arg(locale.toString((qulonglong)_sharedTraversals.getNumTraversals()));
+    statsString += QString("        Traversals shared... %1\r\n")
+        .arg(locale.toString((qulonglong)_sharedTraversals.getNumShared()));
+    statsString += "\r\n\r\n";
+
+    statsString += "<b>Entity Server Encode Cache Statistics</b>\r\n";
+    statsString += QString("       Entities encoded... %1\r\n")
+        .arg(locale.toString((qulonglong)EntityItem::getNumEncodeCacheMisses()));
+    statsString += QString("  Cached encodes reused... %1\r\n")
+        .arg(locale.toString((qulonglong)EntityItem::getNumEncodeCacheHits()));
+    statsString += "\r\n\r\n";
+
     statsString += "<b>Entity Server Sending to Viewer Statistics</b>\r\n";
     statsString += "----- Viewer Node ID -----------------    ----- Entity ID ----------------------    "
                    "---------- Last Sent To ----------    ---------- Last Edited -----------\r\n";
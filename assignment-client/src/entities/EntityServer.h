@@ -21,6 +21,7 @@
 #include <SimpleEntitySimulation.h>
 
 #include "EntityServerConsts.h"
+#include "SharedDiffTraversals.h"
 
 /// Handles assignments of type EntityServer - sending entities to various clients.
 
@@ -59,6 +60,8 @@ public:
 
     virtual void aboutToFinish() override;
 
+    SharedDiffTraversals& getSharedTraversals() { return _sharedTraversals; }
+
 public slots:
     virtual void nodeAdded(SharedNodePointer node) override;
     virtual void nodeKilled(SharedNodePointer node) override;
@@ -86,6 +89,8 @@ private:
     int _MAXIMUM_DYNAMIC_DOMAIN_VERIFICATION_TIMER_MS = DEFAULT_MAXIMUM_DYNAMIC_DOMAIN_VERIFICATION_TIMER_MS;  // 1h
     QTimer _dynamicDomainVerificationTimer;
     void startDynamicDomainVerification();
+
+    SharedDiffTraversals _sharedTraversals;
 };
 
 #endif  // hifi_EntityServer_h
@@ -33,6 +33,7 @@ void EntityTreeSendThread::resetState() {
 
     _knownState.clear();
     _traversal.reset();
+    _sharedTraversal.reset();
 }
 
 void EntityTreeSendThread::preDistributionProcessing() {
@@ -151,7 +152,13 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
         #else
         const uint64_t TIME_BUDGET = 200; // usec
         #endif
-        _traversal.traverse(TIME_BUDGET);
+        if (_sharedTraversal) {
+            if (_sharedTraversal->traverse(TIME_BUDGET)) {
+                addSharedTraversalResults();
+            }
+        } else {
+            _traversal.traverse(TIME_BUDGET);
+        }
         OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
     }
 
@@ -229,6 +236,7 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                                              bool forceFirstPass) {
 
     DiffTraversal::Type type = _traversal.prepareNewTraversal(view, root, forceFirstPass);
+    _sharedTraversal.reset();
     // there are three types of traversal:
     //
     //      (1) FirstTime = at login --> find everything in view
@@ -315,6 +323,44 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
             });
             break;
     }
+
+    // a Repeat depends on when our own last traversal completed, the others can be shared with clients about to run
+    // the same one
+    auto& sharedTraversals = static_cast<EntityServer*>(_myServer)->getSharedTraversals();
+    if (type != DiffTraversal::Repeat && sharedTraversals.isEnabled()) {
+        _sharedTraversal = sharedTraversals.get(type, view, _traversal.getCompletedView(), root);
+    }
+}
+
+void EntityTreeSendThread::addSharedTraversalResults() {
+    // same as the Differential scan callback, which for a First traversal (with its cleared _knownState)
+    // is the same as the First one
+    for (const auto& result : _sharedTraversal->getResults()) {
+        EntityItemPointer entity = result.entity.lock();
+        if (!entity || _sendQueue.contains(entity.get())) {
+            continue;
+        }
+        float priority = PrioritizedEntity::DO_NOT_SEND;
+
+        auto knownTimestamp = _knownState.find(entity.get());
+        if (knownTimestamp == _knownState.end()) {
+            // prioritized for the view of whoever started the shared traversal, which is very similar to ours
+            priority = result.priority;
+
+        } else if (entity->getLastEdited() > knownTimestamp->second ||
+                   entity->getLastChangedOnServer() > knownTimestamp->second) {
+            // it is known and it changed --> put it on the queue with any priority
+            priority = PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
+        }
+
+        if (priority != PrioritizedEntity::DO_NOT_SEND) {
+            _sendQueue.emplace(entity, priority);
+        }
+    }
+
+    // our next Repeat picks up whatever changed since the shared traversal started
+    _traversal.setCompletedTraversal(_sharedTraversal->getView());
+    _sharedTraversal.reset();
 }
 
 bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) {
@@ -358,6 +404,7 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
 
     LevelDetails entitiesLevel = _packetData.startLevel();
     uint64_t sendTime = usecTimestampNow();
+    params.useEncodeCache = true;
     auto nodeData = static_cast<OctreeQueryNode*>(params.nodeData);
     nodeData->stats.encodeStarted();
     auto entityNode = _node.toStrongRef();
@@ -0,0 +1,101 @@
+//
+//  SharedDiffTraversals.cpp
+//  assignment-client/src/entities
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SharedDiffTraversals.h"
+
+#include <cassert>
+
+#include <SharedUtil.h>
+
+// how long a finished traversal is handed out to clients starting a new one: one send interval, so that clients that
+// asked for the same view in the same frame share it but nobody is handed results from frames ago
+static const uint64_t SHARED_TRAVERSAL_MAX_AGE_USECS = USECS_PER_SECOND / 60;
+
+bool SharedDiffTraversals::Traversal::traverse(uint64_t timeBudget) {
+    if (_isFinished) {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // another send thread is on it
+        return false;
+    }
+
+    if (!_isFinished) {
+        _traversal.traverse(timeBudget);
+        if (_traversal.finished()) {
+            _finishedTime = usecTimestampNow();
+            _isFinished = true;
+        }
+    }
+    return _isFinished;
+}
+
+SharedDiffTraversals::TraversalPointer SharedDiffTraversals::get(DiffTraversal::Type type,
+                                                                 const DiffTraversal::View& view,
+                                                                 const DiffTraversal::View& completedView,
+                                                                 EntityTreeElementPointer root) {
+    assert(type != DiffTraversal::Repeat);
+    uint64_t now = usecTimestampNow();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    prune(now);
+
+    for (auto& traversal : _traversals) {
+        if (traversal->_type == type && traversal->_view.isVerySimilar(view) &&
+            (type == DiffTraversal::First || traversal->_completedView.isVerySimilar(completedView))) {
+            ++_numShared;
+            return traversal;
+        }
+    }
+
+    auto traversal = std::make_shared<Traversal>();
+    if (type == DiffTraversal::Differential) {
+        // start from where the client is, so that this is the same Differential it would have run itself
+        traversal->_traversal.setCompletedTraversal(completedView);
+        traversal->_completedView = completedView;
+    }
+    traversal->_type = traversal->_traversal.prepareNewTraversal(view, root, type == DiffTraversal::First);
+    assert(traversal->_type == type);
+    traversal->_view = traversal->_traversal.getCurrentView();
+
+    // record everything in view, DO_NOT_SEND included, since for a Differential a known entity that changed is
+    // sent regardless of its priority
+    auto results = &traversal->_results;
+    auto traversalView = &traversal->_view;
+    traversal->_traversal.setScanCallback([results, traversalView](DiffTraversal::VisibleElement& next) {
+        next.element->forEachEntity([&](EntityItemPointer entity) {
+            results->push_back({ entity, traversalView->computePriority(entity) });
+        });
+    });
+
+    _traversals.push_back(traversal);
+    ++_numTraversals;
+    return traversal;
+}
+
+void SharedDiffTraversals::prune(uint64_t now) {
+    auto it = _traversals.begin();
+    while (it != _traversals.end()) {
+        auto& traversal = *it;
+        bool isStale = traversal->_isFinished && now - traversal->_finishedTime > SHARED_TRAVERSAL_MAX_AGE_USECS;
+
+        // an unfinished traversal no send thread is waiting on anymore will never be finished
+        bool isAbandoned = !traversal->_isFinished && traversal.use_count() == 1;
+
+        if (isStale || isAbandoned) {
+            it = _traversals.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,86 @@
+//
+//  SharedDiffTraversals.h
+//  assignment-client/src/entities
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SharedDiffTraversals_h
+#define hifi_SharedDiffTraversals_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <DiffTraversal.h>
+
+// Traversals of the entity tree shared between the send threads of clients looking at nearly the same thing.
+//   Only First and Differential traversals are shared, and only between clients that would run the same one: the same
+//   type, a very similar view and, for a Differential, a very similar completed view to start from. Instead of every such
+//   client walking the tree on its own, the first one to ask starts a shared traversal that records every entity it finds
+//   along with its priority, whichever of those clients runs next advances it, and once it is finished each of them
+//   picks out what it needs from the results. A Repeat depends on when a client's own last traversal completed, so it
+//   is never shared.
+//   All methods are thread-safe.
+class SharedDiffTraversals {
+public:
+    class Traversal {
+    public:
+        struct Result {
+            EntityItemWeakPointer entity;
+            float priority;
+        };
+
+        DiffTraversal::Type getType() const { return _type; }
+        const DiffTraversal::View& getView() const { return _view; }
+
+        // advances the traversal unless another send thread is already doing so, returns true once it is finished
+        bool traverse(uint64_t timeBudget);
+        bool isFinished() const { return _isFinished; }
+
+        // only valid once the traversal is finished
+        const std::vector<Result>& getResults() const { return _results; }
+
+    private:
+        friend class SharedDiffTraversals;
+
+        std::mutex _mutex;
+        DiffTraversal _traversal;
+        DiffTraversal::Type _type;
+        DiffTraversal::View _view;
+        DiffTraversal::View _completedView;
+        std::vector<Result> _results;
+        std::atomic<bool> _isFinished { false };
+        std::atomic<uint64_t> _finishedTime { 0 };
+    };
+    using TraversalPointer = std::shared_ptr<Traversal>;
+
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+    bool isEnabled() const { return _isEnabled; }
+
+    // returns a traversal of this type for a view very similar to this one, starting a new one if there is none in
+    // progress and none that finished recently enough - completedView only matters for a Differential
+    TraversalPointer get(DiffTraversal::Type type, const DiffTraversal::View& view,
+                         const DiffTraversal::View& completedView, EntityTreeElementPointer root);
+
+    uint64_t getNumTraversals() const { return _numTraversals; }
+    uint64_t getNumShared() const { return _numShared; }
+
+private:
+    void prune(uint64_t now);
+
+    std::atomic<bool> _isEnabled { false };
+
+    std::mutex _mutex;
+    std::vector<TraversalPointer> _traversals;
+
+    std::atomic<uint64_t> _numTraversals { 0 };
+    std::atomic<uint64_t> _numShared { 0 };
+};
+
+#endif // hifi_SharedDiffTraversals_h
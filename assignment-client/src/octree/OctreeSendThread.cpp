@@ -19,6 +19,7 @@
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
 
+#include "OctreeSendThreadPool.h"
 #include "OctreeServer.h"
 #include "OctreeServerConsts.h"
 #include "OctreeLogging.h"
@@ -49,6 +50,11 @@ OctreeSendThread::OctreeSendThread(OctreeServer* myServer, const SharedNodePoint
 OctreeSendThread::~OctreeSendThread() {
     setIsShuttingDown();
 
+    if (_pool) {
+        // wait for the pool to be done with us
+        _pool->remove(this);
+    }
+
     QString safeServerName("Octree");
     if (_myServer) {
         safeServerName = _myServer->getMyServerName();
@@ -65,6 +71,21 @@ void OctreeSendThread::setIsShuttingDown() {
     _isShuttingDown = true;
 }
 
+void OctreeSendThread::initializePooled(OctreeSendThreadPool* pool) {
+    _pool = pool;
+    initialize(false);
+    _pool->add(this);
+}
+
+bool OctreeSendThread::processPooled() {
+    if (!process()) {
+        // same as a threaded send thread whose thread routine returns
+        emit finished();
+        return false;
+    }
+    return true;
+}
+
 
 bool OctreeSendThread::process() {
     if (_isShuttingDown) {
@@ -112,7 +133,10 @@ bool OctreeSendThread::process() {
             usecToSleep = MIN_USEC_TO_SLEEP;
         }
 
-        {
+        if (_pool) {
+            // the pool's worker comes back to us when it is time, and runs other clients in the meantime
+            _nextProcessTime = usecTimestampNow() + usecToSleep;
+        } else {
             PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
             std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
         }
@@ -20,6 +20,7 @@
 #include <Node.h>
 #include <OctreePacketData.h>
 #include "OctreeQueryNode.h"
+#include "OctreeSendThreadPool.h"
 
 class OctreeQueryNode;
 class OctreeServer;
@@ -27,7 +28,7 @@ class OctreeServer;
 using AtomicUIntStat = std::atomic<uintmax_t>;
 
 /// Threaded processor for sending octree packets to a single client
-class OctreeSendThread : public GenericThread {
+class OctreeSendThread : public GenericThread, public OctreeSendPoolTask {
     Q_OBJECT
 public:
     OctreeSendThread(OctreeServer* myServer, const SharedNodePointer& node);
@@ -38,6 +39,14 @@ public:
 
     QUuid getNodeUuid() const { return _nodeUuid; }
 
+    // Runs this send thread on the pool's workers rather than on its own thread - call instead of initialize(true)
+    void initializePooled(OctreeSendThreadPool* pool);
+
+    // called by the pool's worker each time the send interval comes around, returns false once the thread is done
+    bool processPooled() override;
+    quint64 getNextProcessTime() const override { return _nextProcessTime; }
+    QObject* getPoolObject() override { return this; }
+
     static AtomicUIntStat _totalBytes;
     static AtomicUIntStat _totalWastedBytes;
     static AtomicUIntStat _totalPackets;
@@ -74,6 +83,9 @@ private:
     int _trueBytesSent { 0 }; // available for debug stats
     int _packetsSentThisInterval { 0 }; // used for bandwidth throttle condition
     bool _isShuttingDown { false };
+
+    OctreeSendThreadPool* _pool { nullptr };
+    std::atomic<quint64> _nextProcessTime { 0 };
 };
 
 #endif // hifi_OctreeSendThread_h
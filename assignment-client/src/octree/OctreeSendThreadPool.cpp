@@ -0,0 +1,128 @@
+//
+//  OctreeSendThreadPool.cpp
+//  assignment-client/src/octree
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeSendThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDebug>
+
+#include <SharedUtil.h>
+
+void OctreeSendWorkerThread::run() {
+    std::vector<OctreeSendPoolTask*> dueTasks;
+
+    while (!_stop) {
+        {
+            std::lock_guard<std::mutex> processingLock(_processingMutex);
+
+            // deliver the queued slots of the tasks living here
+            QCoreApplication::processEvents();
+
+            quint64 now = usecTimestampNow();
+            dueTasks.clear();
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (auto task : _tasks) {
+                    if (task->getNextProcessTime() <= now) {
+                        dueTasks.push_back(task);
+                    }
+                }
+            }
+
+            // nothing can be removed while we hold the processing lock, so these are all still ours
+            for (auto task : dueTasks) {
+                if (_stop) {
+                    break;
+                }
+                if (!task->processPooled()) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _tasks.erase(std::remove(_tasks.begin(), _tasks.end(), task), _tasks.end());
+                }
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto shouldWake = [this] { return _stop || _hasNewTasks; };
+        if (_tasks.empty()) {
+            _condition.wait(lock, shouldWake);
+        } else {
+            quint64 nextProcessTime = _tasks.front()->getNextProcessTime();
+            for (auto task : _tasks) {
+                nextProcessTime = std::min(nextProcessTime, task->getNextProcessTime());
+            }
+            quint64 now = usecTimestampNow();
+            if (nextProcessTime > now) {
+                _condition.wait_for(lock, std::chrono::microseconds(nextProcessTime - now), shouldWake);
+            }
+        }
+        _hasNewTasks = false;
+    }
+}
+
+OctreeSendThreadPool::OctreeSendThreadPool(int numThreads) {
+    numThreads = std::max(numThreads, 1);
+    for (int i = 0; i < numThreads; ++i) {
+        auto worker = new OctreeSendWorkerThread();
+        worker->setObjectName(QString("Octree Send Worker %1").arg(i));
+        worker->start();
+        _workers.emplace_back(worker);
+    }
+    qDebug() << "Octree send thread pool started with" << numThreads << "workers";
+}
+
+OctreeSendThreadPool::~OctreeSendThreadPool() {
+    for (auto& worker : _workers) {
+        std::lock_guard<std::mutex> lock(worker->_mutex);
+        worker->_stop = true;
+        worker->_condition.notify_one();
+    }
+    for (auto& worker : _workers) {
+        worker->wait();
+    }
+}
+
+void OctreeSendThreadPool::add(OctreeSendPoolTask* task) {
+    // give it to the worker serving the fewest clients
+    OctreeSendWorkerThread* leastBusyWorker = nullptr;
+    size_t leastBusyCount = 0;
+    for (auto& worker : _workers) {
+        std::lock_guard<std::mutex> lock(worker->_mutex);
+        if (!leastBusyWorker || worker->_tasks.size() < leastBusyCount) {
+            leastBusyWorker = worker.get();
+            leastBusyCount = worker->_tasks.size();
+        }
+    }
+
+    task->getPoolObject()->moveToThread(leastBusyWorker);
+
+    std::lock_guard<std::mutex> lock(leastBusyWorker->_mutex);
+    leastBusyWorker->_tasks.push_back(task);
+    leastBusyWorker->_hasNewTasks = true;
+    leastBusyWorker->_condition.notify_one();
+}
+
+void OctreeSendThreadPool::remove(OctreeSendPoolTask* task) {
+    // a task that just finished has already dropped itself from its worker's list, but that worker may still be
+    // inside its processPooled() - not finding it means every worker's pass has been waited out once, so none of
+    // them still is
+    for (auto& worker : _workers) {
+        std::lock_guard<std::mutex> processingLock(worker->_processingMutex);
+        std::lock_guard<std::mutex> lock(worker->_mutex);
+        auto it = std::find(worker->_tasks.begin(), worker->_tasks.end(), task);
+        if (it != worker->_tasks.end()) {
+            worker->_tasks.erase(it);
+            return;
+        }
+    }
+}
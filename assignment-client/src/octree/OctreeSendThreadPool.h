@@ -0,0 +1,77 @@
+//
+//  OctreeSendThreadPool.h
+//  assignment-client/src/octree
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeSendThreadPool_h
+#define hifi_OctreeSendThreadPool_h
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QThread>
+
+// What an OctreeSendThreadPool runs, an OctreeSendThread that has no thread of its own.
+class OctreeSendPoolTask {
+public:
+    virtual ~OctreeSendPoolTask() {}
+
+    // processes the task once, returns false once it is done and is to be dropped from the pool
+    virtual bool processPooled() = 0;
+
+    // when the task is next due, in usecTimestampNow() time
+    virtual quint64 getNextProcessTime() const = 0;
+
+    // the object whose queued slots are to be delivered on the worker the task runs on
+    virtual QObject* getPoolObject() = 0;
+};
+
+class OctreeSendWorkerThread : public QThread {
+    Q_OBJECT
+public:
+    void run() override final;
+
+private:
+    friend class OctreeSendThreadPool;
+
+    // held for a whole pass over the due tasks, so that remove() can wait out any use of the task it removes
+    std::mutex _processingMutex;
+
+    // guards the task list and the wake up flags, never held while a task is processed
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<OctreeSendPoolTask*> _tasks;
+    bool _hasNewTasks { false };
+    std::atomic<bool> _stop { false };
+};
+
+// Runs the non-threaded OctreeSendThreads of every client on a fixed number of worker threads,
+// instead of one thread per client.
+//   Each task is moved to the worker it is added to, so its queued slots are delivered there, and is processed
+//   every time it comes due. A worker sleeps until its next task is due, or until a task is added to it.
+//   add() must be called from the thread the task's object was created on, remove() may be called from any
+//   thread but the workers and blocks until the task is no longer being processed.
+class OctreeSendThreadPool {
+public:
+    OctreeSendThreadPool(int numThreads);
+    ~OctreeSendThreadPool();
+
+    int numThreads() const { return (int)_workers.size(); }
+
+    void add(OctreeSendPoolTask* task);
+    void remove(OctreeSendPoolTask* task);
+
+private:
+    std::vector<std::unique_ptr<OctreeSendWorkerThread>> _workers;
+};
+
+#endif // hifi_OctreeSendThreadPool_h
@@ -878,7 +878,11 @@ OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePo
 
     // we want to be notified when the thread finishes
     connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
+    if (_sendThreadPool) {
+        sendThread->initializePooled(_sendThreadPool.get());
+    } else {
+        sendThread->initialize(true);
+    }
 
     return sendThread;
 }
@@ -902,6 +906,10 @@ void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> messa
         if (it == _sendThreads.end()) {
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         } else if (it->second->isShuttingDown()) {
+            if (_sendThreadPool) {
+                // take it off the pool before it starts destroying itself
+                _sendThreadPool->remove(it->second.get());
+            }
             _sendThreads.erase(it); // Remove right away and wait on thread to be
 
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
@@ -1048,6 +1056,16 @@ void OctreeServer::readConfiguration() {
         qDebug() << "persisAbsoluteFilePath=" << _persistAbsoluteFilePath;
 
         _persistAsFileType = "json.gz";
+        QString persistAsFileType;
+        if (readOptionString("persistAsFileType", settingsSectionObject, persistAsFileType)) {
+            persistAsFileType = persistAsFileType.toLower();
+            if (PERSIST_EXTENSIONS.contains(persistAsFileType)) {
+                _persistAsFileType = persistAsFileType;
+            } else {
+                qWarning() << "Unknown persist file type" << persistAsFileType << "- using" << _persistAsFileType;
+            }
+        }
+        qDebug() << "persistAsFileType=" << _persistAsFileType;
 
         _persistInterval = OctreePersistThread::DEFAULT_PERSIST_INTERVAL;
         int result { -1 };
@@ -1058,6 +1076,17 @@ void OctreeServer::readConfiguration() {
 
         qDebug() << "persistInterval=" << _persistInterval.count();
 
+        readOptionBool(QString("persistLog"), settingsSectionObject, _persistLog);
+        qDebug() << "persistLog=" << _persistLog;
+
+        _persistSnapshotInterval = OctreePersistThread::DEFAULT_SNAPSHOT_INTERVAL;
+        result = -1;
+        readOptionInt(QString("persistSnapshotInterval"), settingsSectionObject, result);
+        if (result != -1) {
+            _persistSnapshotInterval = std::chrono::milliseconds(result);
+        }
+        qDebug() << "persistSnapshotInterval=" << _persistSnapshotInterval.count();
+
         readOptionBool(QString("persistFileDownload"), settingsSectionObject, _persistFileDownload);
         qDebug() << "persistFileDownload=" << _persistFileDownload;
 
@@ -1096,6 +1125,13 @@ void OctreeServer::readConfiguration() {
     qDebug("packetsPerSecondTotalMax=%d _packetsTotalPerInterval=%d",
                     packetsPerSecondTotalMax, _packetsTotalPerInterval);
 
+    // 0 sizes the send thread pool to the machine, -1 goes back to a thread per client
+    readOptionInt(QString("sendThreadPoolSize"), settingsSectionObject, _sendThreadPoolSize);
+    if (_sendThreadPoolSize >= 0) {
+        int numThreads = _sendThreadPoolSize > 0 ? _sendThreadPoolSize : QThread::idealThreadCount();
+        _sendThreadPool.reset(new OctreeSendThreadPool(numThreads));
+    }
+    qDebug() << "sendThreadPoolSize=" << _sendThreadPoolSize;
 
     readAdditionalConfiguration(settingsSectionObject);
 }
@@ -1140,7 +1176,8 @@ void OctreeServer::domainSettingsRequestComplete() {
             _persistAbsoluteFilePath.replace(ENTITY_PERSIST_EXTENSION, ENTITY_PERSIST_EXTENSION, Qt::CaseInsensitive);
         }
 
-        if (!QFile::exists(_persistAbsoluteFilePath)) {
+        // the persist file may have been saved as another file type
+        if (!QFile::exists(findMostRecentFileExtension(_persistAbsoluteFilePath, PERSIST_EXTENSIONS))) {
             qDebug() << "Persist file does not exist, checking for existence of persist file next to application";
 
             static const QString OLD_DEFAULT_PERSIST_FILENAME = "resources/models.json.gz";
@@ -1186,7 +1223,7 @@ void OctreeServer::domainSettingsRequestComplete() {
 
         // now set up PersistThread
         _persistManager = new OctreePersistThread(_tree, _persistAbsoluteFilePath, _persistInterval, _debugTimestampNow,
-                                                 _persistAsFileType);
+                                                 _persistAsFileType, _persistLog, _persistSnapshotInterval);
         _persistManager->moveToThread(&_persistThread);
         connect(&_persistThread, &QThread::finished, _persistManager, &QObject::deleteLater);
         connect(&_persistThread, &QThread::started, _persistManager, &OctreePersistThread::start);
@@ -1292,12 +1329,17 @@ void OctreeServer::aboutToFinish() {
     for (auto& it : _sendThreads) {
         auto& sendThread = *it.second;
         sendThread.setIsShuttingDown();
+        if (_sendThreadPool) {
+            // take it off the workers before it is shut down from here
+            _sendThreadPool->remove(&sendThread);
+        }
         sendThread.terminate();
     }
 
     // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
     // which waits on the thread to be done before returning
     _sendThreads.clear(); // Cleans up all the send threads.
+    _sendThreadPool.reset();
 
     if (_persistManager) {
         _persistThread.quit();
@@ -24,6 +24,7 @@
 
 #include "OctreePersistThread.h"
 #include "OctreeSendThread.h"
+#include "OctreeSendThreadPool.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
 
@@ -194,6 +195,8 @@ protected:
     QThread _persistThread;
 
     std::chrono::milliseconds _persistInterval;
+    bool _persistLog { false };
+    std::chrono::milliseconds _persistSnapshotInterval;
     bool _persistFileDownload;
     int _maxBackupVersions;
 
@@ -203,6 +206,10 @@ protected:
     
     SendThreads _sendThreads;
 
+    // runs the send threads of all clients when set, otherwise every client gets a thread of its own
+    std::unique_ptr<OctreeSendThreadPool> _sendThreadPool;
+    int _sendThreadPoolSize { -1 };
+
     static int _clientCount;
     static SimpleMovingAverage _averageLoopTime;
 
@@ -544,6 +544,12 @@ void DomainContentBackupManager::removeOldBackupVersions(const BackupRule& rule)
                 QFile backupFile(fileInfo);
                 if (!backupFile.remove()) {
                     qCDebug(domain_server) << "Failed to remove old backup: " << backupFile.fileName();
+                    continue;
+                }
+
+                // let the handlers release what only this backup was using
+                for (auto& handler : _backupHandlers) {
+                    handler->deleteBackup(matchingFiles[i].fileName());
                 }
             }
         }
@@ -11,7 +11,13 @@
 
 #include "EntitiesBackupHandler.h"
 
+#include <QCryptographicHash>
 #include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSet>
 
 #if !defined(__clang__) && defined(__GNUC__)
 #pragma GCC diagnostic push
@@ -25,40 +31,258 @@
 #pragma GCC diagnostic pop
 #endif
 
-#include <OctreeDataUtils.h>
+#include <OctreeBinaryFormat.h>
 
-EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath) :
+static const QString ENTITIES_BACKUP_FILENAME = "models.json.gz";
+static const QString ENTITIES_DELTA_BACKUP_FILENAME = "models.delta.json";
+static const QString SNAPSHOTS_DIR = "/entities/";
+static const QString SNAPSHOT_EXTENSION = ".json.gz";
+
+// A new snapshot is started once the entities that changed since the current one are this big a part of the entities.
+static const float MAX_DELTA_FRACTION = 0.25f;
+
+EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath, QString backupDirectory) :
     _entitiesFilePath(entitiesFilePath),
-    _entitiesReplacementFilePath(entitiesReplacementFilePath)
+    _entitiesReplacementFilePath(entitiesReplacementFilePath),
+    _backupDirectory(backupDirectory),
+    _snapshotsDirectory(backupDirectory + SNAPSHOTS_DIR)
 {
+    QDir snapshotsDir { _snapshotsDirectory };
+    snapshotsDir.mkpath(".");
+
+    auto snapshotFiles = snapshotsDir.entryInfoList({ "*" + SNAPSHOT_EXTENSION }, QDir::Files);
+    for (const auto& snapshotFile : snapshotFiles) {
+        _snapshotsOnDisk.insert(snapshotFile.baseName());
+    }
 }
 
-static const QString ENTITIES_BACKUP_FILENAME = "models.json.gz";
+static QString entityID(const QVariant& entity) {
+    return entity.toJsonObject()["id"].toString();
+}
+
+static QByteArray hashEntity(const QVariant& entity, int& size) {
+    auto json = QJsonDocument(entity.toJsonObject()).toJson(QJsonDocument::Compact);
+    size = json.size();
+    return QCryptographicHash::hash(json, QCryptographicHash::Sha1);
+}
+
+static bool writeZipFile(QuaZip& zip, const QString& fileName, const QByteArray& data) {
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(fileName))) {
+        qCritical().nospace() << "Failed to open " << fileName << " for writing in zip";
+        return false;
+    }
+    if (zipFile.write(data) != data.size()) {
+        qCritical().nospace() << "Failed to write " << fileName << " to backup";
+        zipFile.close();
+        return false;
+    }
+    zipFile.close();
+    if (zipFile.getZipError() != UNZ_OK) {
+        qCritical().nospace() << "Failed to zip " << fileName << ": " << zipFile.getZipError();
+        return false;
+    }
+    return true;
+}
+
+void EntitiesBackupHandler::loadBackup(const QString& backupName, QuaZip& zip) {
+    if (!zip.setCurrentFile(ENTITIES_DELTA_BACKUP_FILENAME)) {
+        // a full backup, or one without entities
+        return;
+    }
+
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::ReadOnly)) {
+        qCritical() << "Could not unzip backup file for load:" << ENTITIES_DELTA_BACKUP_FILENAME << "in" << backupName;
+        _corruptedBackups.insert(backupName);
+        return;
+    }
+    auto document = QJsonDocument::fromJson(zipFile.readAll());
+    zipFile.close();
+
+    auto snapshotHash = document.object()["Snapshot"].toString();
+    if (snapshotHash.isEmpty()) {
+        qCritical() << "Could not parse" << ENTITIES_DELTA_BACKUP_FILENAME << "in" << backupName;
+        _corruptedBackups.insert(backupName);
+        return;
+    }
+
+    _deltaBackups[backupName] = snapshotHash;
+    if (_snapshotsOnDisk.count(snapshotHash) == 0) {
+        qCritical() << "Entities snapshot" << snapshotHash << "for backup" << backupName << "is missing from disk";
+        _corruptedBackups.insert(backupName);
+    }
+}
+
+void EntitiesBackupHandler::loadingComplete() {
+    checkForSnapshotsToDelete();
+
+    // carry on from the most recent snapshot that's still in use, rather than starting a new one
+    if (_currentSnapshot.isEmpty()) {
+        auto snapshotFiles = QDir(_snapshotsDirectory).entryInfoList({ "*" + SNAPSHOT_EXTENSION }, QDir::Files, QDir::Time);
+        if (!snapshotFiles.isEmpty()) {
+            _currentSnapshot = snapshotFiles.first().baseName();
+            _currentSnapshotLoaded = false;
+        }
+    }
+}
+
+void EntitiesBackupHandler::checkForSnapshotsToDelete() {
+    if (!_corruptedBackups.empty()) {
+        qWarning() << "Some entities backups did not load properly, not deleting any entities snapshots for safety.";
+        return;
+    }
+
+    std::set<SnapshotHash> snapshotsInBackups;
+    for (const auto& backup : _deltaBackups) {
+        snapshotsInBackups.insert(backup.second);
+    }
+
+    for (auto itr = _snapshotsOnDisk.begin(); itr != _snapshotsOnDisk.end();) {
+        if (snapshotsInBackups.count(*itr) > 0) {
+            ++itr;
+            continue;
+        }
+
+        if (!QFile::remove(_snapshotsDirectory + *itr + SNAPSHOT_EXTENSION)) {
+            qWarning() << "Could not delete entities snapshot:" << *itr;
+            ++itr;
+            continue;
+        }
+
+        if (*itr == _currentSnapshot) {
+            _currentSnapshot.clear();
+            _currentSnapshotEntities.clear();
+            _currentSnapshotLoaded = false;
+        }
+        itr = _snapshotsOnDisk.erase(itr);
+    }
+}
 
 void EntitiesBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
     QFile entitiesFile { _entitiesFilePath };
 
     if (entitiesFile.open(QIODevice::ReadOnly)) {
-        QuaZipFile zipFile { &zip };
-        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, _entitiesFilePath))) {
-            qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_FILENAME << " for writing in zip";
-            return;
-        }
         auto entityData = entitiesFile.readAll();
-        if (zipFile.write(entityData) != entityData.size()) {
-            qCritical() << "Failed to write entities file to backup";
-            zipFile.close();
-            return;
+        if (writeDeltaBackup(zip, entityData)) {
+            _deltaBackups[backupName] = _currentSnapshot;
+        } else {
+            writeZipFile(zip, ENTITIES_BACKUP_FILENAME, entityData);
         }
-        zipFile.close();
-        if (zipFile.getZipError() != UNZ_OK) {
-            qCritical().nospace() << "Failed to zip " << ENTITIES_BACKUP_FILENAME << ": " << zipFile.getZipError();
+    }
+}
+
+bool EntitiesBackupHandler::writeDeltaBackup(QuaZip& zip, const QByteArray& entitiesData) {
+    if (OctreeBinaryFormat::isBinary(entitiesData)) {
+        // entities in the binary format can only be read into a tree, so they're backed up whole
+        return false;
+    }
+
+    OctreeUtils::RawEntityData data;
+    if (!data.readOctreeDataInfoFromData(entitiesData)) {
+        return false;
+    }
+
+    if (!_currentSnapshotLoaded && !loadCurrentSnapshot()) {
+        _currentSnapshot.clear();
+    }
+
+    // the entities that were added or changed since the current snapshot
+    EntityHashes entityHashes;
+    entityHashes.reserve(data.variantEntityData.size());
+    QJsonArray changedEntities;
+    qint64 entitiesSize = 0;
+    qint64 changedEntitiesSize = 0;
+    for (const auto& entity : data.variantEntityData) {
+        int entitySize;
+        auto hash = hashEntity(entity, entitySize);
+        auto id = entityID(entity);
+        entityHashes.insert(id, hash);
+        entitiesSize += entitySize;
+
+        auto itr = _currentSnapshotEntities.find(id);
+        if (itr == _currentSnapshotEntities.end() || itr.value() != hash) {
+            changedEntities.push_back(entity.toJsonObject());
+            changedEntitiesSize += entitySize;
+        }
+    }
+
+    QJsonArray deletedEntities;
+    for (auto itr = _currentSnapshotEntities.cbegin(); itr != _currentSnapshotEntities.cend(); ++itr) {
+        if (!entityHashes.contains(itr.key())) {
+            deletedEntities.push_back(itr.key());
+        }
+    }
+
+    if (_currentSnapshot.isEmpty() || changedEntitiesSize > entitiesSize * MAX_DELTA_FRACTION) {
+        if (!startSnapshot(entitiesData, entityHashes)) {
+            return false;
         }
+        changedEntities = QJsonArray();
+        deletedEntities = QJsonArray();
     }
+
+    QJsonObject delta;
+    delta["Snapshot"] = _currentSnapshot;
+    delta["Id"] = data.id.toString();
+    delta["DataVersion"] = data.dataVersion;
+    delta["Version"] = data.version;
+    delta["Entities"] = changedEntities;
+    delta["DeletedEntities"] = deletedEntities;
+
+    return writeZipFile(zip, ENTITIES_DELTA_BACKUP_FILENAME, QJsonDocument(delta).toJson(QJsonDocument::Compact));
 }
 
-std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
+bool EntitiesBackupHandler::startSnapshot(const QByteArray& entitiesData, const EntityHashes& entityHashes) {
+    SnapshotHash hash = QCryptographicHash::hash(entitiesData, QCryptographicHash::Sha256).toHex();
+
+    if (_snapshotsOnDisk.count(hash) == 0) {
+        QFile snapshotFile { _snapshotsDirectory + hash + SNAPSHOT_EXTENSION };
+        if (!snapshotFile.open(QIODevice::WriteOnly) || snapshotFile.write(entitiesData) != entitiesData.size()) {
+            qCritical() << "Could not write entities snapshot:" << snapshotFile.fileName();
+            snapshotFile.remove();
+            return false;
+        }
+        _snapshotsOnDisk.insert(hash);
+    }
+
+    _currentSnapshot = hash;
+    _currentSnapshotEntities = entityHashes;
+    _currentSnapshotLoaded = true;
+    return true;
+}
+
+bool EntitiesBackupHandler::loadCurrentSnapshot() {
+    _currentSnapshotEntities.clear();
+    _currentSnapshotLoaded = true;
+
+    OctreeUtils::RawEntityData data;
+    if (_currentSnapshot.isEmpty() || !readSnapshot(_currentSnapshot, data)) {
+        return false;
+    }
+
+    _currentSnapshotEntities.reserve(data.variantEntityData.size());
+    for (const auto& entity : data.variantEntityData) {
+        int entitySize;
+        _currentSnapshotEntities.insert(entityID(entity), hashEntity(entity, entitySize));
+    }
+    return true;
+}
+
+bool EntitiesBackupHandler::readSnapshot(const SnapshotHash& hash, OctreeUtils::RawEntityData& data) {
+    auto snapshotPath = _snapshotsDirectory + hash + SNAPSHOT_EXTENSION;
+    if (!QFile::exists(snapshotPath)) {
+        qCritical() << "Entities snapshot" << hash << "is missing from disk";
+        return false;
+    }
+    return data.readOctreeDataInfoFromFile(snapshotPath);
+}
+
+std::pair<bool, QString> EntitiesBackupHandler::readBackup(QuaZip& zip, OctreeUtils::RawEntityData& data) {
     if (!zip.setCurrentFile(ENTITIES_BACKUP_FILENAME)) {
+        if (zip.setCurrentFile(ENTITIES_DELTA_BACKUP_FILENAME)) {
+            return readDeltaBackup(zip, data);
+        }
         QString errorStr("Failed to find " + ENTITIES_BACKUP_FILENAME + " while recovering backup");
         qWarning() << errorStr;
         return { false, errorStr };
@@ -79,12 +303,87 @@ std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& bac
         return { false, errorStr };
     }
 
-    OctreeUtils::RawEntityData data;
     if (!data.readOctreeDataInfoFromData(rawData)) {
         QString errorStr("Unable to parse octree data during backup recovery");
         qCritical() << errorStr;
         return { false, errorStr };
     }
+    return { true, QString() };
+}
+
+std::pair<bool, QString> EntitiesBackupHandler::readDeltaBackup(QuaZip& zip, OctreeUtils::RawEntityData& data, SnapshotHash* snapshotHash) {
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::ReadOnly)) {
+        QString errorStr("Failed to open " + ENTITIES_DELTA_BACKUP_FILENAME + " in backup");
+        qCritical() << errorStr;
+        return { false, errorStr };
+    }
+    auto document = QJsonDocument::fromJson(zipFile.readAll());
+    zipFile.close();
+
+    auto delta = document.object();
+    auto hash = delta["Snapshot"].toString();
+    if (hash.isEmpty()) {
+        QString errorStr("Unable to parse " + ENTITIES_DELTA_BACKUP_FILENAME + " during backup recovery");
+        qCritical() << errorStr;
+        return { false, errorStr };
+    }
+    if (snapshotHash) {
+        *snapshotHash = hash;
+    }
+
+    if (!readSnapshot(hash, data)) {
+        QString errorStr("The entities this backup was made from are no longer on this server");
+        qCritical() << errorStr;
+        return { false, errorStr };
+    }
+
+    // replace the entities that changed, drop the deleted ones and add the new ones, keeping the snapshot's order
+    QHash<QString, QJsonObject> changedEntities;
+    auto changedEntitiesArray = delta["Entities"].toArray();
+    changedEntities.reserve(changedEntitiesArray.size());
+    for (const auto& entity : changedEntitiesArray) {
+        changedEntities.insert(entity.toObject()["id"].toString(), entity.toObject());
+    }
+    QSet<QString> deletedEntities;
+    for (const auto& id : delta["DeletedEntities"].toArray()) {
+        deletedEntities.insert(id.toString());
+    }
+
+    QVariantList entities;
+    entities.reserve(data.variantEntityData.size() + changedEntities.size());
+    for (const auto& entity : data.variantEntityData) {
+        auto id = entityID(entity);
+        if (deletedEntities.contains(id)) {
+            continue;
+        }
+        auto itr = changedEntities.find(id);
+        if (itr != changedEntities.end()) {
+            entities.push_back(itr.value());
+            changedEntities.erase(itr);
+        } else {
+            entities.push_back(entity);
+        }
+    }
+    for (const auto& entity : changedEntitiesArray) {
+        if (changedEntities.contains(entity.toObject()["id"].toString())) {
+            entities.push_back(entity.toObject());
+        }
+    }
+    data.variantEntityData = entities;
+
+    data.id = QUuid(delta["Id"].toString());
+    data.dataVersion = delta["DataVersion"].toVariant().toLongLong();
+    data.version = delta["Version"].toVariant().toLongLong();
+    return { true, QString() };
+}
+
+std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
+    OctreeUtils::RawEntityData data;
+    auto result = readBackup(zip, data);
+    if (!result.first) {
+        return result;
+    }
 
     data.resetIdAndVersion();
 
@@ -95,3 +394,31 @@ std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& bac
     }
     return { true, QString() };
 }
+
+void EntitiesBackupHandler::deleteBackup(const QString& backupName) {
+    _corruptedBackups.erase(backupName);
+    if (_deltaBackups.erase(backupName) > 0) {
+        checkForSnapshotsToDelete();
+    }
+}
+
+void EntitiesBackupHandler::consolidateBackup(const QString& backupName, QuaZip& zip) {
+    if (_deltaBackups.count(backupName) == 0) {
+        // already a full backup
+        return;
+    }
+
+    // the zip being consolidated is only open for adding, so the delta is read from the backup itself
+    QuaZip backupZip { QDir(_backupDirectory).filePath(backupName) };
+    if (!backupZip.open(QuaZip::mdUnzip) || !backupZip.setCurrentFile(ENTITIES_DELTA_BACKUP_FILENAME)) {
+        qCritical() << "Could not open backup" << backupName << "to consolidate entities";
+        return;
+    }
+
+    OctreeUtils::RawEntityData data;
+    bool success = readDeltaBackup(backupZip, data).first;
+    backupZip.close();
+    if (success) {
+        writeZipFile(zip, ENTITIES_BACKUP_FILENAME, data.toGzippedByteArray());
+    }
+}
@@ -12,36 +12,71 @@
 #ifndef hifi_EntitiesBackupHandler_h
 #define hifi_EntitiesBackupHandler_h
 
+#include <map>
+#include <set>
+
+#include <QHash>
+
+#include <OctreeDataUtils.h>
+
 #include "BackupHandler.h"
 
+// Rolling backups of the entities don't each hold a copy of the entities file. The entities are stored once in a
+//   snapshot next to the backups, and each backup holds the entities that changed since that snapshot. A new snapshot
+//   is started when the changes grow too big. Full backups (models.json.gz) are still written for downloads, and
+//   either kind can be recovered from.
 class EntitiesBackupHandler : public BackupHandlerInterface {
 public:
-    EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath);
+    EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath, QString backupDirectory);
 
     std::pair<bool, float> isAvailable(const QString& backupName) override { return { true, 1.0f }; }
     std::pair<bool, float> getRecoveryStatus() override { return { false, 1.0f }; }
 
-    void loadBackup(const QString& backupName, QuaZip& zip) override {}
+    void loadBackup(const QString& backupName, QuaZip& zip) override;
 
-    void loadingComplete() override {}
+    void loadingComplete() override;
 
     // Create a skeleton backup
     void createBackup(const QString& backupName, QuaZip& zip) override;
 
-    // Recover from a full backup
+    // Recover from a full or skeleton backup
     std::pair<bool, QString> recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) override;
 
     // Delete a skeleton backup
-    void deleteBackup(const QString& backupName) override {}
+    void deleteBackup(const QString& backupName) override;
 
     // Create a full backup
-    void consolidateBackup(const QString& backupName, QuaZip& zip) override {}
+    void consolidateBackup(const QString& backupName, QuaZip& zip) override;
 
-    bool isCorruptedBackup(const QString& backupName) override { return false; }
+    bool isCorruptedBackup(const QString& backupName) override { return _corruptedBackups.count(backupName) > 0; }
 
 private:
+    using SnapshotHash = QString;
+    using EntityHashes = QHash<QString, QByteArray>; // entity ID => hash of the entity's JSON
+
+    bool writeDeltaBackup(QuaZip& zip, const QByteArray& entitiesData);
+    bool startSnapshot(const QByteArray& entitiesData, const EntityHashes& entityHashes);
+    bool loadCurrentSnapshot();
+
+    bool readSnapshot(const SnapshotHash& hash, OctreeUtils::RawEntityData& data);
+    std::pair<bool, QString> readBackup(QuaZip& zip, OctreeUtils::RawEntityData& data);
+    std::pair<bool, QString> readDeltaBackup(QuaZip& zip, OctreeUtils::RawEntityData& data, SnapshotHash* snapshotHash = nullptr);
+
+    void checkForSnapshotsToDelete();
+
     QString _entitiesFilePath;
     QString _entitiesReplacementFilePath;
+    QString _backupDirectory;
+    QString _snapshotsDirectory;
+
+    std::map<QString, SnapshotHash> _deltaBackups; // backup name => the snapshot it's a delta of
+    std::set<QString> _corruptedBackups;
+    std::set<SnapshotHash> _snapshotsOnDisk;
+
+    // the snapshot new backups are deltas of
+    SnapshotHash _currentSnapshot;
+    EntityHashes _currentSnapshotEntities;
+    bool _currentSnapshotLoaded { false };
 };
 
 #endif /* hifi_EntitiesBackupHandler_h */
@@ -1531,13 +1531,11 @@ void AudioClient::prepareLocalAudioInjectors(std::unique_ptr<Lock> localAudioLoc
                 AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
             // write to local injectors' ring buffer
-            samples = frames * AudioConstants::STEREO;
-            _localInjectorsStream.writeSamples(_localOutputMixBuffer, samples);
+            samples = _localInjectorsStream.writeSamples(_localOutputMixBuffer, frames * AudioConstants::STEREO);
 
         } else {
             // write to local injectors' ring buffer
-            samples = AudioConstants::NETWORK_FRAME_SAMPLES_STEREO;
-            _localInjectorsStream.writeSamples(_localMixBuffer,
+            samples = _localInjectorsStream.writeSamples(_localMixBuffer,
                 AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
         }
 
@@ -44,6 +44,7 @@
 #include <AudioSRC.h>
 #include <AudioInjector.h>
 #include <AudioReverb.h>
+#include <AudioSPSCRingBuffer.h>
 #include <AudioLimiter.h>
 #include <AudioConstants.h>
 #include <AudioGate.h>
@@ -88,7 +89,7 @@ class AudioClient : public AbstractAudioInterface, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
 
-    using LocalInjectorsStream = AudioMixRingBuffer;
+    using LocalInjectorsStream = AudioSPSCMixRingBuffer;
 public:
     static const int MIN_BUFFER_FRAMES;
     static const int MAX_BUFFER_FRAMES;
@@ -370,8 +371,8 @@ private:
     QIODevice* _loopbackOutputDevice{ nullptr };
     AudioRingBuffer _inputRingBuffer{ 0 };
     LocalInjectorsStream _localInjectorsStream{ 0 , 1 };
-    // In order to use _localInjectorsStream as a lock-free pipe,
-    // use it with a single producer/consumer, and track available samples and injectors
+    // _localInjectorsStream is a lock-free pipe from the injector mixing to the output device callback;
+    // track available samples separately, so that switching output devices can drain it without touching its positions
     std::atomic<int> _localSamplesAvailable { 0 };
     std::atomic<bool> _localInjectorsAvailable { false };
     MixedProcessedAudioStream _receivedAudioStream{ RECEIVED_AUDIO_STREAM_CAPACITY_FRAMES };
@@ -12,6 +12,9 @@
 
 #include "AudioDynamics.h"
 
+// frames processed in each pass of the block kernels
+static const int LIMITER_BLOCK = 256;
+
 //
 // Limiter (common)
 //
@@ -261,41 +264,50 @@ public:
 template<int N>
 void LimiterStereo<N>::process(float* input, int16_t* output, int numFrames) {
 
-    for (int n = 0; n < numFrames; n++) {
+    int32_t peak[LIMITER_BLOCK];
+    float gain[LIMITER_BLOCK];
+    float dith[LIMITER_BLOCK];
+    float delayed[2*LIMITER_BLOCK];
+
+    while (numFrames) {
+
+        int numBlockFrames = MIN(numFrames, LIMITER_BLOCK);
 
         // peak detect and convert to log2 domain
-        int32_t peak = peaklog2(&input[2*n+0], &input[2*n+1]);
+        AudioLimiterKernels::peaklog2Stereo(input, peak, numBlockFrames);
 
-        // compute limiter attenuation
-        int32_t attn = MAX(_threshold - peak, 0);
+        // the envelope, filter and delay feed back from sample to sample
+        for (int n = 0; n < numBlockFrames; n++) {
 
-        // apply envelope
-        attn = envelope(attn);
+            // compute limiter attenuation
+            int32_t attn = MAX(_threshold - peak[n], 0);
 
-        // convert from log2 domain
-        attn = fixexp2(attn);
+            // apply envelope
+            attn = envelope(attn);
 
-        // lowpass filter
-        attn = _filter.process(attn);
-        float gain = attn * _outGain;
+            // convert from log2 domain
+            attn = fixexp2(attn);
 
-        // delay audio
-        float x0 = input[2*n+0];
-        float x1 = input[2*n+1];
-        _delay.process(x0, x1);
+            // lowpass filter
+            attn = _filter.process(attn);
+            gain[n] = attn * _outGain;
 
-        // apply gain
-        x0 *= gain;
-        x1 *= gain;
+            // delay audio
+            float x0 = input[2*n+0];
+            float x1 = input[2*n+1];
+            _delay.process(x0, x1);
+            delayed[2*n+0] = x0;
+            delayed[2*n+1] = x1;
 
-        // apply dither
-        float d = dither();
-        x0 += d;
-        x1 += d;
+            dith[n] = dither();
+        }
 
-        // store 16-bit output
-        output[2*n+0] = (int16_t)floatToInt(x0);
-        output[2*n+1] = (int16_t)floatToInt(x1);
+        // apply gain and dither, and store 16-bit output
+        AudioLimiterKernels::applyGainStereo(delayed, gain, dith, output, numBlockFrames);
+
+        input += 2 * numBlockFrames;
+        output += 2 * numBlockFrames;
+        numFrames -= numBlockFrames;
     }
 }
 
@@ -364,6 +376,166 @@ void LimiterQuad<N>::process(float* input, int16_t* output, int numFrames) {
     }
 }
 
+//
+// Block kernels (stereo)
+//
+
+void AudioLimiterKernels::peaklog2Stereo_ref(const float* input, int32_t* output, int numFrames) {
+
+    for (int n = 0; n < numFrames; n++) {
+        output[n] = peaklog2((float*)&input[2*n+0], (float*)&input[2*n+1]);
+    }
+}
+
+void AudioLimiterKernels::applyGainStereo_ref(const float* input, const float* gain, const float* dither,
+                                              int16_t* output, int numFrames) {
+
+    for (int n = 0; n < numFrames; n++) {
+
+        // apply gain
+        float x0 = input[2*n+0] * gain[n];
+        float x1 = input[2*n+1] * gain[n];
+
+        // apply dither
+        x0 += dither[n];
+        x1 += dither[n];
+
+        // store 16-bit output
+        output[2*n+0] = (int16_t)floatToInt(x0);
+        output[2*n+1] = (int16_t)floatToInt(x1);
+    }
+}
+
+//
+// on x86 architecture, assume that SSE2 is present
+//
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+// high part of the signed 32x32 products, for x >= 0
+static inline __m128i mulhi_epi32(__m128i a, __m128i x) {
+
+    // unsigned products of the even and odd elements
+    __m128i even = _mm_mul_epu32(a, x);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(x, 32));
+    __m128i hi = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0)));
+
+    // correct for negative a
+    return _mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(a, 31), x));
+}
+
+static inline __m128i max_epi32(__m128i a, __m128i b) {
+    __m128i mask = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static void peaklog2Stereo_SSE(const float* input, int32_t* output, int numFrames) {
+
+    const __m128i fabsMask = _mm_set1_epi32(IEEE754_FABS_MASK);
+
+    int n = 0;
+    for (; n < numFrames - 3; n += 4) {
+
+        __m128i a0 = _mm_and_si128(_mm_loadu_si128((__m128i*)&input[2*n+0]), fabsMask);
+        __m128i a1 = _mm_and_si128(_mm_loadu_si128((__m128i*)&input[2*n+4]), fabsMask);
+
+        // max absolute value of each frame
+        a0 = max_epi32(a0, _mm_shuffle_epi32(a0, _MM_SHUFFLE(2,3,0,1)));
+        a1 = max_epi32(a1, _mm_shuffle_epi32(a1, _MM_SHUFFLE(2,3,0,1)));
+        __m128i peak = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a0), _mm_castsi128_ps(a1), _MM_SHUFFLE(2,0,2,0)));
+
+        // split into e and x - 1.0
+        __m128i e = _mm_sub_epi32(_mm_set1_epi32(IEEE754_EXPN_BIAS + LOG2_HEADROOM), _mm_srli_epi32(peak, IEEE754_MANT_BITS));
+        __m128i x = _mm_and_si128(_mm_slli_epi32(peak, IEEE754_EXPN_BITS), _mm_set1_epi32(0x7fffffff));
+
+        int32_t k[4];
+        _mm_storeu_si128((__m128i*)k, _mm_srli_epi32(x, 31 - LOG2_TABBITS));
+
+        // polynomial for log2(1+x) over x=[0,1]
+        __m128i c0 = _mm_setr_epi32(log2Table[k[0]][0], log2Table[k[1]][0], log2Table[k[2]][0], log2Table[k[3]][0]);
+        __m128i c1 = _mm_setr_epi32(log2Table[k[0]][1], log2Table[k[1]][1], log2Table[k[2]][1], log2Table[k[3]][1]);
+        __m128i c2 = _mm_setr_epi32(log2Table[k[0]][2], log2Table[k[1]][2], log2Table[k[2]][2], log2Table[k[3]][2]);
+
+        c1 = _mm_add_epi32(c1, mulhi_epi32(c0, x));
+        c2 = _mm_add_epi32(c2, mulhi_epi32(c1, x));
+
+        // reconstruct result in Q26
+        __m128i result = _mm_sub_epi32(_mm_slli_epi32(e, LOG2_FRACBITS), _mm_srai_epi32(c2, 3));
+
+        // saturate when e > 31 or e < 0
+        __m128i over = _mm_cmpgt_epi32(e, _mm_set1_epi32(31));
+        __m128i under = _mm_cmplt_epi32(e, _mm_setzero_si128());
+        result = _mm_andnot_si128(_mm_or_si128(over, under), result);
+        result = _mm_or_si128(result, _mm_and_si128(over, _mm_set1_epi32(0x7fffffff)));
+
+        _mm_storeu_si128((__m128i*)&output[n], result);
+    }
+    AudioLimiterKernels::peaklog2Stereo_ref(&input[2*n], &output[n], numFrames - n);
+}
+
+static void applyGainStereo_SSE(const float* input, const float* gain, const float* dither,
+                                int16_t* output, int numFrames) {
+
+    int n = 0;
+    for (; n < numFrames - 3; n += 4) {
+
+        __m128 g = _mm_loadu_ps(&gain[n]);
+        __m128 d = _mm_loadu_ps(&dither[n]);
+
+        __m128 x0 = _mm_loadu_ps(&input[2*n+0]);
+        __m128 x1 = _mm_loadu_ps(&input[2*n+4]);
+
+        // apply gain and dither
+        x0 = _mm_add_ps(_mm_mul_ps(x0, _mm_unpacklo_ps(g, g)), _mm_unpacklo_ps(d, d));
+        x1 = _mm_add_ps(_mm_mul_ps(x1, _mm_unpackhi_ps(g, g)), _mm_unpackhi_ps(d, d));
+
+        // round, and keep the low 16 bits like the scalar cast
+        __m128i a0 = _mm_cvtps_epi32(x0);
+        __m128i a1 = _mm_cvtps_epi32(x1);
+        a0 = _mm_srai_epi32(_mm_slli_epi32(a0, 16), 16);
+        a1 = _mm_srai_epi32(_mm_slli_epi32(a1, 16), 16);
+
+        _mm_storeu_si128((__m128i*)&output[2*n], _mm_packs_epi32(a0, a1));
+    }
+    AudioLimiterKernels::applyGainStereo_ref(&input[2*n], &gain[n], &dither[n], &output[2*n], numFrames - n);
+}
+
+//
+// Runtime CPU dispatch
+//
+
+#include "CPUDetect.h"
+
+void peaklog2Stereo_AVX2(const float* input, int32_t* output, int numFrames);
+void peaklog2Stereo_AVX512(const float* input, int32_t* output, int numFrames);
+void applyGainStereo_AVX2(const float* input, const float* gain, const float* dither, int16_t* output, int numFrames);
+void applyGainStereo_AVX512(const float* input, const float* gain, const float* dither, int16_t* output, int numFrames);
+
+void AudioLimiterKernels::peaklog2Stereo(const float* input, int32_t* output, int numFrames) {
+    static auto f = cpuSupportsAVX512() ? peaklog2Stereo_AVX512 : (cpuSupportsAVX2() ? peaklog2Stereo_AVX2 : peaklog2Stereo_SSE);
+    (*f)(input, output, numFrames); // dispatch
+}
+
+void AudioLimiterKernels::applyGainStereo(const float* input, const float* gain, const float* dither,
+                                          int16_t* output, int numFrames) {
+    static auto f = cpuSupportsAVX512() ? applyGainStereo_AVX512 : (cpuSupportsAVX2() ? applyGainStereo_AVX2 : applyGainStereo_SSE);
+    (*f)(input, gain, dither, output, numFrames); // dispatch
+}
+
+#else   // portable reference code
+
+void AudioLimiterKernels::peaklog2Stereo(const float* input, int32_t* output, int numFrames) {
+    peaklog2Stereo_ref(input, output, numFrames);
+}
+
+void AudioLimiterKernels::applyGainStereo(const float* input, const float* gain, const float* dither,
+                                          int16_t* output, int numFrames) {
+    applyGainStereo_ref(input, gain, dither, output, numFrames);
+}
+
+#endif
+
 //
 // Public API
 //
@@ -27,4 +27,20 @@ private:
     LimiterImpl* _impl;
 };
 
+//
+// Block kernels of the stereo limiter.
+// The dispatched versions run the SSE2, AVX2 or AVX-512 code the CPU supports, and give results identical to
+// the portable _ref versions, which are exposed so tests can check that.
+//
+namespace AudioLimiterKernels {
+
+    // -log2 of the peak of each interleaved stereo frame, in the limiter's Q26 log2 domain
+    void peaklog2Stereo(const float* input, int32_t* output, int numFrames);
+    void peaklog2Stereo_ref(const float* input, int32_t* output, int numFrames);
+
+    // output = (int16_t)round(input * gain + dither), with one gain and dither per interleaved stereo frame
+    void applyGainStereo(const float* input, const float* gain, const float* dither, int16_t* output, int numFrames);
+    void applyGainStereo_ref(const float* input, const float* gain, const float* dither, int16_t* output, int numFrames);
+}
+
 #endif // hifi_AudioLimiter_h
@@ -0,0 +1,222 @@
+//
+//  AudioSPSCRingBuffer.cpp
+//  libraries/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSPSCRingBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+template <class T>
+AudioSPSCRingBufferTemplate<T>::AudioSPSCRingBufferTemplate(int numFrameSamples, int numFramesCapacity) :
+    _numFrameSamples(numFrameSamples),
+    _frameCapacity(numFramesCapacity),
+    _sampleCapacity(numFrameSamples * numFramesCapacity)
+{
+    if (_sampleCapacity) {
+        _buffer = new Sample[_sampleCapacity];
+        memset(_buffer, 0, _sampleCapacity * SampleSize);
+    }
+}
+
+template <class T>
+AudioSPSCRingBufferTemplate<T>::~AudioSPSCRingBufferTemplate() {
+    delete[] _buffer;
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::clear() {
+    _writeIndex.store(0, std::memory_order_relaxed);
+    _readIndex.store(0, std::memory_order_relaxed);
+    _cachedReadIndex = 0;
+    _cachedWriteIndex = 0;
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::reset() {
+    clear();
+    _overflowCount.store(0, std::memory_order_relaxed);
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::resizeForFrameSize(int numFrameSamples) {
+    delete[] _buffer;
+    _numFrameSamples = numFrameSamples;
+    _sampleCapacity = numFrameSamples * _frameCapacity;
+
+    if (_sampleCapacity) {
+        _buffer = new Sample[_sampleCapacity];
+        memset(_buffer, 0, _sampleCapacity * SampleSize);
+    } else {
+        _buffer = nullptr;
+    }
+
+    reset();
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::roomFor(Index writeIndex, int numSamples) {
+    int room = _sampleCapacity - (int)(writeIndex - _cachedReadIndex);
+    if (room < numSamples) {
+        _cachedReadIndex = _readIndex.load(std::memory_order_acquire);
+        room = _sampleCapacity - (int)(writeIndex - _cachedReadIndex);
+    }
+    return room;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::availableFor(Index readIndex, int numSamples) {
+    int available = (int)(_cachedWriteIndex - readIndex);
+    if (available < numSamples) {
+        _cachedWriteIndex = _writeIndex.load(std::memory_order_acquire);
+        available = (int)(_cachedWriteIndex - readIndex);
+    }
+    return available;
+}
+
+template <class T>
+template <class Copy>
+void AudioSPSCRingBufferTemplate<T>::writeWrapped(Index writeIndex, int numSamples, Copy copy) {
+    int offset = (int)(writeIndex % (Index)_sampleCapacity);
+    int numSamplesToEnd = std::min(numSamples, _sampleCapacity - offset);
+
+    // write to the end of the buffer, then the rest to the beginning
+    copy(_buffer + offset, 0, numSamplesToEnd);
+    if (numSamples > numSamplesToEnd) {
+        copy(_buffer, numSamplesToEnd, numSamples - numSamplesToEnd);
+    }
+
+    // publish the samples to the consumer
+    _writeIndex.store(writeIndex + numSamples, std::memory_order_release);
+}
+
+template <class T>
+template <class Copy>
+void AudioSPSCRingBufferTemplate<T>::readWrapped(Index readIndex, int numSamples, Copy copy) {
+    int offset = (int)(readIndex % (Index)_sampleCapacity);
+    int numSamplesToEnd = std::min(numSamples, _sampleCapacity - offset);
+
+    // read to the end of the buffer, then the rest from the beginning
+    copy(_buffer + offset, 0, numSamplesToEnd);
+    if (numSamples > numSamplesToEnd) {
+        copy(_buffer, numSamplesToEnd, numSamples - numSamplesToEnd);
+    }
+
+    // hand the room back to the producer
+    _readIndex.store(readIndex + numSamples, std::memory_order_release);
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::writeSamples(const Sample* source, int maxSamples) {
+    if (maxSamples <= 0 || _sampleCapacity == 0) {
+        return 0;
+    }
+
+    Index writeIndex = _writeIndex.load(std::memory_order_relaxed);
+    int numWriteSamples = std::min(maxSamples, roomFor(writeIndex, maxSamples));
+    if (numWriteSamples < maxSamples) {
+        _overflowCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    writeWrapped(writeIndex, numWriteSamples, [&](Sample* at, int sourceOffset, int numSamples) {
+        memcpy(at, source + sourceOffset, numSamples * SampleSize);
+    });
+
+    return numWriteSamples;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::addSilentSamples(int maxSamples) {
+    if (maxSamples <= 0 || _sampleCapacity == 0) {
+        return 0;
+    }
+
+    // silence is droppable, so running out of room for it isn't an overflow
+    Index writeIndex = _writeIndex.load(std::memory_order_relaxed);
+    int numWriteSamples = std::min(maxSamples, roomFor(writeIndex, maxSamples));
+
+    writeWrapped(writeIndex, numWriteSamples, [&](Sample* at, int sourceOffset, int numSamples) {
+        memset(at, 0, numSamples * SampleSize);
+    });
+
+    return numWriteSamples;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::writeData(const char* source, int maxSize) {
+    return writeSamples((const Sample*)source, maxSize / SampleSize) * SampleSize;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::readSamples(Sample* destination, int maxSamples) {
+    if (maxSamples <= 0 || _sampleCapacity == 0) {
+        return 0;
+    }
+
+    Index readIndex = _readIndex.load(std::memory_order_relaxed);
+    int numReadSamples = std::min(maxSamples, availableFor(readIndex, maxSamples));
+
+    readWrapped(readIndex, numReadSamples, [&](const Sample* at, int destinationOffset, int numSamples) {
+        memcpy(destination + destinationOffset, at, numSamples * SampleSize);
+    });
+
+    return numReadSamples;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::appendSamples(Sample* destination, int maxSamples, bool append) {
+    if (!append) {
+        return readSamples(destination, maxSamples);
+    }
+    if (maxSamples <= 0 || _sampleCapacity == 0) {
+        return 0;
+    }
+
+    Index readIndex = _readIndex.load(std::memory_order_relaxed);
+    int numReadSamples = std::min(maxSamples, availableFor(readIndex, maxSamples));
+
+    readWrapped(readIndex, numReadSamples, [&](const Sample* at, int destinationOffset, int numSamples) {
+        Sample* dest = destination + destinationOffset;
+        for (int i = 0; i < numSamples; i++) {
+            dest[i] += at[i];
+        }
+    });
+
+    return numReadSamples;
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::skipSamples(int maxSamples) {
+    if (maxSamples <= 0 || _sampleCapacity == 0) {
+        return;
+    }
+
+    Index readIndex = _readIndex.load(std::memory_order_relaxed);
+    int numSkipSamples = std::min(maxSamples, availableFor(readIndex, maxSamples));
+
+    _readIndex.store(readIndex + numSkipSamples, std::memory_order_release);
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::readData(char* destination, int maxSize) {
+    return readSamples((Sample*)destination, maxSize / SampleSize) * SampleSize;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::samplesAvailable() const {
+    // load the read position first, so it can only have moved on (not back) by the time the write position is loaded
+    Index readIndex = _readIndex.load(std::memory_order_acquire);
+    Index writeIndex = _writeIndex.load(std::memory_order_acquire);
+    return std::min((int)(writeIndex - readIndex), _sampleCapacity);
+}
+
+// explicit instantiations for scratch/mix buffers
+template class AudioSPSCRingBufferTemplate<int16_t>;
+template class AudioSPSCRingBufferTemplate<float>;
@@ -0,0 +1,126 @@
+//
+//  AudioSPSCRingBuffer.h
+//  libraries/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSPSCRingBuffer_h
+#define hifi_AudioSPSCRingBuffer_h
+
+#include <atomic>
+#include <cstdint>
+
+#include "AudioRingBuffer.h"
+
+// Single-producer single-consumer variant of AudioRingBuffer, for handing audio between two threads without a lock.
+//   One thread may write while one other thread reads; neither ever waits on the other.
+//   Unlike AudioRingBuffer, a write that doesn't fit never overwrites unread samples (that would move the reader),
+//   it writes what fits and counts an overflow instead.
+//   The write and read positions are free-running counters, each on its own cache line with the producer's and
+//   consumer's cached copy of the other's position, so the two sides only share a line when one has to catch up.
+//   clear() and resizeForFrameSize() must only be called while neither side is running.
+template <class T>
+class AudioSPSCRingBufferTemplate {
+    using Sample = T;
+    static const int SampleSize = sizeof(Sample);
+
+public:
+    AudioSPSCRingBufferTemplate(int numFrameSamples, int numFramesCapacity = DEFAULT_RING_BUFFER_FRAME_CAPACITY);
+    ~AudioSPSCRingBufferTemplate();
+
+    // disallow copying
+    AudioSPSCRingBufferTemplate(const AudioSPSCRingBufferTemplate&) = delete;
+    AudioSPSCRingBufferTemplate(AudioSPSCRingBufferTemplate&&) = delete;
+    AudioSPSCRingBufferTemplate& operator=(const AudioSPSCRingBufferTemplate&) = delete;
+
+    /// Invalidate any data in the buffer
+    void clear();
+
+    /// Clear and reset the overflow count
+    void reset();
+
+    /// Resize frame size (causes a reset())
+    void resizeForFrameSize(int numFrameSamples);
+
+    // producer
+
+    /// Write up to maxSamples from source (will only write up to the room left)
+    /// Returns number of written samples
+    int writeSamples(const Sample* source, int maxSamples);
+
+    /// Write up to maxSamples silent samples (will only write up to the room left)
+    /// Returns number of written silent samples
+    int addSilentSamples(int maxSamples);
+
+    /// Write up to maxSize from source
+    /// Returns number of written bytes
+    int writeData(const char* source, int maxSize);
+
+    // consumer
+
+    /// Read up to maxSamples into destination (will only read up to samplesAvailable())
+    /// Returns number of read samples
+    int readSamples(Sample* destination, int maxSamples);
+
+    /// Append up to maxSamples into destination (will only read up to samplesAvailable())
+    /// If append == false, behaves as readSamples
+    /// Returns number of appended samples
+    int appendSamples(Sample* destination, int maxSamples, bool append = true);
+
+    /// Skip up to maxSamples (will only skip up to samplesAvailable())
+    void skipSamples(int maxSamples);
+
+    /// Read up to maxSize into destination
+    /// Returns number of read bytes
+    int readData(char* destination, int maxSize);
+
+    // either side, the count may already be stale by the time it returns:
+    // the producer can always write at least getSampleCapacity() - samplesAvailable() samples,
+    // and the consumer can always read at least samplesAvailable() samples
+    int samplesAvailable() const;
+    int framesAvailable() const { return (_numFrameSamples == 0) ? 0 : samplesAvailable() / _numFrameSamples; }
+
+    int getNumFrameSamples() const { return _numFrameSamples; }
+    int getFrameCapacity() const { return _frameCapacity; }
+    int getSampleCapacity() const { return _sampleCapacity; }
+    /// Return times a write was cut short because the buffer was full
+    int getOverflowCount() const { return _overflowCount.load(std::memory_order_relaxed); }
+
+private:
+    using Index = uint64_t; // wide enough never to wrap, so the modulo of the position is always continuous
+
+    // the room the producer has to write, reloading the read position only if the cached one doesn't leave enough
+    int roomFor(Index writeIndex, int numSamples);
+    // the samples the consumer has to read, reloading the write position only if the cached one doesn't have enough
+    int availableFor(Index readIndex, int numSamples);
+
+    template <class Copy>
+    void writeWrapped(Index writeIndex, int numSamples, Copy copy);
+    template <class Copy>
+    void readWrapped(Index readIndex, int numSamples, Copy copy);
+
+    int _numFrameSamples;
+    int _frameCapacity;
+    int _sampleCapacity;
+    Sample* _buffer { nullptr };
+
+    // written by the producer
+    alignas(64) std::atomic<Index> _writeIndex { 0 };
+    Index _cachedReadIndex { 0 };
+    std::atomic<int> _overflowCount { 0 };
+
+    // written by the consumer
+    alignas(64) std::atomic<Index> _readIndex { 0 };
+    Index _cachedWriteIndex { 0 };
+};
+
+// expose explicit instantiations for scratch/mix buffers
+using AudioSPSCRingBuffer = AudioSPSCRingBufferTemplate<int16_t>;
+using AudioSPSCMixRingBuffer = AudioSPSCRingBufferTemplate<float>;
+
+#endif // hifi_AudioSPSCRingBuffer_h
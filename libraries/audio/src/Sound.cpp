@@ -18,11 +18,13 @@
 #include <QRunnable>
 #include <QThreadPool>
 #include <QDataStream>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDebug>
 #include <QtNetwork/QNetworkRequest>
 #include <QtNetwork/QNetworkReply>
 #include <qendian.h>
 
+#include <DependencyManager.h>
 #include <LimitedNodeList.h>
 #include <NetworkAccessManager.h>
 #include <SharedUtil.h>
@@ -30,6 +32,8 @@
 #include "AudioRingBuffer.h"
 #include "AudioLogging.h"
 #include "AudioSRC.h"
+#include "SoundCache.h"
+#include "SoundFileCache.h"
 
 #include "flump3dec.h"
 
@@ -63,20 +67,36 @@ AudioDataPointer AudioData::make(uint32_t numSamples, uint32_t numChannels,
 }
 
 
+AudioDataPointer AudioData::make(uint32_t numChannels, storage::StoragePointer samples) {
+    return AudioDataPointer(new AudioData(numChannels, std::move(samples)));
+}
+
 AudioData::AudioData(uint32_t numSamples, uint32_t numChannels, const AudioSample* samples)
     : _numSamples(numSamples),
       _numChannels(numChannels),
       _data(samples)
 {}
 
+AudioData::AudioData(uint32_t numChannels, storage::StoragePointer samples)
+    : _numSamples((uint32_t)(samples->size() / sizeof(AudioSample))),
+      _numChannels(numChannels),
+      _data(reinterpret_cast<const AudioSample*>(samples->data())),
+      _storage(std::move(samples))
+{}
+
 void Sound::downloadFinished(const QByteArray& data) {
     if (!_self) {
         soundProcessError(301, "Sound object has gone out of scope");
         return;
     }
 
+    std::shared_ptr<SoundFileCache> soundFileCache;
+    if (DependencyManager::isSet<SoundCache>()) {
+        soundFileCache = DependencyManager::get<SoundCache>()->getSoundFileCache();
+    }
+
     // this is a QRunnable, will delete itself after it has finished running
-    auto soundProcessor = new SoundProcessor(_self, data);
+    auto soundProcessor = new SoundProcessor(_self, data, soundFileCache);
     connect(soundProcessor, &SoundProcessor::onSuccess, this, &Sound::soundProcessSuccess);
     connect(soundProcessor, &SoundProcessor::onError, this, &Sound::soundProcessError);
     QThreadPool::globalInstance()->start(soundProcessor);
@@ -98,9 +118,11 @@ void Sound::soundProcessError(int error, QString str) {
 }
 
 
-SoundProcessor::SoundProcessor(QWeakPointer<Resource> sound, QByteArray data) :
+SoundProcessor::SoundProcessor(QWeakPointer<Resource> sound, QByteArray data,
+                               std::shared_ptr<SoundFileCache> soundFileCache) :
     _sound(sound),
-    _data(data)
+    _data(data),
+    _soundFileCache(soundFileCache)
 {
 }
 
@@ -115,6 +137,18 @@ void SoundProcessor::run() {
     QString fileName = url.fileName().toLower();
     qCDebug(audio) << "Processing sound file" << fileName;
 
+    // a sound that was decoded before (by any process) is mapped from the sound file cache instead of decoded again
+    QByteArray sourceHash;
+    if (_soundFileCache) {
+        sourceHash = QCryptographicHash::hash(_data, QCryptographicHash::Md5);
+        auto audioData = _soundFileCache->getAudioData(url, sourceHash);
+        if (audioData) {
+            qCDebug(audio) << "Mapped decoded sound file" << fileName << "from the sound file cache";
+            emit onSuccess(audioData);
+            return;
+        }
+    }
+
     static const QString WAV_EXTENSION = ".wav";
     static const QString MP3_EXTENSION = ".mp3";
     static const QString RAW_EXTENSION = ".raw";
@@ -157,9 +191,16 @@ void SoundProcessor::run() {
 
     auto data = downSample(outputAudioByteArray, properties);
 
-    int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
-    auto audioData = AudioData::make(numSamples, properties.numChannels,
-                                     (const AudioSample*)data.constData());
+    AudioDataPointer audioData;
+    if (_soundFileCache) {
+        // keep the decoded sound in the cache, and play it mapped from there rather than from a copy in memory
+        audioData = _soundFileCache->cacheAudioData(url, sourceHash, properties.numChannels, data);
+    }
+    if (!audioData) {
+        int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
+        audioData = AudioData::make(numSamples, properties.numChannels,
+                                    (const AudioSample*)data.constData());
+    }
     emit onSuccess(audioData);
 }
 
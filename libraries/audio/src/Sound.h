@@ -18,6 +18,7 @@
 #include <QtScript/qscriptengine.h>
 
 #include <ResourceCache.h>
+#include <shared/Storage.h>
 
 #include "AudioConstants.h"
 
@@ -37,6 +38,9 @@ public:
     static AudioDataPointer make(uint32_t numSamples, uint32_t numChannels,
                                  const AudioSample* samples);
 
+    // Uses the samples in place (for example, mapped from the sound file cache), keeping the storage alive
+    static AudioDataPointer make(uint32_t numChannels, storage::StoragePointer samples);
+
     uint32_t getNumSamples() const { return _numSamples; }
     uint32_t getNumChannels() const { return _numChannels; }
     const AudioSample* data() const { return _data; }
@@ -50,10 +54,12 @@ public:
 
 private:
     AudioData(uint32_t numSamples, uint32_t numChannels, const AudioSample* samples);
+    AudioData(uint32_t numChannels, storage::StoragePointer samples);
 
     const uint32_t _numSamples { 0 };
     const uint32_t _numChannels { 0 };
     const AudioSample* const _data { nullptr };
+    const storage::StoragePointer _storage;
 };
 
 class Sound : public Resource {
@@ -89,6 +95,8 @@ private:
     int _numChannels { 0 };
 };
 
+class SoundFileCache;
+
 class SoundProcessor : public QObject, public QRunnable {
     Q_OBJECT
 
@@ -98,7 +106,7 @@ public:
         uint32_t sampleRate { 0 };
     };
 
-    SoundProcessor(QWeakPointer<Resource> sound, QByteArray data);
+    SoundProcessor(QWeakPointer<Resource> sound, QByteArray data, std::shared_ptr<SoundFileCache> soundFileCache);
 
     virtual void run() override;
 
@@ -116,6 +124,7 @@ signals:
 private:
     const QWeakPointer<Resource> _sound;
     const QByteArray _data;
+    const std::shared_ptr<SoundFileCache> _soundFileCache;
 };
 
 typedef QSharedPointer<Sound> SharedSoundPointer;
@@ -19,6 +19,9 @@
 
 static const int SOUNDS_LOADING_PRIORITY { -7 }; // Make sure sounds load after the low rez texture mips
 
+const std::string SoundCache::SOUND_FILE_CACHE_DIRNAME { "sound_cache" };
+const std::string SoundCache::SOUND_FILE_CACHE_EXT { "pcm" };
+
 int soundPointerMetaTypeId = qRegisterMetaType<SharedSoundPointer>();
 
 SoundCache::SoundCache(QObject* parent) :
@@ -27,6 +30,10 @@ SoundCache::SoundCache(QObject* parent) :
     const qint64 SOUND_DEFAULT_UNUSED_MAX_SIZE = 50 * BYTES_PER_MEGABYTES;
     setUnusedResourceCacheSize(SOUND_DEFAULT_UNUSED_MAX_SIZE);
     setObjectName("SoundCache");
+
+    const size_t SOUND_FILE_CACHE_MAX_SIZE = 512 * BYTES_PER_MEGABYTES;
+    _soundFileCache->initialize();
+    _soundFileCache->setMaxSize(SOUND_FILE_CACHE_MAX_SIZE);
 }
 
 SharedSoundPointer SoundCache::getSound(const QUrl& url) {
@@ -15,6 +15,7 @@
 #include <ResourceCache.h>
 
 #include "Sound.h"
+#include "SoundFileCache.h"
 
 class SoundCache : public ResourceCache, public Dependency {
     Q_OBJECT
@@ -23,12 +24,20 @@ class SoundCache : public ResourceCache, public Dependency {
 public:
     Q_INVOKABLE SharedSoundPointer getSound(const QUrl& url);
 
+    const std::shared_ptr<SoundFileCache>& getSoundFileCache() const { return _soundFileCache; }
+
 protected:
     virtual QSharedPointer<Resource> createResource(const QUrl& url) override;
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
 
 private:
     SoundCache(QObject* parent = NULL);
+
+    static const std::string SOUND_FILE_CACHE_DIRNAME;
+    static const std::string SOUND_FILE_CACHE_EXT;
+    std::shared_ptr<SoundFileCache> _soundFileCache {
+        std::make_shared<SoundFileCache>(SOUND_FILE_CACHE_DIRNAME, SOUND_FILE_CACHE_EXT)
+    };
 };
 
 #endif // hifi_SoundCache_h
@@ -0,0 +1,123 @@
+//
+//  SoundFileCache.cpp
+//  libraries/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SoundFileCache.h"
+
+#include <cstring>
+
+#include <QtCore/QCryptographicHash>
+
+#include <shared/Storage.h>
+
+#include "AudioLogging.h"
+
+using FilePointer = cache::FilePointer;
+
+const uint32_t SoundFileCache::CURRENT_VERSION = 0x01;
+
+namespace {
+
+const char FILE_MAGIC[4] = { 'H', 'P', 'C', 'M' };
+const int SOURCE_HASH_SIZE = 16; // md5
+
+// precedes the samples, which are interleaved 16 bit PCM at the network sample rate
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t numChannels;
+    uint32_t numSamples;
+    char sourceHash[SOURCE_HASH_SIZE];
+};
+static_assert(sizeof(FileHeader) == 32, "FileHeader must stay packed, it is read in place from the cache files");
+
+// maps a cache file, keeping its cache entry alive (and so on disk) for as long as the file is mapped
+class SoundFileStorage : public storage::FileStorage {
+public:
+    SoundFileStorage(const FilePointer& file) :
+        FileStorage(QString::fromStdString(file->getFilepath())),
+        _file(file) {}
+
+private:
+    const FilePointer _file;
+};
+
+}
+
+SoundFileCache::SoundFileCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+SoundFileCache::Key SoundFileCache::getKey(const QUrl& url, const QByteArray& sourceHash) {
+    auto urlHash = QCryptographicHash::hash(url.toEncoded(), QCryptographicHash::Md5);
+    return (urlHash.toHex() + "_" + sourceHash.toHex()).toStdString();
+}
+
+AudioDataPointer SoundFileCache::getAudioData(const QUrl& url, const QByteArray& sourceHash) {
+    auto file = getFile(getKey(url, sourceHash));
+    if (!file) {
+        return AudioDataPointer();
+    }
+
+    auto audioData = mapFile(file, sourceHash);
+    if (!audioData) {
+        qCWarning(audio) << "Ignoring invalid sound cache file" << file->getFilepath().c_str();
+    }
+    return audioData;
+}
+
+AudioDataPointer SoundFileCache::cacheAudioData(const QUrl& url, const QByteArray& sourceHash, uint32_t numChannels,
+                                                const QByteArray& samples) {
+    if (sourceHash.size() != SOURCE_HASH_SIZE || samples.isEmpty()) {
+        return AudioDataPointer();
+    }
+
+    FileHeader header;
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = CURRENT_VERSION;
+    header.numChannels = numChannels;
+    header.numSamples = (uint32_t)(samples.size() / sizeof(AudioSample));
+    memcpy(header.sourceHash, sourceHash.constData(), SOURCE_HASH_SIZE);
+
+    size_t samplesSize = header.numSamples * sizeof(AudioSample);
+    QByteArray contents;
+    contents.reserve((int)(sizeof(FileHeader) + samplesSize));
+    contents.append(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+    contents.append(samples.constData(), (int)samplesSize);
+
+    auto file = writeFile(contents.constData(), Metadata(getKey(url, sourceHash), contents.size()));
+    if (!file) {
+        return AudioDataPointer();
+    }
+    return mapFile(file, sourceHash);
+}
+
+AudioDataPointer SoundFileCache::mapFile(const FilePointer& file, const QByteArray& sourceHash) {
+    auto storage = std::make_shared<SoundFileStorage>(file);
+    if (!*storage || storage->size() < sizeof(FileHeader)) {
+        return AudioDataPointer();
+    }
+
+    FileHeader header;
+    memcpy(&header, storage->data(), sizeof(FileHeader));
+
+    bool isValid = memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0
+        && header.version == CURRENT_VERSION
+        && (header.numChannels == 1 || header.numChannels == 2 || header.numChannels == 4)
+        && header.numSamples > 0
+        && storage->size() == sizeof(FileHeader) + (size_t)header.numSamples * sizeof(AudioSample)
+        && sourceHash.size() == SOURCE_HASH_SIZE
+        && memcmp(header.sourceHash, sourceHash.constData(), SOURCE_HASH_SIZE) == 0;
+    if (!isValid) {
+        return AudioDataPointer();
+    }
+
+    auto samples = storage->createView(header.numSamples * sizeof(AudioSample), sizeof(FileHeader));
+    return AudioData::make(header.numChannels, samples);
+}
@@ -0,0 +1,51 @@
+//
+//  SoundFileCache.h
+//  libraries/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SoundFileCache_h
+#define hifi_SoundFileCache_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUrl>
+
+#include <shared/FileCache.h>
+
+#include "Sound.h"
+
+// Keeps sounds on disk already decoded and resampled to the network sample rate, so that a sound that was played
+//   before is mapped straight from its cache file instead of being decoded again.
+//   Mapped sounds are backed by the file rather than by each process's heap, so every injector playing a sound, in
+//   every process on the machine, reads the same pages.
+//   Entries are keyed by both the url and a hash of the downloaded data, so a sound that changes at its url gets a
+//   new entry rather than overwriting a file that may still be mapped.
+class SoundFileCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the layout of the sound cache files that isn't backward compatible,
+    // this value should be incremented.  Files written with any other version are ignored
+    static const uint32_t CURRENT_VERSION;
+
+    SoundFileCache(const std::string& dir, const std::string& ext);
+
+    // returns the decoded sound mapped from the cache, or null if it isn't cached
+    AudioDataPointer getAudioData(const QUrl& url, const QByteArray& sourceHash);
+
+    // writes the decoded samples to the cache and returns them mapped from there, or null if they couldn't be cached
+    AudioDataPointer cacheAudioData(const QUrl& url, const QByteArray& sourceHash, uint32_t numChannels,
+                                    const QByteArray& samples);
+
+private:
+    static Key getKey(const QUrl& url, const QByteArray& sourceHash);
+
+    AudioDataPointer mapFile(const cache::FilePointer& file, const QByteArray& sourceHash);
+};
+
+#endif // hifi_SoundFileCache_h
@@ -0,0 +1,115 @@
+//
+//  AudioLimiter_avx2.cpp
+//  libraries/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+#include "../AudioDynamics.h"
+#include "../AudioLimiter.h"
+
+// results must match the reference code exactly, so never fuse the multiply and add into an FMA
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+// high part of the signed 32x32 products
+static inline __m256i mulhi_epi32(__m256i a, __m256i b) {
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, odd, 0xaa);
+}
+
+void peaklog2Stereo_AVX2(const float* input, int32_t* output, int numFrames) {
+
+    const __m256i fabsMask = _mm256_set1_epi32(IEEE754_FABS_MASK);
+
+    int n = 0;
+    for (; n < numFrames - 7; n += 8) {
+
+        __m256i a0 = _mm256_and_si256(_mm256_loadu_si256((__m256i*)&input[2*n+0]), fabsMask);
+        __m256i a1 = _mm256_and_si256(_mm256_loadu_si256((__m256i*)&input[2*n+8]), fabsMask);
+
+        // max absolute value of each frame
+        a0 = _mm256_max_epi32(a0, _mm256_shuffle_epi32(a0, _MM_SHUFFLE(2,3,0,1)));
+        a1 = _mm256_max_epi32(a1, _mm256_shuffle_epi32(a1, _MM_SHUFFLE(2,3,0,1)));
+        __m256i peak = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a0), _mm256_castsi256_ps(a1),
+                                                             _MM_SHUFFLE(2,0,2,0)));
+
+        // frames are in lanes as (0,1,4,5) (2,3,6,7), put them back in order
+        peak = _mm256_permute4x64_epi64(peak, _MM_SHUFFLE(3,1,2,0));
+
+        // split into e and x - 1.0
+        __m256i e = _mm256_sub_epi32(_mm256_set1_epi32(IEEE754_EXPN_BIAS + LOG2_HEADROOM),
+                                     _mm256_srli_epi32(peak, IEEE754_MANT_BITS));
+        __m256i x = _mm256_and_si256(_mm256_slli_epi32(peak, IEEE754_EXPN_BITS), _mm256_set1_epi32(0x7fffffff));
+
+        __m256i k = _mm256_srli_epi32(x, 31 - LOG2_TABBITS);
+        k = _mm256_add_epi32(k, _mm256_slli_epi32(k, 1));   // row offset, 3 coefs per row
+
+        // polynomial for log2(1+x) over x=[0,1]
+        __m256i c0 = _mm256_i32gather_epi32(&log2Table[0][0], k, 4);
+        __m256i c1 = _mm256_i32gather_epi32(&log2Table[0][1], k, 4);
+        __m256i c2 = _mm256_i32gather_epi32(&log2Table[0][2], k, 4);
+
+        c1 = _mm256_add_epi32(c1, mulhi_epi32(c0, x));
+        c2 = _mm256_add_epi32(c2, mulhi_epi32(c1, x));
+
+        // reconstruct result in Q26
+        __m256i result = _mm256_sub_epi32(_mm256_slli_epi32(e, LOG2_FRACBITS), _mm256_srai_epi32(c2, 3));
+
+        // saturate when e > 31 or e < 0
+        __m256i over = _mm256_cmpgt_epi32(e, _mm256_set1_epi32(31));
+        __m256i under = _mm256_cmpgt_epi32(_mm256_setzero_si256(), e);
+        result = _mm256_blendv_epi8(result, _mm256_set1_epi32(0x7fffffff), over);
+        result = _mm256_andnot_si256(under, result);
+
+        _mm256_storeu_si256((__m256i*)&output[n], result);
+    }
+    AudioLimiterKernels::peaklog2Stereo_ref(&input[2*n], &output[n], numFrames - n);
+}
+
+void applyGainStereo_AVX2(const float* input, const float* gain, const float* dither, int16_t* output, int numFrames) {
+
+    // one gain and dither per frame, to both channels
+    const __m256i lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    int n = 0;
+    for (; n < numFrames - 7; n += 8) {
+
+        __m256 g = _mm256_loadu_ps(&gain[n]);
+        __m256 d = _mm256_loadu_ps(&dither[n]);
+
+        __m256 x0 = _mm256_loadu_ps(&input[2*n+0]);
+        __m256 x1 = _mm256_loadu_ps(&input[2*n+8]);
+
+        // apply gain and dither
+        x0 = _mm256_add_ps(_mm256_mul_ps(x0, _mm256_permutevar8x32_ps(g, lo)), _mm256_permutevar8x32_ps(d, lo));
+        x1 = _mm256_add_ps(_mm256_mul_ps(x1, _mm256_permutevar8x32_ps(g, hi)), _mm256_permutevar8x32_ps(d, hi));
+
+        // round, and keep the low 16 bits like the scalar cast
+        __m256i a0 = _mm256_cvtps_epi32(x0);
+        __m256i a1 = _mm256_cvtps_epi32(x1);
+        a0 = _mm256_srai_epi32(_mm256_slli_epi32(a0, 16), 16);
+        a1 = _mm256_srai_epi32(_mm256_slli_epi32(a1, 16), 16);
+
+        // packing works within lanes, put the samples back in order
+        __m256i a = _mm256_permute4x64_epi64(_mm256_packs_epi32(a0, a1), _MM_SHUFFLE(3,1,2,0));
+
+        _mm256_storeu_si256((__m256i*)&output[2*n], a);
+    }
+    AudioLimiterKernels::applyGainStereo_ref(&input[2*n], &gain[n], &dither[n], &output[2*n], numFrames - n);
+}
+
+#endif
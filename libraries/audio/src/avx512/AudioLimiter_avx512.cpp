@@ -0,0 +1,110 @@
+//
+//  AudioLimiter_avx512.cpp
+//  libraries/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX512F__
+
+#include <immintrin.h>
+
+#include "../AudioDynamics.h"
+#include "../AudioLimiter.h"
+
+// results must match the reference code exactly, so never fuse the multiply and add into an FMA
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+// high part of the signed 32x32 products
+static inline __m512i mulhi_epi32(__m512i a, __m512i b) {
+    __m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+    __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+
+void peaklog2Stereo_AVX512(const float* input, int32_t* output, int numFrames) {
+
+    const __m512i fabsMask = _mm512_set1_epi32(IEEE754_FABS_MASK);
+
+    // the left channel of each frame, after the pairwise max
+    const __m512i evens = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+
+    int n = 0;
+    for (; n < numFrames - 15; n += 16) {
+
+        __m512i a0 = _mm512_and_si512(_mm512_loadu_si512(&input[2*n+0]), fabsMask);
+        __m512i a1 = _mm512_and_si512(_mm512_loadu_si512(&input[2*n+16]), fabsMask);
+
+        // max absolute value of each frame
+        a0 = _mm512_max_epi32(a0, _mm512_shuffle_epi32(a0, (_MM_PERM_ENUM)_MM_SHUFFLE(2,3,0,1)));
+        a1 = _mm512_max_epi32(a1, _mm512_shuffle_epi32(a1, (_MM_PERM_ENUM)_MM_SHUFFLE(2,3,0,1)));
+        __m512i peak = _mm512_permutex2var_epi32(a0, evens, a1);
+
+        // split into e and x - 1.0
+        __m512i e = _mm512_sub_epi32(_mm512_set1_epi32(IEEE754_EXPN_BIAS + LOG2_HEADROOM),
+                                     _mm512_srli_epi32(peak, IEEE754_MANT_BITS));
+        __m512i x = _mm512_and_si512(_mm512_slli_epi32(peak, IEEE754_EXPN_BITS), _mm512_set1_epi32(0x7fffffff));
+
+        __m512i k = _mm512_srli_epi32(x, 31 - LOG2_TABBITS);
+        k = _mm512_add_epi32(k, _mm512_slli_epi32(k, 1));   // row offset, 3 coefs per row
+
+        // polynomial for log2(1+x) over x=[0,1]
+        __m512i c0 = _mm512_i32gather_epi32(k, &log2Table[0][0], 4);
+        __m512i c1 = _mm512_i32gather_epi32(k, &log2Table[0][1], 4);
+        __m512i c2 = _mm512_i32gather_epi32(k, &log2Table[0][2], 4);
+
+        c1 = _mm512_add_epi32(c1, mulhi_epi32(c0, x));
+        c2 = _mm512_add_epi32(c2, mulhi_epi32(c1, x));
+
+        // reconstruct result in Q26
+        __m512i result = _mm512_sub_epi32(_mm512_slli_epi32(e, LOG2_FRACBITS), _mm512_srai_epi32(c2, 3));
+
+        // saturate when e > 31 or e < 0
+        __mmask16 over = _mm512_cmpgt_epi32_mask(e, _mm512_set1_epi32(31));
+        __mmask16 under = _mm512_cmplt_epi32_mask(e, _mm512_setzero_si512());
+        result = _mm512_mask_mov_epi32(result, over, _mm512_set1_epi32(0x7fffffff));
+        result = _mm512_mask_mov_epi32(result, under, _mm512_setzero_si512());
+
+        _mm512_storeu_si512(&output[n], result);
+    }
+    AudioLimiterKernels::peaklog2Stereo_ref(&input[2*n], &output[n], numFrames - n);
+}
+
+void applyGainStereo_AVX512(const float* input, const float* gain, const float* dither, int16_t* output, int numFrames) {
+
+    // one gain and dither per frame, to both channels
+    const __m512i lo = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    int n = 0;
+    for (; n < numFrames - 15; n += 16) {
+
+        __m512 g = _mm512_loadu_ps(&gain[n]);
+        __m512 d = _mm512_loadu_ps(&dither[n]);
+
+        __m512 x0 = _mm512_loadu_ps(&input[2*n+0]);
+        __m512 x1 = _mm512_loadu_ps(&input[2*n+16]);
+
+        // apply gain and dither
+        x0 = _mm512_add_ps(_mm512_mul_ps(x0, _mm512_permutexvar_ps(lo, g)), _mm512_permutexvar_ps(lo, d));
+        x1 = _mm512_add_ps(_mm512_mul_ps(x1, _mm512_permutexvar_ps(hi, g)), _mm512_permutexvar_ps(hi, d));
+
+        // round, and keep the low 16 bits like the scalar cast
+        __m256i a0 = _mm512_cvtepi32_epi16(_mm512_cvtps_epi32(x0));
+        __m256i a1 = _mm512_cvtepi32_epi16(_mm512_cvtps_epi32(x1));
+
+        _mm256_storeu_si256((__m256i*)&output[2*n+0], a0);
+        _mm256_storeu_si256((__m256i*)&output[2*n+16], a1);
+    }
+    AudioLimiterKernels::applyGainStereo_ref(&input[2*n], &gain[n], &dither[n], &output[2*n], numFrames - n);
+}
+
+#endif
@@ -0,0 +1,77 @@
+//
+//  AddEntitiesOperator.cpp
+//  libraries/entities/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AddEntitiesOperator.h"
+
+#include "EntityItem.h"
+#include "EntityTree.h"
+#include "EntityTreeElement.h"
+
+AddEntitiesOperator::AddEntitiesOperator(EntityTreePointer tree, const std::vector<EntityItemPointer>& newEntities) :
+    _tree(tree)
+{
+    std::vector<NewEntity>& rootEntities = _newEntitiesByElement[_tree->getRoot().get()];
+    rootEntities.reserve(newEntities.size());
+    for (const auto& entity : newEntities) {
+        // caller must have verified existence of the entities
+        assert(entity);
+
+        bool success;
+        auto queryCube = entity->getQueryAACube(success);
+        rootEntities.push_back({ entity, queryCube.clamp((float)(-HALF_TREE_SCALE), (float)HALF_TREE_SCALE) });
+    }
+}
+
+bool AddEntitiesOperator::preRecursion(const OctreeElementPointer& element) {
+    auto itr = _newEntitiesByElement.find(element.get());
+    if (itr == _newEntitiesByElement.end()) {
+        // none of the new entities are in this branch
+        return false;
+    }
+
+    EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+    std::vector<NewEntity> newEntities = std::move(itr->second);
+    itr->second.clear();
+
+    std::vector<NewEntity> childEntities[NUMBER_OF_CHILDREN];
+    for (auto& newEntity : newEntities) {
+        if (entityTreeElement->bestFitBounds(newEntity.box)) {
+            entityTreeElement->addEntityItem(newEntity.entity);
+        } else {
+            // both corners are in the same child, or this element would have been the best fit
+            int childIndex = element->getMyChildContainingPoint(newEntity.box.getMinimumPoint());
+            childEntities[childIndex].push_back(std::move(newEntity));
+        }
+    }
+
+    bool keepSearching = false;
+    for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
+        if (!childEntities[i].empty()) {
+            OctreeElementPointer child = element->getChildAtIndex(i);
+            if (!child) {
+                child = element->addChildAtIndex(i);
+            }
+            _newEntitiesByElement[child.get()] = std::move(childEntities[i]);
+            keepSearching = true;
+        }
+    }
+    return keepSearching;
+}
+
+bool AddEntitiesOperator::postRecursion(const OctreeElementPointer& element) {
+    // As we unwind, mark the elements we added entities in or below as dirty.
+    auto itr = _newEntitiesByElement.find(element.get());
+    if (itr != _newEntitiesByElement.end()) {
+        element->markWithChangedTime();
+        _newEntitiesByElement.erase(itr);
+    }
+    return true;
+}
@@ -0,0 +1,47 @@
+//
+//  AddEntitiesOperator.h
+//  libraries/entities/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AddEntitiesOperator_h
+#define hifi_AddEntitiesOperator_h
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <AABox.h>
+#include <Octree.h>
+
+#include "EntityTypes.h"
+
+class EntityTree;
+using EntityTreePointer = std::shared_ptr<EntityTree>;
+
+// Adds many new entities in one pass over the tree, rather than one AddEntityOperator descent per entity.
+//   Each element takes the entities it's the best fit for, and hands the rest down to the children that contain them.
+class AddEntitiesOperator : public RecurseOctreeOperator {
+public:
+    AddEntitiesOperator(EntityTreePointer tree, const std::vector<EntityItemPointer>& newEntities);
+
+    virtual bool preRecursion(const OctreeElementPointer& element) override;
+    virtual bool postRecursion(const OctreeElementPointer& element) override;
+
+private:
+    class NewEntity {
+    public:
+        EntityItemPointer entity;
+        AABox box;
+    };
+
+    EntityTreePointer _tree;
+    std::unordered_map<const OctreeElement*, std::vector<NewEntity>> _newEntitiesByElement; // still to be placed at or below
+};
+
+#endif // hifi_AddEntitiesOperator_h
@@ -64,6 +64,7 @@ public:
     Type prepareNewTraversal(const DiffTraversal::View& view, EntityTreeElementPointer root, bool forceFirstPass = false);
 
     const View& getCurrentView() const { return _currentView; }
+    const View& getCompletedView() const { return _completedView; }
 
     uint64_t getStartOfCompletedTraversal() const { return _completedView.startTime; }
     bool finished() const { return _path.empty(); }
@@ -73,6 +74,9 @@ public:
 
     void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
 
+    // ends the current traversal as if it had completed for view, for when its results were gathered elsewhere
+    void setCompletedTraversal(const View& view);
+
 private:
     void getNextVisibleElement(VisibleElement& next);
 
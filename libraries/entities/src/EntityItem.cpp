@@ -11,6 +11,8 @@
 
 #include "EntityItem.h"
 
+#include <algorithm>
+
 #include <QtCore/QObject>
 #include <QtEndian>
 #include <QJsonDocument>
@@ -48,6 +50,8 @@ int entityItemPointernMetaTypeId = qRegisterMetaType<EntityItemPointer>();
 
 int EntityItem::_maxActionsDataSize = 800;
 quint64 EntityItem::_rememberDeletedActionTime = 20 * USECS_PER_SECOND;
+std::atomic<quint64> EntityItem::_numEncodeCacheHits { 0 };
+std::atomic<quint64> EntityItem::_numEncodeCacheMisses { 0 };
 QString EntityItem::_marketplacePublicKey;
 
 std::function<glm::quat(const glm::vec3&, const glm::quat&, BillboardMode, const glm::vec3&)> EntityItem::_getBillboardRotationOperator = [](const glm::vec3&, const glm::quat& rotation, BillboardMode, const glm::vec3&) { return rotation; };
@@ -73,6 +77,7 @@ EntityItem::~EntityItem() {
     assert(!_simulated || (!_element && !_physicsInfo));
     assert(!_element);
     assert(!_physicsInfo);
+    delete _encodeCache.load();
 }
 
 EntityPropertyFlags EntityItem::getEntityProperties(EncodeBitstreamParams& params) const {
@@ -168,6 +173,12 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     OctreeElement::AppendState appendState = OctreeElement::COMPLETED; // assume the best
 
+    // read what edit we're at before encoding anything, so a cached encode is never newer than its key
+    EncodeCacheEntry encodeCacheKey;
+    if (params.useEncodeCache) {
+        encodeCacheKey = getEncodeCacheKey();
+    }
+
     // encode our ID as a byte count coded byte stream
     QByteArray encodedID = getID().toRfc4122();
 
@@ -196,8 +207,30 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     // If we are being called for a subsequent pass at appendEntityData() that failed to completely encode this item,
     // then our entityTreeElementExtraEncodeData should include data about which properties we need to append.
+    bool isFirstPass = true;
     if (entityTreeElementExtraEncodeData && entityTreeElementExtraEncodeData->entities.contains(getEntityItemID())) {
         requestedProperties = entityTreeElementExtraEncodeData->entities.value(getEntityItemID());
+        isFirstPass = false;
+    }
+
+    // An entity is usually sent unchanged to many viewers, so if it was already encoded in full at this edit,
+    // splice those bytes in. Only whole entities are cached, a partial one is encoded as usual.
+    bool useEncodeCache = params.useEncodeCache && isFirstPass;
+    if (useEncodeCache) {
+        encodeCacheKey.requestedProperties = requestedProperties;
+        encodeCacheKey.withPrivateUserData = destinationNodeCanGetAndSetPrivateUserData;
+        QByteArray cachedData = findEncodeCacheEntry(encodeCacheKey);
+        if (!cachedData.isEmpty()) {
+            LevelDetails cachedLevel = packetData->startLevel();
+            if (packetData->appendRawData(cachedData)) {
+                packetData->endLevel(cachedLevel);
+                ++_numEncodeCacheHits;
+                params.trackSend(getID(), encodeCacheKey.lastEdited);
+                return OctreeElement::COMPLETED;
+            }
+            packetData->discardLevel(cachedLevel);
+        }
+        ++_numEncodeCacheMisses;
     }
 
     QString privateUserData = "";
@@ -207,6 +240,7 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     EntityPropertyFlags propertiesDidntFit = requestedProperties;
 
+    int startOfEntity = packetData->getUncompressedByteOffset();
     LevelDetails entityLevel = packetData->startLevel();
 
     quint64 lastEdited = getLastEdited();
@@ -384,6 +418,12 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
         appendState = OctreeElement::NONE; // if we got here, then we didn't include the item
     }
 
+    if (useEncodeCache && appendState == OctreeElement::COMPLETED) {
+        int endOfEntity = packetData->getUncompressedByteOffset();
+        encodeCacheKey.data = QByteArray((const char*)packetData->getUncompressedData(startOfEntity), endOfEntity - startOfEntity);
+        addEncodeCacheEntry(std::move(encodeCacheKey));
+    }
+
     // If any part of the model items didn't fit, then the element is considered partial
     if (appendState != OctreeElement::COMPLETED) {
         // add this item into our list for the next appendElementData() pass
@@ -398,6 +438,72 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
     return appendState;
 }
 
+bool EntityItem::EncodeCacheEntry::isSameEditAs(const EncodeCacheEntry& other) const {
+    return lastEdited == other.lastEdited && lastUpdated == other.lastUpdated && lastSimulated == other.lastSimulated &&
+        changedOnServer == other.changedOnServer && queryAACube == other.queryAACube &&
+        localPosition == other.localPosition && localOrientation == other.localOrientation &&
+        scaledDimensions == other.scaledDimensions;
+}
+
+EntityItem::EncodeCacheEntry EntityItem::getEncodeCacheKey() const {
+    EncodeCacheEntry key;
+    withReadLock([&] {
+        key.lastEdited = _lastEdited;
+        key.lastUpdated = _lastUpdated;
+        key.lastSimulated = _lastSimulated;
+        key.changedOnServer = _changedOnServer;
+    });
+    key.queryAACube = getQueryAACube();
+    key.localPosition = getLocalPosition();
+    key.localOrientation = getLocalOrientation();
+    key.scaledDimensions = getScaledDimensions();
+    return key;
+}
+
+QByteArray EntityItem::findEncodeCacheEntry(const EncodeCacheEntry& key) const {
+    EncodeCache* cache = _encodeCache;
+    if (!cache) {
+        return QByteArray();
+    }
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    for (const auto& entry : cache->entries) {
+        if (entry.isSameEditAs(key) && entry.withPrivateUserData == key.withPrivateUserData &&
+            entry.requestedProperties == key.requestedProperties) {
+            return entry.data;
+        }
+    }
+    return QByteArray();
+}
+
+void EntityItem::addEncodeCacheEntry(EncodeCacheEntry entry) const {
+    EncodeCache* cache = _encodeCache;
+    if (!cache) {
+        EncodeCache* newCache = new EncodeCache();
+        if (_encodeCache.compare_exchange_strong(cache, newCache)) {
+            cache = newCache;
+        } else {
+            // another encode created one first, and cache now points at it
+            delete newCache;
+        }
+    }
+
+    // if the entity was edited while it was being encoded then the encode may be a mix of both edits
+    EncodeCacheEntry current = getEncodeCacheKey();
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    if (!entry.isSameEditAs(current)) {
+        return;
+    }
+
+    // encodes of earlier edits won't be asked for again
+    auto& entries = cache->entries;
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const EncodeCacheEntry& cached) {
+        return !cached.isSameEditAs(current) || (cached.withPrivateUserData == entry.withPrivateUserData &&
+            cached.requestedProperties == entry.requestedProperties);
+    }), entries.end());
+    entries.push_back(std::move(entry));
+}
+
 // TODO: My goal is to get rid of this concept completely. The old code (and some of the current code) used this
 // result to calculate if a packet being sent to it was potentially bad or corrupt. I've adjusted this to now
 // only consider the minimum header bytes as being required. But it would be preferable to completely eliminate
@@ -12,7 +12,9 @@
 #ifndef hifi_EntityItem_h
 #define hifi_EntityItem_h
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <stdint.h>
 
 #include <glm/glm.hpp>
@@ -135,6 +137,10 @@ public:
 
     virtual EntityPropertyFlags getEntityProperties(EncodeBitstreamParams& params) const;
 
+    // how often appendEntityData() could splice in an earlier encode of an unchanged entity, on the server
+    static quint64 getNumEncodeCacheHits() { return _numEncodeCacheHits; }
+    static quint64 getNumEncodeCacheMisses() { return _numEncodeCacheMisses; }
+
     virtual OctreeElement::AppendState appendEntityData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                                         EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                                         const bool destinationNodeCanGetAndSetPrivateUserData = false) const;
@@ -775,6 +781,40 @@ protected:
     mutable bool _needsRenderUpdate { false };
 
 private:
+    // an entity as appendEntityData() last encoded it in full, and the edit it was encoded at
+    class EncodeCacheEntry {
+    public:
+        quint64 lastEdited { 0 };
+        quint64 lastUpdated { 0 };
+        quint64 lastSimulated { 0 };
+        quint64 changedOnServer { 0 };
+
+        // these change without an edit, when the entity or its parents move on the server
+        AACube queryAACube;
+        glm::vec3 localPosition;
+        glm::quat localOrientation;
+        glm::vec3 scaledDimensions;
+
+        EntityPropertyFlags requestedProperties;
+        bool withPrivateUserData { false };
+        QByteArray data;
+
+        bool isSameEditAs(const EncodeCacheEntry& other) const;
+    };
+    class EncodeCache {
+    public:
+        std::mutex mutex;
+        std::vector<EncodeCacheEntry> entries;
+    };
+    EncodeCacheEntry getEncodeCacheKey() const;
+    QByteArray findEncodeCacheEntry(const EncodeCacheEntry& key) const;
+    void addEncodeCacheEntry(EncodeCacheEntry entry) const;
+
+    // only created once the entity is encoded with the cache, which only the entity server does
+    mutable std::atomic<EncodeCache*> _encodeCache { nullptr };
+    static std::atomic<quint64> _numEncodeCacheHits;
+    static std::atomic<quint64> _numEncodeCacheMisses;
+
     static std::function<glm::quat(const glm::vec3&, const glm::quat&, BillboardMode, const glm::vec3&)> _getBillboardRotationOperator;
     static std::function<glm::vec3()> _getPrimaryViewFrustumPositionOperator;
 };
@@ -0,0 +1,143 @@
+//
+//  EntityItemMap.cpp
+//  libraries/entities/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityItemMap.h"
+
+#include <thread>
+
+#include "EntityItem.h"
+
+int EntityItemMap::Shard::beginRead() const {
+    int parity = epoch.load() & 1;
+    readers[parity].fetch_add(1);
+    return parity;
+}
+
+void EntityItemMap::Shard::endRead(int parity) const {
+    readers[parity].fetch_sub(1);
+}
+
+void EntityItemMap::Shard::publish(const Hash* newHash) {
+    const Hash* oldHash = hash.exchange(newHash);
+
+    // A lookup counts itself in before it loads the hash, so one that counts itself in from now on gets the new hash.
+    //   Moving the epoch on sends new lookups to the other count, so each count drains in turn.
+    for (int i = 0; i < 2; ++i) {
+        int oldParity = epoch.fetch_add(1) & 1;
+        while (readers[oldParity].load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+    delete oldHash;
+}
+
+EntityItemMap::EntityItemMap() {
+    for (auto& shard : _shards) {
+        shard.readers[0] = 0;
+        shard.readers[1] = 0;
+        shard.hash = new Hash();
+    }
+}
+
+EntityItemMap::~EntityItemMap() {
+    for (auto& shard : _shards) {
+        delete shard.hash.load();
+    }
+}
+
+EntityItemPointer EntityItemMap::value(const EntityItemID& id) const {
+    const Shard& shard = getShard(id);
+    int parity = shard.beginRead();
+    EntityItemPointer entity = shard.hash.load()->value(id);
+    shard.endRead(parity);
+    return entity;
+}
+
+bool EntityItemMap::insert(const EntityItemPointer& entity) {
+    EntityItemID id = entity->getEntityItemID();
+    Shard& shard = getShard(id);
+    std::lock_guard<std::mutex> lock(shard.writeMutex);
+    const Hash* hash = shard.hash.load();
+    if (hash->contains(id)) {
+        return false;
+    }
+    Hash* newHash = new Hash(*hash);
+    newHash->insert(id, entity);
+    shard.publish(newHash);
+    return true;
+}
+
+std::vector<EntityItemPointer> EntityItemMap::insert(const std::vector<EntityItemPointer>& entities) {
+    // copy each shard once, rather than once per entity
+    std::array<std::vector<EntityItemPointer>, NUM_SHARDS> entitiesByShard;
+    for (const auto& entity : entities) {
+        entitiesByShard[qHash(entity->getEntityItemID()) % NUM_SHARDS].push_back(entity);
+    }
+
+    std::vector<EntityItemPointer> existingEntities;
+    for (int i = 0; i < NUM_SHARDS; ++i) {
+        if (entitiesByShard[i].empty()) {
+            continue;
+        }
+        Shard& shard = _shards[i];
+        std::lock_guard<std::mutex> lock(shard.writeMutex);
+        Hash* newHash = new Hash(*shard.hash.load());
+        newHash->reserve(newHash->size() + (int)entitiesByShard[i].size());
+        for (const auto& entity : entitiesByShard[i]) {
+            EntityItemID id = entity->getEntityItemID();
+            if (newHash->contains(id)) {
+                existingEntities.push_back(entity);
+            } else {
+                newHash->insert(id, entity);
+            }
+        }
+        shard.publish(newHash);
+    }
+    return existingEntities;
+}
+
+void EntityItemMap::remove(const EntityItemID& id) {
+    Shard& shard = getShard(id);
+    std::lock_guard<std::mutex> lock(shard.writeMutex);
+    const Hash* hash = shard.hash.load();
+    if (!hash->contains(id)) {
+        return;
+    }
+    Hash* newHash = new Hash(*hash);
+    newHash->remove(id);
+    shard.publish(newHash);
+}
+
+EntityItemMap::Hash EntityItemMap::toHash() const {
+    Hash entities;
+    for (const auto& shard : _shards) {
+        int parity = shard.beginRead();
+        entities.unite(*shard.hash.load());
+        shard.endRead(parity);
+    }
+    return entities;
+}
+
+void EntityItemMap::reset(const Hash& entities) {
+    std::array<Hash*, NUM_SHARDS> newHashes;
+    for (auto& newHash : newHashes) {
+        newHash = new Hash();
+    }
+    for (auto itr = entities.cbegin(); itr != entities.cend(); ++itr) {
+        newHashes[qHash(itr.key()) % NUM_SHARDS]->insert(itr.key(), itr.value());
+    }
+
+    for (int i = 0; i < NUM_SHARDS; ++i) {
+        Shard& shard = _shards[i];
+        std::lock_guard<std::mutex> lock(shard.writeMutex);
+        shard.publish(newHashes[i]);
+    }
+}
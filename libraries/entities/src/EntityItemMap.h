@@ -0,0 +1,77 @@
+//
+//  EntityItemMap.h
+//  libraries/entities/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityItemMap_h
+#define hifi_EntityItemMap_h
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+
+#include "EntityItemID.h"
+#include "EntityTypes.h"
+
+// The entities of an EntityTree by ID, for lookups that don't take a lock.
+//   The IDs are split between shards. Each shard's hash is never changed once it's published: a change makes a copy of
+//   it, and swaps the copy in. A lookup counts itself in on the shard while it reads, and a swapped out hash is only
+//   deleted once the lookups that might still be reading it are done. So lookups never wait for a change, and a change
+//   only waits for the lookups that were already under way in its own shard.
+class EntityItemMap {
+public:
+    using Hash = QHash<EntityItemID, EntityItemPointer>;
+
+    EntityItemMap();
+    ~EntityItemMap();
+
+    EntityItemPointer value(const EntityItemID& id) const;
+
+    // returns false, and leaves the map as it is, if there's already an entity with the same ID
+    bool insert(const EntityItemPointer& entity);
+
+    // returns the entities that weren't inserted, because there was already an entity with the same ID
+    std::vector<EntityItemPointer> insert(const std::vector<EntityItemPointer>& entities);
+
+    void remove(const EntityItemID& id);
+
+    // a copy of all the entities, which doesn't see changes made after it's taken
+    Hash toHash() const;
+
+    // replaces all the entities
+    void reset(const Hash& entities = Hash());
+
+private:
+    static const int NUM_SHARDS = 64;
+
+    class Shard {
+    public:
+        // a lookup reads hash between these, passing endRead what beginRead returned
+        int beginRead() const;
+        void endRead(int parity) const;
+
+        // swaps in newHash, and deletes the old hash once no lookup can be reading it. Call with writeMutex held.
+        void publish(const Hash* newHash);
+
+        std::atomic<const Hash*> hash { nullptr };
+        mutable std::atomic<int> epoch { 0 };
+        mutable std::atomic<int> readers[2];
+        std::mutex writeMutex;
+    };
+
+    Shard& getShard(const EntityItemID& id) { return _shards[qHash(id) % NUM_SHARDS]; }
+    const Shard& getShard(const EntityItemID& id) const { return _shards[qHash(id) % NUM_SHARDS]; }
+
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+#endif // hifi_EntityItemMap_h
@@ -0,0 +1,323 @@
+//
+//  EntitySpatialIndex.cpp
+//  libraries/entities/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySpatialIndex.h"
+
+#include <algorithm>
+#include <cfloat>
+
+static const size_t MAX_SLOTS_PER_LEAF = 4;
+
+// how much may change before the hierarchy is rebuilt, the unbuilt slots are searched linearly and refits only ever
+// grow the nodes, so both slow queries down the longer they go on
+static const size_t MIN_UNBUILT_SLOTS_FOR_REBUILD = 64;
+static const size_t UNBUILT_SLOTS_FOR_REBUILD_RATIO = 8; // one for every this many built ones
+static const size_t REMOVED_SLOTS_FOR_REBUILD_RATIO = 4;
+static const size_t REFITS_FOR_REBUILD_RATIO = 1;
+
+void EntitySpatialIndex::PackedBounds::resize(size_t size) {
+    _minX.resize(size);
+    _minY.resize(size);
+    _minZ.resize(size);
+    _maxX.resize(size);
+    _maxY.resize(size);
+    _maxZ.resize(size);
+}
+
+void EntitySpatialIndex::PackedBounds::set(size_t index, const glm::vec3& minimum, const glm::vec3& maximum) {
+    _minX[index] = minimum.x;
+    _minY[index] = minimum.y;
+    _minZ[index] = minimum.z;
+    _maxX[index] = maximum.x;
+    _maxY[index] = maximum.y;
+    _maxZ[index] = maximum.z;
+}
+
+bool EntitySpatialIndex::PackedBounds::expand(size_t index, size_t otherIndex, const PackedBounds& other) {
+    glm::vec3 minimum = getMinimum(index);
+    glm::vec3 maximum = getMaximum(index);
+    glm::vec3 newMinimum = glm::min(minimum, other.getMinimum(otherIndex));
+    glm::vec3 newMaximum = glm::max(maximum, other.getMaximum(otherIndex));
+    if (newMinimum == minimum && newMaximum == maximum) {
+        return false;
+    }
+    set(index, newMinimum, newMaximum);
+    return true;
+}
+
+AABox EntitySpatialIndex::PackedBounds::get(size_t index) const {
+    glm::vec3 minimum = getMinimum(index);
+    return AABox(minimum, getMaximum(index) - minimum);
+}
+
+void EntitySpatialIndex::insert(const EntityItemPointer& entity, const AACube& bounds) {
+    withWriteLock([&] {
+        size_t slot;
+        auto it = _slots.find(entity.get());
+        if (it != _slots.end()) {
+            // most likely being moved from one element to another
+            slot = it->second;
+            if (!_slotEntities[slot]) {
+                --_numRemovedSlots;
+            }
+        } else {
+            slot = _slotEntities.size();
+            _slotEntities.emplace_back();
+            _slotBounds.resize(slot + 1);
+            _slotNodes.push_back(-1);
+            _slots[entity.get()] = slot;
+        }
+
+        _slotEntities[slot] = entity;
+        _slotBounds.set(slot, bounds.getMinimumPoint(), bounds.getMaximumPoint());
+        if (slot < _numBuiltSlots) {
+            refit(slot);
+        }
+        checkNeedsRebuild();
+    });
+}
+
+void EntitySpatialIndex::remove(const EntityItemPointer& entity) {
+    withWriteLock([&] {
+        // the slot is kept, in case the entity is only being moved to another element
+        auto it = _slots.find(entity.get());
+        if (it != _slots.end() && _slotEntities[it->second]) {
+            _slotEntities[it->second].reset();
+            ++_numRemovedSlots;
+            checkNeedsRebuild();
+        }
+    });
+}
+
+void EntitySpatialIndex::clear() {
+    withWriteLock([&] {
+        _slotEntities.clear();
+        _slotBounds.clear();
+        _slotNodes.clear();
+        _slots.clear();
+        _numBuiltSlots = 0;
+        _numRemovedSlots = 0;
+        _numRefits = 0;
+
+        _nodeBounds.clear();
+        _nodeParents.clear();
+        _nodeLeftChildren.clear();
+        _nodeRightChildren.clear();
+        _nodeFirstSlots.clear();
+        _nodeNumSlots.clear();
+
+        _needsRebuild = false;
+    });
+}
+
+size_t EntitySpatialIndex::getNumEntities() const {
+    return resultWithReadLock<size_t>([&] {
+        return _slotEntities.size() - _numRemovedSlots;
+    });
+}
+
+void EntitySpatialIndex::refit(size_t slot) {
+    ++_numRefits;
+    int node = _slotNodes[slot];
+    if (_nodeBounds.expand(node, slot, _slotBounds)) {
+        node = _nodeParents[node];
+        while (node >= 0 && _nodeBounds.expand(node, slot, _slotBounds)) {
+            node = _nodeParents[node];
+        }
+    }
+}
+
+void EntitySpatialIndex::checkNeedsRebuild() {
+    size_t numUnbuiltSlots = _slotEntities.size() - _numBuiltSlots;
+    if (numUnbuiltSlots >= std::max(MIN_UNBUILT_SLOTS_FOR_REBUILD, _numBuiltSlots / UNBUILT_SLOTS_FOR_REBUILD_RATIO) ||
+        _numRemovedSlots > _slotEntities.size() / REMOVED_SLOTS_FOR_REBUILD_RATIO ||
+        _numRefits > _numBuiltSlots / REFITS_FOR_REBUILD_RATIO) {
+        _needsRebuild = true;
+    }
+}
+
+void EntitySpatialIndex::checkRebuild() {
+    if (_needsRebuild) {
+        withWriteLock([&] {
+            if (_needsRebuild) {
+                rebuild();
+            }
+        });
+    }
+}
+
+void EntitySpatialIndex::rebuild() {
+    // drop the removed slots, and put the rest in leaf order
+    std::vector<size_t> order;
+    std::vector<glm::vec3> centers;
+    order.reserve(_slotEntities.size() - _numRemovedSlots);
+    centers.resize(_slotEntities.size());
+    for (size_t slot = 0; slot < _slotEntities.size(); ++slot) {
+        if (_slotEntities[slot]) {
+            order.push_back(slot);
+            centers[slot] = 0.5f * (_slotBounds.getMinimum(slot) + _slotBounds.getMaximum(slot));
+        }
+    }
+
+    _nodeBounds.clear();
+    _nodeParents.clear();
+    _nodeLeftChildren.clear();
+    _nodeRightChildren.clear();
+    _nodeFirstSlots.clear();
+    _nodeNumSlots.clear();
+    if (!order.empty()) {
+        buildNode(-1, 0, order.size(), order, centers);
+    }
+
+    std::vector<EntityItemPointer> slotEntities(order.size());
+    PackedBounds slotBounds;
+    slotBounds.resize(order.size());
+    std::vector<int> slotNodes(order.size());
+    _slots.clear();
+    for (size_t i = 0; i < order.size(); ++i) {
+        size_t slot = order[i];
+        slotEntities[i] = std::move(_slotEntities[slot]);
+        slotBounds.set(i, _slotBounds.getMinimum(slot), _slotBounds.getMaximum(slot));
+        _slots[slotEntities[i].get()] = i;
+    }
+    for (size_t node = 0; node < _nodeNumSlots.size(); ++node) {
+        size_t endSlot = _nodeFirstSlots[node] + _nodeNumSlots[node];
+        for (size_t slot = _nodeFirstSlots[node]; slot < endSlot; ++slot) {
+            slotNodes[slot] = (int)node;
+        }
+    }
+
+    _slotEntities.swap(slotEntities);
+    _slotBounds = std::move(slotBounds);
+    _slotNodes.swap(slotNodes);
+    _numBuiltSlots = _slotEntities.size();
+    _numRemovedSlots = 0;
+    _numRefits = 0;
+    _needsRebuild = false;
+}
+
+int EntitySpatialIndex::buildNode(int parent, size_t begin, size_t end, std::vector<size_t>& order,
+                                  const std::vector<glm::vec3>& centers) {
+    int node = (int)_nodeParents.size();
+    _nodeBounds.resize(node + 1);
+    _nodeParents.push_back(parent);
+    _nodeLeftChildren.push_back(-1);
+    _nodeRightChildren.push_back(-1);
+    _nodeFirstSlots.push_back(begin);
+    _nodeNumSlots.push_back(0);
+
+    glm::vec3 minimum = _slotBounds.getMinimum(order[begin]);
+    glm::vec3 maximum = _slotBounds.getMaximum(order[begin]);
+    glm::vec3 minimumCenter = centers[order[begin]];
+    glm::vec3 maximumCenter = minimumCenter;
+    for (size_t i = begin + 1; i < end; ++i) {
+        size_t slot = order[i];
+        minimum = glm::min(minimum, _slotBounds.getMinimum(slot));
+        maximum = glm::max(maximum, _slotBounds.getMaximum(slot));
+        minimumCenter = glm::min(minimumCenter, centers[slot]);
+        maximumCenter = glm::max(maximumCenter, centers[slot]);
+    }
+    _nodeBounds.set(node, minimum, maximum);
+
+    if (end - begin <= MAX_SLOTS_PER_LEAF) {
+        _nodeNumSlots[node] = end - begin;
+        return node;
+    }
+
+    glm::vec3 extent = maximumCenter - minimumCenter;
+    int axis = (extent.x > extent.y && extent.x > extent.z) ? 0 : (extent.y > extent.z ? 1 : 2);
+    size_t middle = findSplit(begin, end, axis, minimumCenter[axis], extent[axis], order, centers);
+    if (middle == begin || middle == end) {
+        // no better split, e.g. all the centers are in the same place, so just halve them
+        middle = begin + (end - begin) / 2;
+        std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end, [&](size_t a, size_t b) {
+            return centers[a][axis] < centers[b][axis];
+        });
+    }
+
+    int leftChild = buildNode(node, begin, middle, order, centers);
+    int rightChild = buildNode(node, middle, end, order, centers);
+    _nodeLeftChildren[node] = leftChild;
+    _nodeRightChildren[node] = rightChild;
+    return node;
+}
+
+size_t EntitySpatialIndex::findSplit(size_t begin, size_t end, int axis, float minimumCenter, float centerExtent,
+                                     std::vector<size_t>& order, const std::vector<glm::vec3>& centers) const {
+    if (centerExtent <= 0.0f) {
+        return begin;
+    }
+
+    // bin the centers along the axis, and pick the boundary between bins that minimizes the surface area heuristic:
+    // the cost of a split is the number of slots on each side times the surface area of that side's bounds
+    const int NUM_BINS = 16;
+    struct Bin {
+        size_t numSlots { 0 };
+        glm::vec3 minimum { FLT_MAX };
+        glm::vec3 maximum { -FLT_MAX };
+    };
+    Bin bins[NUM_BINS];
+    float binScale = NUM_BINS / centerExtent;
+    auto getBin = [&](size_t slot) {
+        return std::min((int)((centers[slot][axis] - minimumCenter) * binScale), NUM_BINS - 1);
+    };
+    for (size_t i = begin; i < end; ++i) {
+        size_t slot = order[i];
+        Bin& bin = bins[getBin(slot)];
+        ++bin.numSlots;
+        bin.minimum = glm::min(bin.minimum, _slotBounds.getMinimum(slot));
+        bin.maximum = glm::max(bin.maximum, _slotBounds.getMaximum(slot));
+    }
+
+    auto getArea = [](const glm::vec3& minimum, const glm::vec3& maximum) {
+        glm::vec3 size = glm::max(maximum - minimum, glm::vec3(0.0f));
+        return size.x * size.y + size.y * size.z + size.z * size.x;
+    };
+
+    // the costs of everything left of each boundary, then sweep back from the right
+    float leftCosts[NUM_BINS - 1];
+    glm::vec3 minimum { FLT_MAX };
+    glm::vec3 maximum { -FLT_MAX };
+    size_t numSlots = 0;
+    for (int i = 0; i < NUM_BINS - 1; ++i) {
+        numSlots += bins[i].numSlots;
+        minimum = glm::min(minimum, bins[i].minimum);
+        maximum = glm::max(maximum, bins[i].maximum);
+        leftCosts[i] = numSlots * getArea(minimum, maximum);
+    }
+
+    int bestBoundary = -1;
+    float bestCost = FLT_MAX;
+    minimum = glm::vec3(FLT_MAX);
+    maximum = glm::vec3(-FLT_MAX);
+    numSlots = 0;
+    for (int i = NUM_BINS - 1; i > 0; --i) {
+        numSlots += bins[i].numSlots;
+        minimum = glm::min(minimum, bins[i].minimum);
+        maximum = glm::max(maximum, bins[i].maximum);
+        if (numSlots == 0 || numSlots == end - begin) {
+            continue;
+        }
+        float cost = leftCosts[i - 1] + numSlots * getArea(minimum, maximum);
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestBoundary = i;
+        }
+    }
+    if (bestBoundary < 0) {
+        return begin;
+    }
+
+    auto middle = std::partition(order.begin() + begin, order.begin() + end, [&](size_t slot) {
+        return getBin(slot) < bestBoundary;
+    });
+    return middle - order.begin();
+}
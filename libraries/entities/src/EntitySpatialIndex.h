@@ -0,0 +1,231 @@
+//
+//  EntitySpatialIndex.h
+//  libraries/entities/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitySpatialIndex_h
+#define hifi_EntitySpatialIndex_h
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+#include <AABox.h>
+#include <AACube.h>
+#include <shared/ReadWriteLockable.h>
+
+#include "EntityTypes.h"
+
+// Flat bounding volume hierarchy of the entities in an EntityTree, for spatial queries that don't walk the octree.
+//   Each entity is indexed by the cube of the octree element it's in. So the index only changes when the octree moves an
+//   entity between elements, and it finds the same entities an octree walk would. Node and entity bounds are packed
+//   into arrays of floats, and the whole index is guarded by one lock rather than one per element.
+//   The hierarchy is split by the surface area heuristic, which also suits ray picks through it.
+//   Entities added since the hierarchy was built are kept in a list that is searched linearly. An entity that moves
+//   within the built part has its bounds refit in place. Once enough has changed, the hierarchy is rebuilt on the next query.
+class EntitySpatialIndex : public ReadWriteLockable {
+public:
+    void insert(const EntityItemPointer& entity, const AACube& bounds);
+    void remove(const EntityItemPointer& entity);
+    void clear();
+
+    size_t getNumEntities() const;
+
+    // Appends the entities whose bounds overlap to entities. overlaps(const AABox&) is also used to prune the hierarchy,
+    // so it must return true for any box that contains a box it returns true for.
+    template <typename Overlaps>
+    void findEntities(const Overlaps& overlaps, std::vector<EntityItemPointer>& entities);
+
+    // Calls intersect(const EntityItemPointer&, float& distance) for the entities whose bounds the ray enters before
+    // distance, nearest node first. intersect shortens distance when it finds a hit, which prunes the rest of the search.
+    template <typename Intersect>
+    void findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, float& distance, const Intersect& intersect);
+
+private:
+    class PackedBounds {
+    public:
+        size_t size() const { return _minX.size(); }
+        void resize(size_t size);
+        void clear() { resize(0); }
+
+        void set(size_t index, const glm::vec3& minimum, const glm::vec3& maximum);
+        bool expand(size_t index, size_t otherIndex, const PackedBounds& other); // returns true if the bounds grew
+        AABox get(size_t index) const;
+        glm::vec3 getMinimum(size_t index) const { return glm::vec3(_minX[index], _minY[index], _minZ[index]); }
+        glm::vec3 getMaximum(size_t index) const { return glm::vec3(_maxX[index], _maxY[index], _maxZ[index]); }
+
+        // slab test, returns false if the ray misses the bounds or only enters them beyond maxDistance
+        bool findRayEntry(size_t index, const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
+                          float maxDistance, float& entry) const;
+
+    private:
+        std::vector<float> _minX;
+        std::vector<float> _minY;
+        std::vector<float> _minZ;
+        std::vector<float> _maxX;
+        std::vector<float> _maxY;
+        std::vector<float> _maxZ;
+    };
+
+    void checkRebuild();
+    void rebuild();
+    int buildNode(int parent, size_t begin, size_t end, std::vector<size_t>& order, const std::vector<glm::vec3>& centers);
+    size_t findSplit(size_t begin, size_t end, int axis, float minimumCenter, float centerExtent, std::vector<size_t>& order,
+                     const std::vector<glm::vec3>& centers) const;
+    void refit(size_t slot);
+    void checkNeedsRebuild();
+
+    // entities, bounds and the node they're in, with the ones in the hierarchy first and in leaf order
+    std::vector<EntityItemPointer> _slotEntities; // null where an entity was removed
+    PackedBounds _slotBounds;
+    std::vector<int> _slotNodes;
+    std::unordered_map<const EntityItem*, size_t> _slots;
+    size_t _numBuiltSlots { 0 };
+    size_t _numRemovedSlots { 0 };
+    size_t _numRefits { 0 };
+
+    // nodes, a leaf has no children and a range of slots
+    PackedBounds _nodeBounds;
+    std::vector<int> _nodeParents;
+    std::vector<int> _nodeLeftChildren;
+    std::vector<int> _nodeRightChildren;
+    std::vector<size_t> _nodeFirstSlots;
+    std::vector<size_t> _nodeNumSlots;
+
+    std::atomic<bool> _needsRebuild { false };
+};
+
+template <typename Overlaps>
+void EntitySpatialIndex::findEntities(const Overlaps& overlaps, std::vector<EntityItemPointer>& entities) {
+    checkRebuild();
+
+    withReadLock([&] {
+        if (_numBuiltSlots > 0) {
+            const int MAX_EXPECTED_DEPTH = 64;
+            std::vector<int> nodes;
+            nodes.reserve(MAX_EXPECTED_DEPTH);
+            nodes.push_back(0);
+            while (!nodes.empty()) {
+                int node = nodes.back();
+                nodes.pop_back();
+                if (!overlaps(_nodeBounds.get(node))) {
+                    continue;
+                }
+
+                if (_nodeLeftChildren[node] < 0) {
+                    size_t endSlot = _nodeFirstSlots[node] + _nodeNumSlots[node];
+                    for (size_t slot = _nodeFirstSlots[node]; slot < endSlot; ++slot) {
+                        if (_slotEntities[slot] && overlaps(_slotBounds.get(slot))) {
+                            entities.push_back(_slotEntities[slot]);
+                        }
+                    }
+                } else {
+                    nodes.push_back(_nodeRightChildren[node]);
+                    nodes.push_back(_nodeLeftChildren[node]);
+                }
+            }
+        }
+
+        for (size_t slot = _numBuiltSlots; slot < _slotEntities.size(); ++slot) {
+            if (_slotEntities[slot] && overlaps(_slotBounds.get(slot))) {
+                entities.push_back(_slotEntities[slot]);
+            }
+        }
+    });
+}
+
+inline bool EntitySpatialIndex::PackedBounds::findRayEntry(size_t index, const glm::vec3& origin, const glm::vec3& direction,
+                                                          const glm::vec3& invDirection, float maxDistance, float& entry) const {
+    const float* minimums[] = { &_minX[index], &_minY[index], &_minZ[index] };
+    const float* maximums[] = { &_maxX[index], &_maxY[index], &_maxZ[index] };
+    float tmin = 0.0f;
+    float tmax = maxDistance;
+    for (int i = 0; i < 3; ++i) {
+        if (direction[i] == 0.0f) {
+            // parallel to this slab, which avoids 0 * inf below
+            if (origin[i] < *minimums[i] || origin[i] > *maximums[i]) {
+                return false;
+            }
+            continue;
+        }
+        float t1 = (*minimums[i] - origin[i]) * invDirection[i];
+        float t2 = (*maximums[i] - origin[i]) * invDirection[i];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+    }
+    entry = tmin;
+    return tmin <= tmax;
+}
+
+template <typename Intersect>
+void EntitySpatialIndex::findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, float& distance,
+                                             const Intersect& intersect) {
+    checkRebuild();
+
+    glm::vec3 invDirection = 1.0f / direction;
+    withReadLock([&] {
+        float entry;
+        if (_numBuiltSlots > 0 && _nodeBounds.findRayEntry(0, origin, direction, invDirection, distance, entry)) {
+            const int MAX_EXPECTED_DEPTH = 64;
+            std::vector<std::pair<int, float>> nodes;
+            nodes.reserve(MAX_EXPECTED_DEPTH);
+            nodes.emplace_back(0, entry);
+            while (!nodes.empty()) {
+                int node = nodes.back().first;
+                float nodeEntry = nodes.back().second;
+                nodes.pop_back();
+                if (nodeEntry > distance) {
+                    // something nearer was hit since this node was pushed
+                    continue;
+                }
+
+                if (_nodeLeftChildren[node] < 0) {
+                    size_t endSlot = _nodeFirstSlots[node] + _nodeNumSlots[node];
+                    for (size_t slot = _nodeFirstSlots[node]; slot < endSlot; ++slot) {
+                        if (_slotEntities[slot] &&
+                                _slotBounds.findRayEntry(slot, origin, direction, invDirection, distance, entry)) {
+                            intersect(_slotEntities[slot], distance);
+                        }
+                    }
+                    continue;
+                }
+
+                // visit the nearer child first, so its hits prune the farther one
+                int leftChild = _nodeLeftChildren[node];
+                int rightChild = _nodeRightChildren[node];
+                float leftEntry;
+                float rightEntry;
+                bool hitsLeft = _nodeBounds.findRayEntry(leftChild, origin, direction, invDirection, distance, leftEntry);
+                bool hitsRight = _nodeBounds.findRayEntry(rightChild, origin, direction, invDirection, distance, rightEntry);
+                if (hitsLeft && hitsRight) {
+                    if (leftEntry <= rightEntry) {
+                        nodes.emplace_back(rightChild, rightEntry);
+                        nodes.emplace_back(leftChild, leftEntry);
+                    } else {
+                        nodes.emplace_back(leftChild, leftEntry);
+                        nodes.emplace_back(rightChild, rightEntry);
+                    }
+                } else if (hitsLeft) {
+                    nodes.emplace_back(leftChild, leftEntry);
+                } else if (hitsRight) {
+                    nodes.emplace_back(rightChild, rightEntry);
+                }
+            }
+        }
+
+        for (size_t slot = _numBuiltSlots; slot < _slotEntities.size(); ++slot) {
+            if (_slotEntities[slot] && _slotBounds.findRayEntry(slot, origin, direction, invDirection, distance, entry)) {
+                intersect(_slotEntities[slot], distance);
+            }
+        }
+    });
+}
+
+#endif // hifi_EntitySpatialIndex_h
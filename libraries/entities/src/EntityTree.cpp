@@ -12,6 +12,8 @@
 #include "EntityTree.h"
 #include <QtCore/QDateTime>
 #include <QtCore/QQueue>
+#include <limits>
+#include <unordered_set>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 #include <openssl/x509.h>
@@ -24,13 +26,17 @@
 #include <QtScript/QScriptEngine>
 
 #include <Extents.h>
+#include <OctreeBinaryFormat.h>
+#include <OctreePersistLog.h>
 #include <PerfStat.h>
+#include <ThreadHelpers.h>
 #include <Profile.h>
 #include <AddressManager.h>
 
 #include "EntitySimulation.h"
 #include "VariantMapToScriptValue.h"
 
+#include "AddEntitiesOperator.h"
 #include "AddEntityOperator.h"
 #include "UpdateEntityOperator.h"
 #include "QVariantGLM.h"
@@ -90,10 +96,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
 
     this->withWriteLock([&] {
         QHash<EntityItemID, EntityItemPointer> savedEntities;
-        // NOTE: lock the Tree first, then lock the _entityMap.
-        // It should never be done the other way around.
-        QReadLocker locker(&_entityMapLock);
-        foreach(EntityItemPointer entity, _entityMap) {
+        foreach(EntityItemPointer entity, _entityMap.toHash()) {
             EntityTreeElementPointer element = entity->getElement();
             if (element) {
                 element->cleanupDomainAndNonOwnedEntities();
@@ -110,7 +113,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
                 }
             }
         }
-        _entityMap.swap(savedEntities);
+        _entityMap.reset(savedEntities);
     });
 
     resetClientEditStats();
@@ -137,8 +140,8 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     if (_simulation) {
         _simulation->clearEntities();
     }
-    QHash<EntityItemID, EntityItemPointer> localMap;
-    localMap.swap(_entityMap);
+    QHash<EntityItemID, EntityItemPointer> localMap = _entityMap.toHash();
+    _entityMap.reset();
     this->withWriteLock([&] {
         foreach(EntityItemPointer entity, localMap) {
             EntityTreeElementPointer element = entity->getElement();
@@ -155,6 +158,7 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
         }
     });
     localMap.clear();
+    _spatialIndex.clear();
     Octree::eraseAllOctreeElements(createNewRoot);
 
     resetClientEditStats();
@@ -288,35 +292,39 @@ bool EntityTree::handlesEditPacketType(PacketType packetType) const {
 /// Adds a new entity item to the tree
 void EntityTree::postAddEntity(EntityItemPointer entity) {
     assert(entity);
+    postAddEntities({ entity });
+}
 
-    if (getIsServer()) {
-        addCertifiedEntityOnServer(entity);
-    }
+void EntityTree::postAddEntities(const std::vector<EntityItemPointer>& entities) {
+    for (const auto& entity : entities) {
+        if (getIsServer()) {
+            addCertifiedEntityOnServer(entity);
+        }
 
-    // check to see if we need to simulate this entity..
-    if (_simulation) {
-        _simulation->addEntity(entity);
-    }
+        // check to see if we need to simulate this entity..
+        if (_simulation) {
+            _simulation->addEntity(entity);
+        }
 
-    if (!entity->getParentID().isNull()) {
-        addToNeedsParentFixupList(entity);
-    }
+        if (!entity->getParentID().isNull()) {
+            addToNeedsParentFixupList(entity);
+        }
 
-    _isDirty = true;
+        _isDirty = true;
+        trackPersistChange(entity->getEntityItemID());
+    }
 
-    // find and hook up any entities with this entity as a (previously) missing parent
+    // find and hook up any entities with these entities as a (previously) missing parent
     fixupNeedsParentFixups();
 
-    emit addingEntity(entity->getEntityItemID());
-    emit addingEntityPointer(entity.get());
+    for (const auto& entity : entities) {
+        emit addingEntity(entity->getEntityItemID());
+        emit addingEntityPointer(entity.get());
+    }
 }
 
 bool EntityTree::updateEntity(const EntityItemID& entityID, const EntityItemProperties& properties, const SharedNodePointer& senderNode) {
-    EntityItemPointer entity;
-    {
-        QReadLocker locker(&_entityMapLock);
-        entity = _entityMap.value(entityID);
-    }
+    EntityItemPointer entity = _entityMap.value(entityID);
     if (!entity) {
         return false;
     }
@@ -369,6 +377,7 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
                     emit editingEntityPointer(entity);
                 }
                 _isDirty = true;
+                trackPersistChange(entity->getEntityItemID());
             }
         }
     } else {
@@ -504,6 +513,7 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
         }
 
         _isDirty = true;
+        trackPersistChange(entity->getEntityItemID());
 
         uint32_t newFlags = entity->getDirtyFlags() & ~preFlags;
         if (newFlags) {
@@ -537,8 +547,26 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
 }
 
 EntityItemPointer EntityTree::addEntity(const EntityItemID& entityID, const EntityItemProperties& properties, bool isClone) {
-    EntityItemProperties props = properties;
+    // You should not call this on existing entities that are already part of the tree! Call updateEntity()
+    EntityTreeElementPointer containingElement = getContainingElement(entityID);
+    if (containingElement) {
+        qCWarning(entities) << "EntityTree::addEntity() on existing entity item with entityID=" << entityID
+                          << "containingElement=" << containingElement.get();
+        return nullptr;
+    }
+
+    EntityItemPointer result = constructEntity(entityID, properties, isClone);
+    if (result) {
+        // Recurse the tree and store the entity in the correct tree element
+        AddEntityOperator theOperator(getThisPointer(), result);
+        recurseTreeWithOperator(&theOperator);
+        postAddEntity(result);
+    }
+    return result;
+}
 
+EntityItemPointer EntityTree::constructEntity(const EntityItemID& entityID, const EntityItemProperties& properties,
+                                              bool isClone) const {
     auto nodeList = DependencyManager::get<NodeList>();
     if (!nodeList) {
         qCDebug(entities) << "EntityTree::addEntity -- can't get NodeList";
@@ -552,34 +580,50 @@ EntityItemPointer EntityTree::addEntity(const EntityItemID& entityID, const Enti
     }
 
     bool recordCreationTime = false;
-    if (props.getCreated() == UNKNOWN_CREATED_TIME) {
+    if (properties.getCreated() == UNKNOWN_CREATED_TIME) {
         // the entity's creation time was not specified in properties, which means this is a NEW entity
         // and we must record its creation time
         recordCreationTime = true;
     }
 
-    // You should not call this on existing entities that are already part of the tree! Call updateEntity()
-    EntityTreeElementPointer containingElement = getContainingElement(entityID);
-    if (containingElement) {
-        qCWarning(entities) << "EntityTree::addEntity() on existing entity item with entityID=" << entityID
-                          << "containingElement=" << containingElement.get();
-        return nullptr;
+    // construct the instance of the entity
+    EntityTypes::EntityType type = properties.getType();
+    EntityItemPointer result = EntityTypes::constructEntityItem(type, entityID, properties);
+    if (result && recordCreationTime) {
+        result->recordCreationTime();
     }
+    return result;
+}
 
-    // construct the instance of the entity
-    EntityTypes::EntityType type = props.getType();
-    EntityItemPointer result = EntityTypes::constructEntityItem(type, entityID, props);
+std::vector<EntityItemPointer> EntityTree::addEntities(const std::vector<EntityItemPointer>& newEntities) {
+    if (newEntities.empty()) {
+        return newEntities;
+    }
 
-    if (result) {
-        if (recordCreationTime) {
-            result->recordCreationTime();
+    // an entity whose ID is already taken, by one in the tree or earlier in the batch, is left out
+    std::vector<EntityItemPointer> addedEntities;
+    auto rejectedEntities = _entityMap.insert(newEntities);
+    if (rejectedEntities.empty()) {
+        addedEntities = newEntities;
+    } else {
+        std::unordered_set<EntityItem*> rejected;
+        for (const auto& entity : rejectedEntities) {
+            qCWarning(entities) << "EntityTree::addEntities() found pre-existing id " << entity->getEntityItemID();
+            rejected.insert(entity.get());
+        }
+        addedEntities.reserve(newEntities.size() - rejected.size());
+        for (const auto& entity : newEntities) {
+            if (rejected.find(entity.get()) == rejected.end()) {
+                addedEntities.push_back(entity);
+            }
         }
-        // Recurse the tree and store the entity in the correct tree element
-        AddEntityOperator theOperator(getThisPointer(), result);
-        recurseTreeWithOperator(&theOperator);
-        postAddEntity(result);
     }
-    return result;
+
+    // Recurse the tree once and store each entity in the correct tree element
+    AddEntitiesOperator theOperator(getThisPointer(), addedEntities);
+    recurseTreeWithOperator(&theOperator);
+    postAddEntities(addedEntities);
+    return addedEntities;
 }
 
 void EntityTree::emitEntityScriptChanging(const EntityItemID& entityItemID, bool reload) {
@@ -683,11 +727,7 @@ void EntityTree::deleteEntitiesByID(const std::vector<EntityItemID>& ids, bool f
             std::vector<EntityItemPointer> entitiesToDelete;
             entitiesToDelete.reserve(ids.size());
             for (auto id : ids) {
-                EntityItemPointer entity;
-                {
-                    QReadLocker locker(&_entityMapLock);
-                    entity = _entityMap.value(id);
-                }
+                EntityItemPointer entity = _entityMap.value(id);
                 if (entity) {
                     recursivelyFilterAndCollectForDelete(entity, entitiesToDelete, force);
                 }
@@ -703,11 +743,7 @@ void EntityTree::deleteEntitiesByID(const std::vector<EntityItemID>& ids, bool f
         QUuid sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
         withWriteLock([&] {
             for (auto id : ids) {
-                EntityItemPointer entity;
-                {
-                    QReadLocker locker(&_entityMapLock);
-                    entity = _entityMap.value(id);
-                }
+                EntityItemPointer entity = _entityMap.value(id);
                 if (entity) {
                     if (entity->isDomainEntity()) {
                         // domain-entity deletes must round-trip through entity-server
@@ -744,6 +780,7 @@ void EntityTree::deleteEntitiesByPointer(const std::vector<EntityItemPointer>& e
             theOperator.addEntityToDeleteList(entity);
             emit deletingEntity(entity->getID());
             emit deletingEntityPointer(entity.get());
+            trackPersistChange(entity->getEntityItemID(), true);
         }
     }
 
@@ -788,59 +825,20 @@ void EntityTree::processRemovedEntities(const DeleteEntityOperator& theOperator)
     }
 }
 
-class RayArgs {
-public:
-    // Inputs
-    glm::vec3 origin;
-    glm::vec3 direction;
-    glm::vec3 invDirection;
-    const QVector<EntityItemID>& entityIdsToInclude;
-    const QVector<EntityItemID>& entityIdsToDiscard;
-    PickFilter searchFilter;
-
-    // Outputs
-    OctreeElementPointer& element;
-    float& distance;
-    BoxFace& face;
-    glm::vec3& surfaceNormal;
-    QVariantMap& extraInfo;
+// NOTE: assumes caller has handled locking
+EntityItemID EntityTree::evalRayIntersectionInIndex(const glm::vec3& origin, const glm::vec3& direction,
+                                    const QVector<EntityItemID>& entityIdsToInclude, const QVector<EntityItemID>& entityIdsToDiscard,
+                                    PickFilter searchFilter, OctreeElementPointer& element, float& distance,
+                                    BoxFace& face, glm::vec3& surfaceNormal, QVariantMap& extraInfo) {
     EntityItemID entityID;
-};
-
-bool evalRayIntersectionOp(const OctreeElementPointer& element, void* extraData) {
-    RayArgs* args = static_cast<RayArgs*>(extraData);
-    bool keepSearching = true;
-    EntityTreeElementPointer entityTreeElementPointer = std::static_pointer_cast<EntityTreeElement>(element);
-    EntityItemID entityID = entityTreeElementPointer->evalRayIntersection(args->origin, args->direction,
-        args->element, args->distance, args->face, args->surfaceNormal, args->entityIdsToInclude,
-        args->entityIdsToDiscard, args->searchFilter, args->extraInfo);
-    if (!entityID.isNull()) {
-        args->entityID = entityID;
-        // We recurse OctreeElements in order, so if we hit something, we can stop immediately
-        keepSearching = false;
-    }
-    return keepSearching;
-}
-
-float evalRayIntersectionSortingOp(const OctreeElementPointer& element, void* extraData) {
-    RayArgs* args = static_cast<RayArgs*>(extraData);
-    EntityTreeElementPointer entityTreeElementPointer = std::static_pointer_cast<EntityTreeElement>(element);
-    float distance = FLT_MAX;
-    // If origin is inside the cube, always check this element first
-    if (entityTreeElementPointer->getAACube().contains(args->origin)) {
-        distance = 0.0f;
-    } else {
-        float boundDistance = FLT_MAX;
-        BoxFace face;
-        glm::vec3 surfaceNormal;
-        if (entityTreeElementPointer->getAACube().findRayIntersection(args->origin, args->direction, args->invDirection, boundDistance, face, surfaceNormal)) {
-            // Don't add this cell if it's already farther than our best distance so far
-            if (boundDistance < args->distance) {
-                distance = boundDistance;
-            }
+    distance = FLT_MAX;
+    _spatialIndex.findRayIntersection(origin, direction, distance, [&](const EntityItemPointer& entity, float& nearestDistance) {
+        if (EntityTreeElement::evalEntityRayIntersection(entity, origin, direction, element, nearestDistance, face,
+                surfaceNormal, entityIdsToInclude, entityIdsToDiscard, searchFilter, extraInfo)) {
+            entityID = entity->getEntityItemID();
         }
-    }
-    return distance;
+    });
+    return entityID;
 }
 
 EntityItemID EntityTree::evalRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
@@ -848,25 +846,42 @@ EntityItemID EntityTree::evalRayIntersection(const glm::vec3& origin, const glm:
                                     PickFilter searchFilter, OctreeElementPointer& element, float& distance,
                                     BoxFace& face, glm::vec3& surfaceNormal, QVariantMap& extraInfo,
                                     Octree::lockType lockType, bool* accurateResult) {
-
-    // calculate dirReciprocal like this rather than with glm's scalar / vec3 template to avoid NaNs.
-    vec3 dirReciprocal = glm::vec3(direction.x == 0.0f ? 0.0f : 1.0f / direction.x,
-                                   direction.y == 0.0f ? 0.0f : 1.0f / direction.y,
-                                   direction.z == 0.0f ? 0.0f : 1.0f / direction.z);
-    RayArgs args = { origin, direction, dirReciprocal, entityIdsToInclude, entityIdsToDiscard,
-            searchFilter, element, distance, face, surfaceNormal, extraInfo, EntityItemID() };
+    EntityItemID entityID;
     distance = FLT_MAX;
 
     bool requireLock = lockType == Octree::Lock;
     bool lockResult = withReadLock([&]{
-        recurseTreeWithOperationSorted(evalRayIntersectionOp, evalRayIntersectionSortingOp, &args);
+        entityID = evalRayIntersectionInIndex(origin, direction, entityIdsToInclude, entityIdsToDiscard, searchFilter,
+            element, distance, face, surfaceNormal, extraInfo);
     }, requireLock);
 
     if (accurateResult) {
         *accurateResult = lockResult; // if user asked to accuracy or result, let them know this is accurate
     }
 
-    return args.entityID;
+    return entityID;
+}
+
+void EntityTree::evalRayIntersections(const QVector<PickRay>& rays,
+                                    const QVector<EntityItemID>& entityIdsToInclude, const QVector<EntityItemID>& entityIdsToDiscard,
+                                    PickFilter searchFilter, QVector<RayIntersection>& intersections,
+                                    Octree::lockType lockType, bool* accurateResult) {
+    intersections.resize(rays.size());
+
+    bool requireLock = lockType == Octree::Lock;
+    bool lockResult = withReadLock([&]{
+        for (int i = 0; i < rays.size(); ++i) {
+            RayIntersection& intersection = intersections[i];
+            OctreeElementPointer element;
+            intersection.entityID = evalRayIntersectionInIndex(rays[i].origin, rays[i].direction, entityIdsToInclude,
+                entityIdsToDiscard, searchFilter, element, intersection.distance, intersection.face,
+                intersection.surfaceNormal, intersection.extraInfo);
+        }
+    }, requireLock);
+
+    if (accurateResult) {
+        *accurateResult = lockResult;
+    }
 }
 
 class ParabolaArgs {
@@ -952,248 +967,150 @@ EntityItemID EntityTree::evalParabolaIntersection(const PickParabola& parabola,
     return args.entityID;
 }
 
-class FindClosestEntityArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    PickFilter searchFilter;
+// NOTE: assumes caller has handled locking
+QUuid EntityTree::evalClosestEntity(const glm::vec3& position, float targetRadius, PickFilter searchFilter) {
+    std::vector<EntityItemPointer> candidates;
+    _spatialIndex.findEntities([&](const AABox& bounds) {
+        glm::vec3 penetration;
+        return bounds.findSpherePenetration(position, targetRadius, penetration);
+    }, candidates);
 
-    // Outputs
     QUuid closestEntity;
-    float closestEntityDistance;
-};
-
-
-bool evalClosestEntityOperation(const OctreeElementPointer& element, void* extraData) {
-    FindClosestEntityArgs* args = static_cast<FindClosestEntityArgs*>(extraData);
-    EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-
-    glm::vec3 penetration;
-    bool sphereIntersection = entityTreeElement->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this entityTreeElement contains the point, then search it...
-    if (sphereIntersection) {
-        float closestDistanceSquared = FLT_MAX;
-        QUuid thisClosestEntity = entityTreeElement->evalClosetEntity(args->position, args->searchFilter, closestDistanceSquared);
-
-        // we may have gotten NULL back, meaning no entity was available
-        if (!thisClosestEntity.isNull()) {
-            float distanceFromPointToEntity = glm::sqrt(closestDistanceSquared);
-
-            // If we're within our target radius
-            if (distanceFromPointToEntity <= args->targetRadius) {
-                // we are closer than anything else we've found
-                if (distanceFromPointToEntity < args->closestEntityDistance) {
-                    args->closestEntity = thisClosestEntity;
-                    args->closestEntityDistance = distanceFromPointToEntity;
-                }
-            }
+    float closestDistanceSquared = FLT_MAX;
+    float targetRadiusSquared = targetRadius * targetRadius;
+    for (const auto& entity : candidates) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            continue;
         }
 
-        // we should be able to optimize this...
-        return true; // keep searching in case children have closer entities
+        float distanceSquared = glm::distance2(position, entity->getWorldPosition());
+        if (distanceSquared <= targetRadiusSquared && distanceSquared < closestDistanceSquared) {
+            closestEntity = entity->getID();
+            closestDistanceSquared = distanceSquared;
+        }
     }
-
-    // if this element doesn't contain the point, then none of its children can contain the point, so stop searching
-    return false;
-}
-
-// NOTE: assumes caller has handled locking
-QUuid EntityTree::evalClosestEntity(const glm::vec3& position, float targetRadius, PickFilter searchFilter) {
-    FindClosestEntityArgs args = { position, targetRadius, searchFilter, QUuid(), FLT_MAX };
-    recurseTreeWithOperation(evalClosestEntityOperation, &args);
-    return args.closestEntity;
+    return closestEntity;
 }
 
-class FindEntitiesInSphereArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    PickFilter searchFilter;
-
-    // Outputs
-    QVector<QUuid> entities;
-};
-
-bool evalInSphereOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereArgs* args = static_cast<FindEntitiesInSphereArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphere(args->position, args->targetRadius, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+void EntityTree::findEntitiesInSphere(const glm::vec3& center, float radius, std::vector<EntityItemPointer>& candidates) {
+    _spatialIndex.findEntities([&](const AABox& bounds) {
+        glm::vec3 penetration;
+        return bounds.findSpherePenetration(center, radius, penetration);
+    }, candidates);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereArgs args = { center, radius, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereOperation, &args);
-    foundEntities.swap(args.entities);
-}
+    std::vector<EntityItemPointer> candidates;
+    findEntitiesInSphere(center, radius, candidates);
 
-class FindEntitiesInSphereWithTypeArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    EntityTypes::EntityType type;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool evalInSphereWithTypeOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereWithTypeArgs* args = static_cast<FindEntitiesInSphereWithTypeArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphereWithType(args->position, args->targetRadius, args->type, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
+    for (const auto& entity : candidates) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::isEntityInSphere(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
     }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphereWithType(const glm::vec3& center, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereWithTypeArgs args = { center, radius, type, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereWithTypeOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInSphereWithNameArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    QString name;
-    bool caseSensitive;
-    PickFilter searchFilter;
+    std::vector<EntityItemPointer> candidates;
+    findEntitiesInSphere(center, radius, candidates);
 
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool evalInSphereWithNameOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereWithNameArgs* args = static_cast<FindEntitiesInSphereWithNameArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphereWithName(args->position, args->targetRadius, args->name, args->caseSensitive, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
+    for (const auto& entity : candidates) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) && type == entity->getType() &&
+            EntityTreeElement::isEntityInSphere(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
     }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphereWithName(const glm::vec3& center, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereWithNameArgs args = { center, radius, name, caseSensitive, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereWithNameOperation, &args);
-    foundEntities.swap(args.entities);
-}
+    std::vector<EntityItemPointer> candidates;
+    findEntitiesInSphere(center, radius, candidates);
 
-class FindEntitiesInCubeArgs {
-public:
-    // Inputs
-    AACube cube;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool findInCubeOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInCubeArgs* args = static_cast<FindEntitiesInCubeArgs*>(extraData);
-    if (element->getAACube().touches(args->cube)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInCube(args->cube, args->searchFilter, args->entities);
-        return true;
+    for (const auto& entity : candidates) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::isEntityNamed(entity, name, caseSensitive) &&
+            EntityTreeElement::isEntityInSphere(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
     }
-    return false;
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInCubeArgs args { cube, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(findInCubeOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInBoxArgs {
-public:
-    // Inputs
-    AABox box;
-    PickFilter searchFilter;
+    std::vector<EntityItemPointer> candidates;
+    _spatialIndex.findEntities([&](const AABox& bounds) {
+        return bounds.touches(cube);
+    }, candidates);
 
-    // Outputs
     QVector<QUuid> entities;
-};
+    for (const auto& entity : candidates) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            continue;
+        }
 
-bool findInBoxOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInBoxArgs* args = static_cast<FindEntitiesInBoxArgs*>(extraData);
-    if (element->getAACube().touches(args->box)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInBox(args->box, args->searchFilter, args->entities);
-        return true;
+        // If the entities AABox touches the search cube then consider it to be found
+        bool success;
+        AABox entityBox = entity->getAABox(success);
+        if (success && entityBox.touches(cube)) {
+            entities.push_back(entity->getID());
+        }
     }
-    return false;
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInBoxArgs args { box, searchFilter, QVector<QUuid>() };
-    // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInBoxOperation, &args);
-    // swap the two lists of entity pointers instead of copy
-    foundEntities.swap(args.entities);
-}
+    std::vector<EntityItemPointer> candidates;
+    _spatialIndex.findEntities([&](const AABox& bounds) {
+        return bounds.touches(box);
+    }, candidates);
 
-class FindEntitiesInFrustumArgs {
-public:
-    // Inputs
-    ViewFrustum frustum;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
+    for (const auto& entity : candidates) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            continue;
+        }
 
-bool findInFrustumOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInFrustumArgs* args = static_cast<FindEntitiesInFrustumArgs*>(extraData);
-    if (element->isInView(args->frustum)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInFrustum(args->frustum, args->searchFilter, args->entities);
-        return true;
+        // If the entities AABox touches the search box then consider it to be found
+        bool success;
+        AABox entityBox = entity->getAABox(success);
+        if (success && entityBox.touches(box)) {
+            entities.push_back(entity->getID());
+        }
     }
-    return false;
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInFrustumArgs args = { frustum, searchFilter, QVector<QUuid>() };
-    // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInFrustumOperation, &args);
-    // swap the two lists of entity pointers instead of copy
-    foundEntities.swap(args.entities);
+    std::vector<EntityItemPointer> candidates;
+    _spatialIndex.findEntities([&](const AABox& bounds) {
+        return frustum.boxIntersectsFrustum(bounds) || frustum.boxIntersectsKeyhole(bounds);
+    }, candidates);
+
+    QVector<QUuid> entities;
+    for (const auto& entity : candidates) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            continue;
+        }
+
+        bool success;
+        AABox entityBox = entity->getAABox(success);
+        if (success && (frustum.boxIntersectsFrustum(entityBox) || frustum.boxIntersectsKeyhole(entityBox))) {
+            entities.push_back(entity->getID());
+        }
+    }
+    foundEntities.swap(entities);
 }
 
 EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
@@ -1202,11 +1119,7 @@ EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
 }
 
 EntityItemPointer EntityTree::findEntityByEntityItemID(const EntityItemID& entityID) const {
-    EntityItemPointer foundEntity = nullptr;
-    {
-        QReadLocker locker(&_entityMapLock);
-        foundEntity = _entityMap.value(entityID);
-    }
+    EntityItemPointer foundEntity = _entityMap.value(entityID);
     if (foundEntity && !foundEntity->getElement()) {
         // special case to maintain legacy behavior:
         // if the entity is in the map but not in the tree
@@ -2487,11 +2400,7 @@ int EntityTree::processEraseMessageDetails(const QByteArray& dataByteArray, cons
 }
 
 EntityTreeElementPointer EntityTree::getContainingElement(const EntityItemID& entityItemID)  /*const*/ {
-    EntityItemPointer entity;
-    {
-        QReadLocker locker(&_entityMapLock);
-        entity = _entityMap.value(entityItemID);
-    }
+    EntityItemPointer entity = _entityMap.value(entityItemID);
     if (entity) {
         return entity->getElement();
     }
@@ -2500,25 +2409,18 @@ EntityTreeElementPointer EntityTree::getContainingElement(const EntityItemID& en
 
 void EntityTree::addEntityMapEntry(EntityItemPointer entity) {
     EntityItemID id = entity->getEntityItemID();
-    QWriteLocker locker(&_entityMapLock);
-    EntityItemPointer otherEntity = _entityMap.value(id);
-    if (otherEntity) {
+    if (!_entityMap.insert(entity)) {
         qCWarning(entities) << "EntityTree::addEntityMapEntry() found pre-existing id " << id;
         assert(false);
-        return;
     }
-    _entityMap.insert(id, entity);
 }
 
 void EntityTree::clearEntityMapEntry(const EntityItemID& id) {
-    QWriteLocker locker(&_entityMapLock);
     _entityMap.remove(id);
 }
 
 void EntityTree::debugDumpMap() {
-    // QHash's are implicitly shared, so we make a shared copy and use that instead.
-    // This way we might be able to avoid both a lock and a true copy.
-    QHash<EntityItemID, EntityItemPointer> localMap(_entityMap);
+    QHash<EntityItemID, EntityItemPointer> localMap = _entityMap.toHash();
     qCDebug(entities) << "EntityTree::debugDumpMap() --------------------------";
     QHashIterator<EntityItemID, EntityItemPointer> i(localMap);
     while (i.hasNext()) {
@@ -2930,182 +2832,486 @@ bool EntityTree::readFromMap(QVariantMap& map) {
     // to a QScriptValue, and then to EntityItemProperties.  These properties are used
     // to add the new entity to the EntityTree.
     QVariantList entitiesQList = map["Entities"].toList();
-    QScriptEngine scriptEngine;
 
     if (entitiesQList.length() == 0) {
         // Empty map or invalidly formed file.
         return false;
     }
 
+    // The conversions and the construction of the entities are independent of each other and of the tree,
+    // so they're split over the thread pool, each range with its own script engine.
+    quint64 startConvert = usecTimestampNow();
+    const int MIN_ENTITIES_PER_THREAD = 256;
+    int numEntities = entitiesQList.length();
+    std::vector<EntityItemID> entityIDs(numEntities);
+    std::vector<EntityItemProperties> entityProperties(numEntities);
+    std::vector<EntityItemPointer> newEntities(numEntities);
+
+    auto convertEntities = [&](int begin, int end) {
+        QScriptEngine scriptEngine;
+        for (int i = begin; i < end; ++i) {
+            // QVariantMap --> QScriptValue --> EntityItemProperties --> Entity
+            QVariantMap entityMap = entitiesQList[i].toMap();
+            if (entityMap.contains("id")) {
+                entityIDs[i] = EntityItemID(QUuid(entityMap["id"].toString()));
+            } else {
+                entityIDs[i] = EntityItemID(QUuid::createUuid());
+            }
+            entityProperties[i] = propertiesFromMap(entityMap, contentVersion, scriptEngine);
+            newEntities[i] = constructEntity(entityIDs[i], entityProperties[i]);
+        }
+    };
+
+    forEachRangeInParallel(numEntities, MIN_ENTITIES_PER_THREAD, convertEntities);
+
+    // then everything is added to the tree in one pass
+    quint64 startAdd = usecTimestampNow();
+    std::vector<EntityItemPointer> entitiesToAdd;
+    entitiesToAdd.reserve(numEntities);
+    QSet<EntityItemID> addedIDs;
     QMap<QUuid, QVector<QUuid>> cloneIDs;
 
     bool success = true;
-    foreach (QVariant entityVariant, entitiesQList) {
-        // QVariantMap --> QScriptValue --> EntityItemProperties --> Entity
-        QVariantMap entityMap = entityVariant.toMap();
+    for (int i = 0; i < numEntities; ++i) {
+        EntityItemPointer& entity = newEntities[i];
+        if (!entity) {
+            qCDebug(entities) << "adding Entity failed:" << entityIDs[i] << entityProperties[i].getType();
+            success = false;
+            continue;
+        }
 
-        // handle parentJointName for wearables
-        if (_myAvatar && entityMap.contains("parentJointName") && entityMap.contains("parentID") &&
-            QUuid(entityMap["parentID"].toString()) == AVATAR_SELF_ID) {
+        // You should not call this on existing entities that are already part of the tree! Call updateEntity()
+        EntityTreeElementPointer containingElement = getContainingElement(entityIDs[i]);
+        if (containingElement || addedIDs.contains(entityIDs[i])) {
+            qCWarning(entities) << "EntityTree::readFromMap() on existing entity item with entityID=" << entityIDs[i]
+                              << "containingElement=" << containingElement.get();
+            success = false;
+            continue;
+        }
+        addedIDs.insert(entityIDs[i]);
+        entitiesToAdd.push_back(entity);
 
-            entityMap["parentJointIndex"] = _myAvatar->getJointIndex(entityMap["parentJointName"].toString());
+        const QUuid& cloneOriginID = entity->getCloneOriginID();
+        if (!cloneOriginID.isNull()) {
+            cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+        }
+    }
+    if (addEntities(entitiesToAdd).size() != entitiesToAdd.size()) {
+        success = false;
+    }
 
-            qCDebug(entities) << "Found parentJointName " << entityMap["parentJointName"].toString() <<
-                " mapped it to parentJointIndex " << entityMap["parentJointIndex"].toInt();
+    for (const auto& entityID : cloneIDs.keys()) {
+        auto entity = findEntityByID(entityID);
+        if (entity) {
+            entity->setCloneIDs(cloneIDs.value(entityID));
         }
+    }
 
-        QScriptValue entityScriptValue = variantMapToScriptValue(entityMap, scriptEngine);
-        EntityItemProperties properties;
-        EntityItemPropertiesFromScriptValueIgnoreReadOnly(entityScriptValue, properties);
+    quint64 end = usecTimestampNow();
+    qCDebug(entities) << "Read" << entitiesToAdd.size() << "of" << numEntities << "entities from map - convert:"
+        << (float)(startAdd - startConvert) / USECS_PER_MSEC << "msecs, add:"
+        << (float)(end - startAdd) / USECS_PER_MSEC << "msecs";
 
-        EntityItemID entityItemID;
-        if (entityMap.contains("id")) {
-            entityItemID = EntityItemID(QUuid(entityMap["id"].toString()));
-        } else {
-            entityItemID = EntityItemID(QUuid::createUuid());
+    return success;
+}
+
+EntityItemProperties EntityTree::propertiesFromMap(QVariantMap& entityMap, int contentVersion,
+                                                   QScriptEngine& scriptEngine) const {
+    // handle parentJointName for wearables
+    if (_myAvatar && entityMap.contains("parentJointName") && entityMap.contains("parentID") &&
+        QUuid(entityMap["parentID"].toString()) == AVATAR_SELF_ID) {
+
+        entityMap["parentJointIndex"] = _myAvatar->getJointIndex(entityMap["parentJointName"].toString());
+
+        qCDebug(entities) << "Found parentJointName " << entityMap["parentJointName"].toString() <<
+            " mapped it to parentJointIndex " << entityMap["parentJointIndex"].toInt();
+    }
+
+    QScriptValue entityScriptValue = variantMapToScriptValue(entityMap, scriptEngine);
+    EntityItemProperties properties;
+    EntityItemPropertiesFromScriptValueIgnoreReadOnly(entityScriptValue, properties);
+
+    // Convert old clientOnly bool to new entityHostType enum
+    // (must happen before setOwningAvatarID below)
+    if (contentVersion < (int)EntityVersion::EntityHostTypes) {
+        if (entityMap.contains("clientOnly")) {
+            properties.setEntityHostType(entityMap["clientOnly"].toBool() ? entity::HostType::AVATAR : entity::HostType::DOMAIN);
         }
+    }
 
-        // Convert old clientOnly bool to new entityHostType enum
-        // (must happen before setOwningAvatarID below)
-        if (contentVersion < (int)EntityVersion::EntityHostTypes) {
-            if (entityMap.contains("clientOnly")) {
-                properties.setEntityHostType(entityMap["clientOnly"].toBool() ? entity::HostType::AVATAR : entity::HostType::DOMAIN);
+    if (properties.getEntityHostType() == entity::HostType::AVATAR) {
+        auto nodeList = DependencyManager::get<NodeList>();
+        const QUuid myNodeID = nodeList->getSessionUUID();
+        properties.setOwningAvatarID(myNodeID);
+    }
+
+    // Fix for older content not containing mode fields in the zones
+    if (contentVersion < (int)EntityVersion::ZoneLightInheritModes && (properties.getType() == EntityTypes::EntityType::Zone)) {
+        // The legacy version had no keylight mode - this is set to on
+        properties.setKeyLightMode(COMPONENT_MODE_ENABLED);
+
+        // The ambient URL has been moved from "keyLight" to "ambientLight"
+        if (entityMap.contains("keyLight")) {
+            QVariantMap keyLightObject = entityMap["keyLight"].toMap();
+            properties.getAmbientLight().setAmbientURL(keyLightObject["ambientURL"].toString());
+        }
+
+        // Copy the skybox URL if the ambient URL is empty, as this is the legacy behaviour
+        // Use skybox value only if it is not empty, else set ambientMode to inherit (to use default URL)
+        properties.setAmbientLightMode(COMPONENT_MODE_ENABLED);
+        if (properties.getAmbientLight().getAmbientURL() == "") {
+            if (properties.getSkybox().getURL() != "") {
+                properties.getAmbientLight().setAmbientURL(properties.getSkybox().getURL());
+            } else {
+                properties.setAmbientLightMode(COMPONENT_MODE_INHERIT);
             }
         }
 
-        if (properties.getEntityHostType() == entity::HostType::AVATAR) {
-            auto nodeList = DependencyManager::get<NodeList>();
-            const QUuid myNodeID = nodeList->getSessionUUID();
-            properties.setOwningAvatarID(myNodeID);
+        // The background should be enabled if the mode is skybox
+        // Note that if the values are default then they are not stored in the JSON file
+        if (entityMap.contains("backgroundMode") && (entityMap["backgroundMode"].toString() == "skybox")) {
+            properties.setSkyboxMode(COMPONENT_MODE_ENABLED);
+        } else {
+            properties.setSkyboxMode(COMPONENT_MODE_INHERIT);
         }
+    }
 
-        // Fix for older content not containing mode fields in the zones
-        if (contentVersion < (int)EntityVersion::ZoneLightInheritModes && (properties.getType() == EntityTypes::EntityType::Zone)) {
-            // The legacy version had no keylight mode - this is set to on
-            properties.setKeyLightMode(COMPONENT_MODE_ENABLED);
+    // Convert old materials so that they use materialData instead of userData
+    if (contentVersion < (int)EntityVersion::MaterialData && properties.getType() == EntityTypes::EntityType::Material) {
+        if (properties.getMaterialURL().startsWith("userData")) {
+            QString materialURL = properties.getMaterialURL();
+            properties.setMaterialURL(materialURL.replace("userData", "materialData"));
 
-            // The ambient URL has been moved from "keyLight" to "ambientLight"
-            if (entityMap.contains("keyLight")) {
-                QVariantMap keyLightObject = entityMap["keyLight"].toMap();
-                properties.getAmbientLight().setAmbientURL(keyLightObject["ambientURL"].toString());
+            QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
+            QJsonObject materialData;
+            QJsonValue materialVersion = userData["materialVersion"];
+            if (!materialVersion.isNull()) {
+                materialData.insert("materialVersion", materialVersion);
+                userData.remove("materialVersion");
             }
-
-            // Copy the skybox URL if the ambient URL is empty, as this is the legacy behaviour
-            // Use skybox value only if it is not empty, else set ambientMode to inherit (to use default URL)
-            properties.setAmbientLightMode(COMPONENT_MODE_ENABLED);
-            if (properties.getAmbientLight().getAmbientURL() == "") {
-                if (properties.getSkybox().getURL() != "") {
-                    properties.getAmbientLight().setAmbientURL(properties.getSkybox().getURL());
-                } else {
-                    properties.setAmbientLightMode(COMPONENT_MODE_INHERIT);
-                }
+            QJsonValue materials = userData["materials"];
+            if (!materials.isNull()) {
+                materialData.insert("materials", materials);
+                userData.remove("materials");
             }
 
-            // The background should be enabled if the mode is skybox
-            // Note that if the values are default then they are not stored in the JSON file
-            if (entityMap.contains("backgroundMode") && (entityMap["backgroundMode"].toString() == "skybox")) {
-                properties.setSkyboxMode(COMPONENT_MODE_ENABLED);
-            } else {
-                properties.setSkyboxMode(COMPONENT_MODE_INHERIT);
-            }
+            properties.setMaterialData(QJsonDocument(materialData).toJson());
+            properties.setUserData(QJsonDocument(userData).toJson());
         }
+    }
 
-        // Convert old materials so that they use materialData instead of userData
-        if (contentVersion < (int)EntityVersion::MaterialData && properties.getType() == EntityTypes::EntityType::Material) {
-            if (properties.getMaterialURL().startsWith("userData")) {
-                QString materialURL = properties.getMaterialURL();
-                properties.setMaterialURL(materialURL.replace("userData", "materialData"));
+    // Convert old cloneable entities so they use cloneableData instead of userData
+    if (contentVersion < (int)EntityVersion::CloneableData) {
+        QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
+        QJsonObject grabbableKey = userData["grabbableKey"].toObject();
+        QJsonValue cloneable = grabbableKey["cloneable"];
+        if (cloneable.isBool() && cloneable.toBool()) {
+            QJsonValue cloneLifetime = grabbableKey["cloneLifetime"];
+            QJsonValue cloneLimit = grabbableKey["cloneLimit"];
+            QJsonValue cloneDynamic = grabbableKey["cloneDynamic"];
+            QJsonValue cloneAvatarEntity = grabbableKey["cloneAvatarEntity"];
 
-                QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
-                QJsonObject materialData;
-                QJsonValue materialVersion = userData["materialVersion"];
-                if (!materialVersion.isNull()) {
-                    materialData.insert("materialVersion", materialVersion);
-                    userData.remove("materialVersion");
-                }
-                QJsonValue materials = userData["materials"];
-                if (!materials.isNull()) {
-                    materialData.insert("materials", materials);
-                    userData.remove("materials");
-                }
+            // This is cloneable, we need to convert the properties
+            properties.setCloneable(true);
+            properties.setCloneLifetime(cloneLifetime.toInt());
+            properties.setCloneLimit(cloneLimit.toInt());
+            properties.setCloneDynamic(cloneDynamic.toBool());
+            properties.setCloneAvatarEntity(cloneAvatarEntity.toBool());
+        }
+    }
 
-                properties.setMaterialData(QJsonDocument(materialData).toJson());
-                properties.setUserData(QJsonDocument(userData).toJson());
-            }
+    // convert old grab-related userData to new grab properties
+    if (contentVersion < (int)EntityVersion::GrabProperties) {
+        convertGrabUserDataToProperties(properties);
+    }
+
+    // Zero out the spread values that were fixed in version ParticleEntityFix so they behave the same as before
+    if (contentVersion < (int)EntityVersion::ParticleEntityFix) {
+        properties.setRadiusSpread(0.0f);
+        properties.setAlphaSpread(0.0f);
+        properties.setColorSpread({0, 0, 0});
+    }
+
+    if (contentVersion < (int)EntityVersion::FixPropertiesFromCleanup) {
+        if (entityMap.contains("created")) {
+            quint64 created = QDateTime::fromString(entityMap["created"].toString().trimmed(), Qt::ISODate).toMSecsSinceEpoch() * 1000;
+            properties.setCreated(created);
         }
+    }
 
-        // Convert old cloneable entities so they use cloneableData instead of userData
-        if (contentVersion < (int)EntityVersion::CloneableData) {
-            QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
-            QJsonObject grabbableKey = userData["grabbableKey"].toObject();
-            QJsonValue cloneable = grabbableKey["cloneable"];
-            if (cloneable.isBool() && cloneable.toBool()) {
-                QJsonValue cloneLifetime = grabbableKey["cloneLifetime"];
-                QJsonValue cloneLimit = grabbableKey["cloneLimit"];
-                QJsonValue cloneDynamic = grabbableKey["cloneDynamic"];
-                QJsonValue cloneAvatarEntity = grabbableKey["cloneAvatarEntity"];
+    return properties;
+}
+
+bool EntityTree::writeToJSON(QString& jsonString, const OctreeElementPointer& element) {
+    QScriptEngine scriptEngine;
+    RecurseOctreeToJSONOperator theOperator(element, &scriptEngine, jsonString);
+    withReadLock([&] {
+        recurseTreeWithOperator(&theOperator);
+    });
 
-                // This is cloneable, we need to convert the properties
-                properties.setCloneable(true);
-                properties.setCloneLifetime(cloneLifetime.toInt());
-                properties.setCloneLimit(cloneLimit.toInt());
-                properties.setCloneDynamic(cloneDynamic.toBool());
-                properties.setCloneAvatarEntity(cloneAvatarEntity.toBool());
+    // converting the entities takes much longer than finding them, so it's done without holding up edits
+    theOperator.convertEntities();
+    jsonString = theOperator.getJson();
+    return true;
+}
+
+namespace {
+    const int MIN_PERSIST_ENTITY_BUFFER_SIZE = 16 * 1024; // bytes
+    const int MAX_PERSIST_ENTITY_BUFFER_SIZE = 64 * 1024 * 1024; // bytes
+
+    // persist log records
+    const uint8_t PERSIST_LOG_PUT_ENTITY = 1; // entity id then the entity, as a block of one for readEntityDataFromBuffer()
+    const uint8_t PERSIST_LOG_DELETE_ENTITIES = 2; // entity ids
+
+    const int NUM_BYTES_RFC4122_UUID = 16;
+
+    // encodes all of an entity for persisting, an entity is never split, so this grows the buffer until it fits in one go
+    class PersistEntityEncoder {
+    public:
+        bool encode(const EntityItemPointer& entity) {
+            _packetData.reset();
+            _extraEncodeData->entities.clear();
+            auto appendState = entity->appendEntityData(&_packetData, _params, _extraEncodeData, true);
+            while (appendState != OctreeElement::COMPLETED && _bufferSize < MAX_PERSIST_ENTITY_BUFFER_SIZE) {
+                _bufferSize *= 2;
+                _packetData.changeSettings(false, _bufferSize);
+                _extraEncodeData->entities.clear();
+                appendState = entity->appendEntityData(&_packetData, _params, _extraEncodeData, true);
             }
+
+            if (appendState != OctreeElement::COMPLETED) {
+                qCWarning(entities) << "Entity" << entity->getEntityItemID() << "is too large to persist";
+                return false;
+            }
+            return true;
         }
 
-        // convert old grab-related userData to new grab properties
-        if (contentVersion < (int)EntityVersion::GrabProperties) {
-            convertGrabUserDataToProperties(properties);
+        const char* getData() { return (const char*)_packetData.getUncompressedData(); }
+        int getSize() const { return _packetData.getUncompressedSize(); }
+
+    private:
+        int _bufferSize { MIN_PERSIST_ENTITY_BUFFER_SIZE };
+        OctreePacketData _packetData { false, MIN_PERSIST_ENTITY_BUFFER_SIZE };
+        EntityTreeElementExtraEncodeDataPointer _extraEncodeData { new EntityTreeElementExtraEncodeData() };
+        EncodeBitstreamParams _params;
+    };
+}
+
+bool EntityTree::writeToBinary(OctreeBinaryWriter& writer, const OctreeElementPointer& element) {
+    // every block holds whole entities, laid out the way readEntityDataFromBuffer() takes them: a count and the entities
+    const int TARGET_BLOCK_SIZE = 256 * 1024; // bytes
+    const uint16_t MAX_ENTITIES_PER_BLOCK = std::numeric_limits<uint16_t>::max();
+
+    PersistEntityEncoder encoder;
+    QByteArray block;
+    uint16_t numEntities = 0;
+    bool success = true;
+
+    auto startBlock = [&] {
+        block.resize(sizeof(numEntities));
+        numEntities = 0;
+    };
+    auto finishBlock = [&] {
+        if (numEntities > 0) {
+            memcpy(block.data(), &numEntities, sizeof(numEntities));
+            success = writer.writeBlock(block) && success;
         }
+        startBlock();
+    };
+
+    startBlock();
+    withReadLock([&] {
+        recurseElementWithOperation(element, [&](const OctreeElementPointer& element, void* extraData) {
+            auto entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+            entityTreeElement->forEachEntity([&](const EntityItemPointer& entity) {
+                if (!success) {
+                    return;
+                }
+
+                // leave the previous file in place rather than drop an entity
+                success = encoder.encode(entity);
+                if (success) {
+                    block.append(encoder.getData(), encoder.getSize());
+                    if (++numEntities == MAX_ENTITIES_PER_BLOCK || block.size() >= TARGET_BLOCK_SIZE) {
+                        finishBlock();
+                    }
+                }
+            });
+            return success;
+        }, nullptr);
+    });
+    finishBlock();
+
+    return success;
+}
+
+bool EntityTree::readFromBinary(OctreeBinaryReader& reader) {
+    _persistID = reader.getHeader().id;
+    _persistDataVersion = reader.getHeader().dataVersion;
+
+    // decode everything in place, then add it all at once
+    ReadBitstreamToTreeParams args;
+    const unsigned char* block = nullptr;
+    int blockSize = 0;
+    bool success = true;
+    while (success && reader.readBlock(block, blockSize)) {
+        success = readEntityDataFromBuffer(block, blockSize, args) == blockSize;
+    }
+    if (!success || !reader.isAtEnd()) {
+        qCWarning(entities) << "Binary entity data is corrupt, read" << _entitiesToAdd.size() << "entities";
+        success = false;
+    }
+
+    addPersistedEntities();
+    return success;
+}
+
+void EntityTree::setTrackPersistChanges(bool track) {
+    QWriteLocker locker(&_persistChangesLock);
+    _trackPersistChanges = track;
+    _persistChangedEntities.clear();
+    _persistDeletedEntities.clear();
+}
+
+void EntityTree::trackPersistChange(const EntityItemID& entityID, bool deleted) {
+    if (!_trackPersistChanges) {
+        return;
+    }
+
+    // only the last thing that happened to an entity is logged
+    QWriteLocker locker(&_persistChangesLock);
+    if (deleted) {
+        _persistChangedEntities.remove(entityID);
+        _persistDeletedEntities.insert(entityID);
+    } else {
+        _persistDeletedEntities.remove(entityID);
+        _persistChangedEntities.insert(entityID);
+    }
+}
+
+bool EntityTree::writeToPersistLog(OctreePersistLog& log) {
+    QSet<EntityItemID> changedEntities;
+    QSet<EntityItemID> deletedEntities;
+    {
+        QWriteLocker locker(&_persistChangesLock);
+        changedEntities.swap(_persistChangedEntities);
+        deletedEntities.swap(_persistDeletedEntities);
+    }
 
-        // Zero out the spread values that were fixed in version ParticleEntityFix so they behave the same as before
-        if (contentVersion < (int)EntityVersion::ParticleEntityFix) {
-            properties.setRadiusSpread(0.0f);
-            properties.setAlphaSpread(0.0f);
-            properties.setColorSpread({0, 0, 0});
+    if (!deletedEntities.isEmpty()) {
+        QByteArray record;
+        record.reserve(deletedEntities.size() * NUM_BYTES_RFC4122_UUID);
+        for (const auto& entityID : deletedEntities) {
+            record.append(entityID.toRfc4122());
         }
+        log.append(PERSIST_LOG_DELETE_ENTITIES, record);
+    }
 
-        if (contentVersion < (int)EntityVersion::FixPropertiesFromCleanup) {
-            if (entityMap.contains("created")) {
-                quint64 created = QDateTime::fromString(entityMap["created"].toString().trimmed(), Qt::ISODate).toMSecsSinceEpoch() * 1000;
-                properties.setCreated(created);
+    PersistEntityEncoder encoder;
+    bool success = true;
+    withReadLock([&] {
+        for (const auto& entityID : changedEntities) {
+            auto entity = findEntityByEntityItemID(entityID);
+            if (!entity) {
+                // deleted since, which goes in the next batch
+                continue;
             }
-        }
 
-        EntityItemPointer entity = addEntity(entityItemID, properties);
-        if (!entity) {
-            qCDebug(entities) << "adding Entity failed:" << entityItemID << properties.getType();
-            success = false;
+            success = encoder.encode(entity);
+            if (!success) {
+                break;
+            }
+
+            const uint16_t NUM_ENTITIES = 1;
+            QByteArray record = entityID.toRfc4122();
+            record.append((const char*)&NUM_ENTITIES, sizeof(NUM_ENTITIES));
+            record.append(encoder.getData(), encoder.getSize());
+            log.append(PERSIST_LOG_PUT_ENTITY, record);
         }
+    });
 
-        if (entity) {
-            const QUuid& cloneOriginID = entity->getCloneOriginID();
-            if (!cloneOriginID.isNull()) {
-                cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+    return log.flush() && success;
+}
+
+bool EntityTree::readFromPersistLog(OctreeBinaryReader& reader) {
+    ReadBitstreamToTreeParams args;
+    const unsigned char* record = nullptr;
+    int recordSize = 0;
+    int numRecords = 0;
+    bool success = true;
+    while (success && reader.readBlock(record, recordSize)) {
+        uint8_t recordType = record[0];
+        const unsigned char* data = record + 1;
+        int dataSize = recordSize - 1;
+
+        if (recordType == PERSIST_LOG_PUT_ENTITY && dataSize > NUM_BYTES_RFC4122_UUID) {
+            EntityItemID entityID(QUuid::fromRfc4122(QByteArray::fromRawData((const char*)data, NUM_BYTES_RFC4122_UUID)));
+            data += NUM_BYTES_RFC4122_UUID;
+            dataSize -= NUM_BYTES_RFC4122_UUID;
+
+            // the log is newer than what's loaded whatever the edit times say
+            auto entity = findEntityByEntityItemID(entityID);
+            if (entity) {
+                entity->setLastEdited(0);
+            }
+            success = readEntityDataFromBuffer(data, dataSize, args) == dataSize;
+        } else if (recordType == PERSIST_LOG_DELETE_ENTITIES && dataSize % NUM_BYTES_RFC4122_UUID == 0) {
+            // an entity may be deleted by the same log that added it
+            addPersistedEntities();
+
+            std::vector<EntityItemPointer> entities;
+            for (int offset = 0; offset < dataSize; offset += NUM_BYTES_RFC4122_UUID) {
+                auto entityID = QUuid::fromRfc4122(QByteArray::fromRawData((const char*)data + offset, NUM_BYTES_RFC4122_UUID));
+                auto entity = findEntityByID(entityID);
+                if (entity) {
+                    entities.push_back(entity);
+                }
             }
+            deleteEntitiesByPointer(entities);
+        } else {
+            success = false;
         }
+        ++numRecords;
     }
 
-    for (const auto& entityID : cloneIDs.keys()) {
-        auto entity = findEntityByID(entityID);
-        if (entity) {
-            entity->setCloneIDs(cloneIDs.value(entityID));
-        }
+    if (!success) {
+        qCWarning(entities) << "Entity persist log is corrupt at record" << numRecords;
+    } else if (reader.getBytesLeft() > 0) {
+        // the server went down part way through writing the last record, the ones before it are intact
+        qCWarning(entities) << "Entity persist log ends in an incomplete record, ignoring it";
     }
+    qCDebug(entities) << "Replayed" << numRecords << "records from entity persist log";
 
+    addPersistedEntities();
     return success;
 }
 
-bool EntityTree::writeToJSON(QString& jsonString, const OctreeElementPointer& element) {
-    QScriptEngine scriptEngine;
-    RecurseOctreeToJSONOperator theOperator(element, &scriptEngine, jsonString);
-    withReadLock([&] {
+void EntityTree::addPersistedEntities() {
+    for (const auto& entity : _entitiesToAdd) {
+        // simulation ownership isn't restored from json either
+        entity->clearSimulationOwnership();
+
+        AddEntityOperator theOperator(getThisPointer(), entity);
         recurseTreeWithOperator(&theOperator);
-    });
+        postAddEntity(entity);
+    }
 
-    jsonString = theOperator.getJson();
-    return true;
+    // clone ids aren't persisted, they are found from the clones once all of them are in the tree
+    for (const auto& entity : _entitiesToAdd) {
+        const QUuid& cloneOriginID = entity->getCloneOriginID();
+        if (!cloneOriginID.isNull()) {
+            auto cloneOrigin = findEntityByID(cloneOriginID);
+            if (cloneOrigin) {
+                cloneOrigin->addCloneID(entity->getEntityItemID());
+            }
+        }
+    }
+    _entitiesToAdd.clear();
+
+    if (_entityMover.hasMovingEntities()) {
+        recurseTreeWithOperator(&_entityMover);
+        _entityMover.reset();
+    }
 }
 
 void EntityTree::resetClientEditStats() {
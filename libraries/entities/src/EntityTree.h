@@ -12,6 +12,9 @@
 #ifndef hifi_EntityTree_h
 #define hifi_EntityTree_h
 
+#include <atomic>
+#include <cfloat>
+
 #include <QSet>
 #include <QVector>
 
@@ -20,6 +23,8 @@
 
 #include "AddEntityOperator.h"
 #include "EntityTreeElement.h"
+#include "EntityItemMap.h"
+#include "EntitySpatialIndex.h"
 #include "DeleteEntityOperator.h"
 #include "MovingEntitiesOperator.h"
 
@@ -27,6 +32,7 @@ class EntityTree;
 using EntityTreePointer = std::shared_ptr<EntityTree>;
 
 class EntitySimulation;
+class QScriptEngine;
 
 namespace EntityQueryFilterSymbol {
     static const QString NonDefault = "+";
@@ -99,6 +105,21 @@ public:
         BoxFace& face, glm::vec3& surfaceNormal, QVariantMap& extraInfo,
         Octree::lockType lockType = Octree::TryLock, bool* accurateResult = NULL);
 
+    class RayIntersection {
+    public:
+        EntityItemID entityID;
+        float distance { FLT_MAX };
+        BoxFace face { UNKNOWN_FACE };
+        glm::vec3 surfaceNormal;
+        QVariantMap extraInfo;
+    };
+
+    // picks with many rays at once, e.g. a laser for each hand, under a single lock
+    void evalRayIntersections(const QVector<PickRay>& rays,
+        const QVector<EntityItemID>& entityIdsToInclude, const QVector<EntityItemID>& entityIdsToDiscard,
+        PickFilter searchFilter, QVector<RayIntersection>& intersections,
+        Octree::lockType lockType = Octree::TryLock, bool* accurateResult = NULL);
+
     virtual EntityItemID evalParabolaIntersection(const PickParabola& parabola,
         QVector<EntityItemID> entityIdsToInclude, QVector<EntityItemID> entityIdsToDiscard,
         PickFilter searchFilter, OctreeElementPointer& element, glm::vec3& intersection,
@@ -116,9 +137,18 @@ public:
 
     // The newer API...
     void postAddEntity(EntityItemPointer entityItem);
+    void postAddEntities(const std::vector<EntityItemPointer>& entities);
 
     EntityItemPointer addEntity(const EntityItemID& entityID, const EntityItemProperties& properties, bool isClone = false);
 
+    // constructs an entity without adding it to the tree, returns null if it can't be added. Safe to call from any thread.
+    EntityItemPointer constructEntity(const EntityItemID& entityID, const EntityItemProperties& properties,
+                                      bool isClone = false) const;
+
+    // adds constructed entities that aren't in the tree yet, in one pass over the octree, and returns the ones added -
+    // any with the ID of an entity already in the tree, or earlier in entities, are left out
+    std::vector<EntityItemPointer> addEntities(const std::vector<EntityItemPointer>& entities);
+
     // use this method if you only know the entityID
     bool updateEntity(const EntityItemID& entityID, const EntityItemProperties& properties, const SharedNodePointer& senderNode = SharedNodePointer(nullptr));
 
@@ -144,6 +174,9 @@ public:
     void evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities);
 
+    // kept up to date by the elements as entities are added to and removed from them
+    EntitySpatialIndex& getSpatialIndex() { return _spatialIndex; }
+
     void addNewlyCreatedHook(NewlyCreatedEntityHook* hook);
     void removeNewlyCreatedHook(NewlyCreatedEntityHook* hook);
 
@@ -197,6 +230,12 @@ public:
                             bool skipThoseWithBadParents) override;
     virtual bool readFromMap(QVariantMap& entityDescription) override;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) override;
+    virtual bool writeToBinary(OctreeBinaryWriter& writer, const OctreeElementPointer& element) override;
+    virtual bool readFromBinary(OctreeBinaryReader& reader) override;
+
+    virtual void setTrackPersistChanges(bool track) override;
+    virtual bool writeToPersistLog(OctreePersistLog& log) override;
+    virtual bool readFromPersistLog(OctreeBinaryReader& reader) override;
 
 
     glm::vec3 getContentsDimensions();
@@ -313,6 +352,14 @@ protected:
     mutable QReadWriteLock _recentlyDeletedEntitiesLock; /// lock of server side recent deletes
     QMultiMap<quint64, QUuid> _recentlyDeletedEntityItemIDs; /// server side recent deletes
 
+    void trackPersistChange(const EntityItemID& entityID, bool deleted = false);
+    void addPersistedEntities();
+
+    std::atomic<bool> _trackPersistChanges { false };
+    mutable QReadWriteLock _persistChangesLock; /// lock of changes not yet in the persist log
+    QSet<EntityItemID> _persistChangedEntities; /// added or edited since last written to the persist log
+    QSet<EntityItemID> _persistDeletedEntities; /// deleted since last written to the persist log
+
     mutable QReadWriteLock _deletedEntitiesLock; /// lock of client side recent deletes
     QSet<QUuid> _deletedEntityItemIDs; /// client side recent deletes
 
@@ -326,8 +373,7 @@ protected:
         _deletedEntityItemIDs << id;
     }
 
-    mutable QReadWriteLock _entityMapLock;
-    QHash<EntityItemID, EntityItemPointer> _entityMap;
+    EntityItemMap _entityMap;
 
     mutable QReadWriteLock _entityCertificateIDMapLock;
     QHash<QString, QList<EntityItemID>> _entityCertificateIDMap;
@@ -396,6 +442,15 @@ private:
 
     std::vector<int32_t> _staleProxies;
 
+    void findEntitiesInSphere(const glm::vec3& center, float radius, std::vector<EntityItemPointer>& candidates);
+    EntityItemID evalRayIntersectionInIndex(const glm::vec3& origin, const glm::vec3& direction,
+        const QVector<EntityItemID>& entityIdsToInclude, const QVector<EntityItemID>& entityIdsToDiscard,
+        PickFilter searchFilter, OctreeElementPointer& element, float& distance,
+        BoxFace& face, glm::vec3& surfaceNormal, QVariantMap& extraInfo);
+    EntitySpatialIndex _spatialIndex;
+
+    EntityItemProperties propertiesFromMap(QVariantMap& entityMap, int contentVersion, QScriptEngine& scriptEngine) const;
+
     bool _serverlessDomain { false };
 
     std::map<QString, QString> _namedPaths;
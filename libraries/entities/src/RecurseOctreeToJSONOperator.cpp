@@ -25,10 +25,18 @@ RecurseOctreeToJSONOperator::RecurseOctreeToJSONOperator(const OctreeElementPoin
 bool RecurseOctreeToJSONOperator::postRecursion(const OctreeElementPointer& element) {
     EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
 
-    entityTreeElement->forEachEntity([&](const EntityItemPointer& entity) { processEntity(entity); } );
+    entityTreeElement->forEachEntity([&](const EntityItemPointer& entity) { _entities.push_back(entity); } );
     return true;
 }
 
+void RecurseOctreeToJSONOperator::convertEntities() {
+    // each entity guards its own properties
+    for (const auto& entity : _entities) {
+        processEntity(entity);
+    }
+    _entities.clear();
+}
+
 void RecurseOctreeToJSONOperator::processEntity(const EntityItemPointer& entity) {
     if (_skipThoseWithBadParents && !entity->isParentIDValid()) {
         return;  // we weren't able to resolve a parent from _parentID, so don't save this entity.
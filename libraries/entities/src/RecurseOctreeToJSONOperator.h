@@ -18,11 +18,16 @@ public:
     virtual bool preRecursion(const OctreeElementPointer& element) override { return true; };
     virtual bool postRecursion(const OctreeElementPointer& element) override;
 
+    // the recursion only gathers the entities, call this after it - outside of the tree's lock - to convert them
+    void convertEntities();
+
     QString getJson() const { return _json; }
 
 private:
     void processEntity(const EntityItemPointer& entity);
 
+    std::vector<EntityItemPointer> _entities;
+
     QScriptEngine* _engine;
     QScriptValue _toStringMethod;
 
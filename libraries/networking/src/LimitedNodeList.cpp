@@ -409,20 +409,20 @@ qint64 LimitedNodeList::sendUnreliablePacket(const NLPacket& packet, const Node&
     return sendUnreliablePacket(packet, *destinationNode.getActiveSocket(), destinationNode.getAuthenticateHash());
 }
 
+bool LimitedNodeList::isDroppingOutgoingTrafficTo(const HifiSockAddr& sockAddr) {
+    // This only suppresses unreliable packets - sent individually or as a burst - not reliable packet lists.
+    // findNodeWithAddr returns null for the address of the domain server, so traffic to it is never dropped.
+    return _dropOutgoingNodeTraffic && !findNodeWithAddr(sockAddr).isNull();
+}
+
 qint64 LimitedNodeList::sendUnreliablePacket(const NLPacket& packet, const HifiSockAddr& sockAddr,
         HMACAuth* hmacAuth) {
     Q_ASSERT(!packet.isPartOfMessage());
     Q_ASSERT_X(!packet.isReliable(), "LimitedNodeList::sendUnreliablePacket",
                "Trying to send a reliable packet unreliably.");
 
-    if (_dropOutgoingNodeTraffic) {
-        auto destinationNode = findNodeWithAddr(sockAddr);
-
-        // findNodeWithAddr returns null for the address of the domain server
-        if (!destinationNode.isNull()) {
-            // This only suppresses individual unreliable packets, not unreliable packet lists
-            return ERROR_SENDING_PACKET_BYTES;
-        }
+    if (isDroppingOutgoingTrafficTo(sockAddr)) {
+        return ERROR_SENDING_PACKET_BYTES;
     }
 
     fillPacketHeader(packet, hmacAuth);
@@ -471,21 +471,49 @@ qint64 LimitedNodeList::sendPacket(std::unique_ptr<NLPacket> packet, const HifiS
     }
 }
 
-qint64 LimitedNodeList::sendUnreliableUnorderedPacketList(NLPacketList& packetList, const Node& destinationNode) {
+qint64 LimitedNodeList::sendUnreliablePackets(std::vector<std::unique_ptr<NLPacket>> packets, const Node& destinationNode) {
     auto activeSocket = destinationNode.getActiveSocket();
 
     if (activeSocket) {
-        qint64 bytesSent = 0;
-        auto connectionHash = destinationNode.getAuthenticateHash();
+        return sendUnreliablePackets(std::move(packets), *activeSocket, destinationNode.getAuthenticateHash());
+    } else {
+        qCDebug(networking) << "LimitedNodeList::sendUnreliablePackets called without active socket for node"
+            << destinationNode << "- not sending";
+        return ERROR_SENDING_PACKET_BYTES;
+    }
+}
 
-        // close the last packet in the list
-        packetList.closeCurrentPacket();
+qint64 LimitedNodeList::sendUnreliablePackets(std::vector<std::unique_ptr<NLPacket>> packets, const HifiSockAddr& sockAddr,
+                                              HMACAuth* hmacAuth) {
+    if (packets.empty()) {
+        return 0;
+    }
 
-        while (!packetList._packets.empty()) {
-            bytesSent += sendPacket(packetList.takeFront<NLPacket>(), *activeSocket,
-                connectionHash);
-        }
-        return bytesSent;
+    // a burst is dropped as a whole, the same as each of its packets would be if sent with sendUnreliablePacket
+    if (isDroppingOutgoingTrafficTo(sockAddr)) {
+        return ERROR_SENDING_PACKET_BYTES;
+    }
+
+    std::vector<std::unique_ptr<udt::Packet>> udtPackets;
+    udtPackets.reserve(packets.size());
+
+    for (auto& packet : packets) {
+        Q_ASSERT(!packet->isPartOfMessage());
+        Q_ASSERT_X(!packet->isReliable(), "LimitedNodeList::sendUnreliablePackets",
+                   "Trying to send a reliable packet unreliably.");
+
+        fillPacketHeader(*packet, hmacAuth);
+        udtPackets.push_back(std::move(packet));
+    }
+
+    return _nodeSocket.writePackets(std::move(udtPackets), sockAddr);
+}
+
+qint64 LimitedNodeList::sendUnreliableUnorderedPacketList(NLPacketList& packetList, const Node& destinationNode) {
+    auto activeSocket = destinationNode.getActiveSocket();
+
+    if (activeSocket) {
+        return sendUnreliableUnorderedPacketList(packetList, *activeSocket, destinationNode.getAuthenticateHash());
     } else {
         qCDebug(networking) << "LimitedNodeList::sendPacketList called without active socket for node" << destinationNode
             << " - not sending.";
@@ -495,16 +523,16 @@ qint64 LimitedNodeList::sendUnreliableUnorderedPacketList(NLPacketList& packetLi
 
 qint64 LimitedNodeList::sendUnreliableUnorderedPacketList(NLPacketList& packetList, const HifiSockAddr& sockAddr,
                                                           HMACAuth* hmacAuth) {
-    qint64 bytesSent = 0;
-
     // close the last packet in the list
     packetList.closeCurrentPacket();
 
+    std::vector<std::unique_ptr<NLPacket>> packets;
+    packets.reserve(packetList.getNumPackets());
     while (!packetList._packets.empty()) {
-        bytesSent += sendPacket(packetList.takeFront<NLPacket>(), sockAddr, hmacAuth);
+        packets.push_back(packetList.takeFront<NLPacket>());
     }
 
-    return bytesSent;
+    return sendUnreliablePackets(std::move(packets), sockAddr, hmacAuth);
 }
 
 qint64 LimitedNodeList::sendPacketList(std::unique_ptr<NLPacketList> packetList, const HifiSockAddr& sockAddr) {
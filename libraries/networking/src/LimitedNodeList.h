@@ -153,6 +153,12 @@ public:
     qint64 sendPacket(std::unique_ptr<NLPacket> packet, const Node& destinationNode);
     qint64 sendPacket(std::unique_ptr<NLPacket> packet, const HifiSockAddr& sockAddr, HMACAuth* hmacAuth = nullptr);
 
+    // use sendUnreliablePackets to send a burst of moved unreliable NL packets to one destination
+    // the socket coalesces them into as few writes as it can
+    qint64 sendUnreliablePackets(std::vector<std::unique_ptr<NLPacket>> packets, const Node& destinationNode);
+    qint64 sendUnreliablePackets(std::vector<std::unique_ptr<NLPacket>> packets, const HifiSockAddr& sockAddr,
+        HMACAuth* hmacAuth = nullptr);
+
     // use sendUnreliableUnorderedPacketList to unreliably send separate packets from the packet list
     // either to a node's active socket or to a manual sockaddr
     qint64 sendUnreliableUnorderedPacketList(NLPacketList& packetList, const Node& destinationNode);
@@ -308,6 +314,7 @@ public:
     void flagTimeForConnectionStep(ConnectionStep connectionStep);
 
     udt::Socket::StatsVector sampleStatsForAllConnections() { return _nodeSocket.sampleStatsForAllConnections(); }
+    quint64 getNumDroppedDatagrams() const { return _nodeSocket.getNumDroppedDatagrams(); }
 
     void setConnectionMaxBandwidth(int maxBandwidth) { _nodeSocket.setConnectionMaxBandwidth(maxBandwidth); }
 
@@ -336,6 +343,7 @@ public:
     float getInboundKbps() const { return _inboundKbps; }
     float getOutboundKbps() const { return _outboundKbps; }
 
+    // while set, unreliable packets to nodes are dropped - both single packets and sendUnreliablePackets bursts
     void setDropOutgoingNodeTraffic(bool squelchOutgoingNodeTraffic) { _dropOutgoingNodeTraffic = squelchOutgoingNodeTraffic; }
 
     const std::set<NodeType_t> SOLO_NODE_TYPES = {
@@ -416,6 +424,7 @@ protected:
     qint64 sendPacket(std::unique_ptr<NLPacket> packet, const Node& destinationNode,
                       const HifiSockAddr& overridenSockAddr);
     void fillPacketHeader(const NLPacket& packet, HMACAuth* hmacAuth = nullptr);
+    bool isDroppingOutgoingTrafficTo(const HifiSockAddr& sockAddr);
 
     void setLocalSocket(const HifiSockAddr& sockAddr);
 
@@ -118,6 +118,7 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     ioStats["inbound_pps"] = nodeList->getInboundPPS();
     ioStats["outbound_kbps"] = nodeList->getOutboundKbps();
     ioStats["outbound_pps"] = nodeList->getOutboundPPS();
+    ioStats["dropped_datagrams"] = (qint64)nodeList->getNumDroppedDatagrams();
 
     statsObject["io_stats"] = ioStats;
 
@@ -112,6 +112,7 @@ SendQueue& Connection::getSendQueue() {
         QObject::connect(_sendQueue.get(), &SendQueue::packetSent, this, &Connection::packetSent);
         QObject::connect(_sendQueue.get(), &SendQueue::packetSent, this, &Connection::recordSentPackets);
         QObject::connect(_sendQueue.get(), &SendQueue::packetRetransmitted, this, &Connection::recordRetransmission);
+        QObject::connect(_sendQueue.get(), &SendQueue::packetsBatched, this, &Connection::recordSentBatch);
         QObject::connect(_sendQueue.get(), &SendQueue::queueInactive, this, &Connection::queueInactive);
         QObject::connect(_sendQueue.get(), &SendQueue::timeout, this, &Connection::queueTimeout);
         QObject::connect(this, &Connection::destinationAddressChange, _sendQueue.get(), &SendQueue::updateDestinationAddress);
@@ -204,6 +205,10 @@ void Connection::recordSentUnreliablePackets(int wireSize, int payloadSize) {
     _stats.recordUnreliableSentPackets(payloadSize, wireSize);
 }
 
+void Connection::recordSentBatch(int numPackets, int numSyscalls) {
+    _stats.recordSentBatch(numPackets, numSyscalls);
+}
+
 void Connection::recordReceivedUnreliablePackets(int wireSize, int payloadSize) {
     _stats.recordUnreliableReceivedPackets(payloadSize, wireSize);
 }
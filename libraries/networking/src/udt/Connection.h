@@ -77,6 +77,7 @@ public:
     
     void recordSentUnreliablePackets(int wireSize, int payloadSize);
     void recordReceivedUnreliablePackets(int wireSize, int payloadSize);
+    void recordSentBatch(int numPackets, int numSyscalls);
     void setDestinationAddress(const HifiSockAddr& destination);
 
 signals:
@@ -82,6 +82,11 @@ void ConnectionStats::recordUnreliableReceivedPackets(int payload, int total) {
     _currentSample.receivedUnreliableBytes += total;
 }
 
+void ConnectionStats::recordSentBatch(int numPackets, int numSyscalls) {
+    _currentSample.sentBatchedPackets += numPackets;
+    _currentSample.sentBatchSyscalls += numSyscalls;
+}
+
 void ConnectionStats::recordCongestionWindowSize(int sample) {
     _currentSample.congestionWindowSize = sample;
 }
@@ -106,6 +111,8 @@ QDebug& operator<<(QDebug&& debug, const udt::ConnectionStats::Stats& stats) {
     debug << "\n     Duplicate packets: " << stats.duplicatePackets;
     debug << "\n     Sent util bytes: " << stats.sentUtilBytes;
     debug << "\n     Sent bytes: " << stats.sentBytes;
-    debug << "\n     Received bytes: " << stats.receivedBytes << "\n";
+    debug << "\n     Received bytes: " << stats.receivedBytes;
+    debug << "\n     Sent batched packets: " << stats.sentBatchedPackets;
+    debug << "\n     Sent batch syscalls: " << stats.sentBatchSyscalls << "\n";
     return debug;
 }
@@ -60,6 +60,10 @@ public:
         uint64_t receivedUnreliableUtilBytes { 0 };
         uint64_t sentUnreliableBytes { 0 };
         uint64_t receivedUnreliableBytes { 0 };
+
+        // packets written in batches, and the number of send syscalls it took to write them
+        uint32_t sentBatchedPackets { 0 };
+        uint32_t sentBatchSyscalls { 0 };
        
         // the following stats are trailing averages in the result, not totals
         int sendRate { 0 };
@@ -91,6 +95,8 @@ public:
     void recordUnreliableSentPackets(int payload, int total);
     void recordUnreliableReceivedPackets(int payload, int total);
 
+    void recordSentBatch(int numPackets, int numSyscalls);
+
     void recordCongestionWindowSize(int sample);
     void recordPacketSendPeriod(int sample);
     
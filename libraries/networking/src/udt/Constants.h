@@ -27,6 +27,11 @@ namespace udt {
     static const int UDP_SEND_BUFFER_SIZE_BYTES = 1048576;
     static const int UDP_RECEIVE_BUFFER_SIZE_BYTES = 1048576;
     static const int DEFAULT_SYN_INTERVAL_USECS = 10 * 1000;
+    static const int MAX_UDP_DATAGRAM_SIZE_BYTES = 65535 - UDP_IPV4_HEADER_SIZE;
+    static const int RECEIVE_BATCH_SIZE_PACKETS = 64;
+    static const int RECEIVE_BUFFER_POOL_MAX_IDLE_PACKETS = 1024;
+    static const int SEND_BATCH_SIZE_PACKETS = 64;
+    static const int MAX_SEGMENTATION_OFFLOAD_BYTES = 65000;
 
     
     // Header constants
@@ -11,34 +11,42 @@
 
 #include "LossList.h"
 
+#include <iterator>
+
 #include "ControlPacket.h"
 
 using namespace udt;
 using namespace std;
 
+LossList::Ranges::iterator LossList::moveRangeStart(Ranges::iterator it, SequenceNumber newStart) {
+    auto last = it->second;
+    it = _lossList.erase(it);
+    return _lossList.emplace_hint(it, newStart, last);
+}
+
 void LossList::append(SequenceNumber seq) {
-    Q_ASSERT_X(_lossList.empty() || (_lossList.back().second < seq), "LossList::append(SequenceNumber)",
+    Q_ASSERT_X(_lossList.empty() || (_lossList.rbegin()->second < seq), "LossList::append(SequenceNumber)",
                "SequenceNumber appended is not greater than the last SequenceNumber in the list");
     
-    if (getLength() > 0 && _lossList.back().second + 1 == seq) {
-        ++_lossList.back().second;
+    if (getLength() > 0 && _lossList.rbegin()->second + 1 == seq) {
+        ++_lossList.rbegin()->second;
     } else {
-        _lossList.push_back(make_pair(seq, seq));
+        _lossList.emplace_hint(_lossList.end(), seq, seq);
     }
     _length += 1;
 }
 
 void LossList::append(SequenceNumber start, SequenceNumber end) {
-    Q_ASSERT_X(_lossList.empty() || (_lossList.back().second < start),
+    Q_ASSERT_X(_lossList.empty() || (_lossList.rbegin()->second < start),
                "LossList::append(SequenceNumber, SequenceNumber)",
                "SequenceNumber range appended is not greater than the last SequenceNumber in the list");
     Q_ASSERT_X(start <= end,
                "LossList::append(SequenceNumber, SequenceNumber)", "Range start greater than range end");
 
-    if (getLength() > 0 && _lossList.back().second + 1 == start) {
-        _lossList.back().second = end;
+    if (getLength() > 0 && _lossList.rbegin()->second + 1 == start) {
+        _lossList.rbegin()->second = end;
     } else {
-        _lossList.push_back(make_pair(start, end));
+        _lossList.emplace_hint(_lossList.end(), start, end);
     }
     _length += seqlen(start, end);
 }
@@ -47,60 +55,55 @@ void LossList::insert(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::insert(SequenceNumber, SequenceNumber)", "Range start greater than range end");
     
-    auto it = find_if_not(_lossList.begin(), _lossList.end(), [&start](pair<SequenceNumber, SequenceNumber> pair){
-        return pair.second < start;
-    });
-    
-    if (it == _lossList.end() || end < it->first) {
-        // No overlap, simply insert
-        _length += seqlen(start, end);
-        _lossList.insert(it, make_pair(start, end));
-    } else {
-        // If it starts before segment, extend segment
-        if (start < it->first) {
-            _length += seqlen(start, it->first - 1);
-            it->first = start;
-        }
-        
+    // find the last range starting at or before start, and see if the new range touches it
+    auto it = _lossList.upper_bound(start);
+    auto current = _lossList.end();
+
+    if (it != _lossList.begin() && prev(it)->second + 1 >= start) {
+        current = prev(it);
+
         // If it ends after segment, extend segment
-        if (end > it->second) {
-            _length += seqlen(it->second + 1, end);
-            it->second = end;
+        if (end > current->second) {
+            _length += seqlen(current->second + 1, end);
+            current->second = end;
         }
-        
-        auto it2 = it;
-        ++it2;
-        // For all ranges touching the current range
-        while (it2 != _lossList.end() && it->second >= it2->first - 1) {
-            // extend current range if necessary
-            if (it->second < it2->second) {
-                _length += seqlen(it->second + 1, it2->second);
-                it->second = it2->second;
-            }
-            
-            // Remove overlapping range
-            _length -= seqlen(it2->first, it2->second);
-            it2 = _lossList.erase(it2);
+    } else {
+        // No overlap before it, insert it as its own segment
+        _length += seqlen(start, end);
+        current = _lossList.emplace_hint(it, start, end);
+    }
+    
+    auto it2 = next(current);
+    // For all ranges touching the current range
+    while (it2 != _lossList.end() && current->second + 1 >= it2->first) {
+        // extend current range if necessary
+        if (current->second < it2->second) {
+            _length += seqlen(current->second + 1, it2->second);
+            current->second = it2->second;
         }
+        
+        // Remove overlapping range
+        _length -= seqlen(it2->first, it2->second);
+        it2 = _lossList.erase(it2);
     }
 }
 
 bool LossList::remove(SequenceNumber seq) {
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&seq](pair<SequenceNumber, SequenceNumber> pair) {
-        return pair.first <= seq && seq <= pair.second;
-    });
+    auto it = _lossList.upper_bound(seq);
     
-    if (it != end(_lossList)) {
+    if (it != _lossList.begin() && seq <= prev(it)->second) {
+        --it;
+
         if (it->first == it->second) {
             _lossList.erase(it);
         } else if (seq == it->first) {
-            ++it->first;
+            moveRangeStart(it, seq + 1);
         } else if (seq == it->second) {
             --it->second;
         } else {
             auto temp = it->second;
             it->second = seq - 1;
-            _lossList.insert(++it, make_pair(seq + 1, temp));
+            _lossList.emplace_hint(next(it), seq + 1, temp);
         }
         _length -= 1;
         
@@ -116,54 +119,59 @@ void LossList::remove(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::remove(SequenceNumber, SequenceNumber)", "Range start greater than range end");
     // Find the first segment sharing sequence numbers
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&start, &end](pair<SequenceNumber, SequenceNumber> pair) {
-        return (pair.first <= start && start <= pair.second) || (start <= pair.first && pair.first <= end);
-    });
+    auto it = _lossList.upper_bound(start);
+    if (it != _lossList.begin() && start <= prev(it)->second) {
+        --it;
+    }
     
-    // If we found one
-    if (it != _lossList.end()) {
-        
-        // While the end of the current segment is contained, either shorten it (first one only - sometimes)
-        // or remove it altogether since it is fully contained it the range
-        while (it != _lossList.end() && end >= it->second) {
-            if (start <= it->first) {
-                // Segment is contained, update new length and erase it.
-                _length -= seqlen(it->first, it->second);
-                it = _lossList.erase(it);
-            } else {
-                // Beginning of segment not contained, modify end of segment.
-                // Will only occur sometimes one the first loop
-                _length -= seqlen(start, it->second);
-                it->second = start - 1;
-                ++it;
-            }
-        }
-        
-        // There might be more to remove
-        if (it != _lossList.end() && it->first <= end) {
-            if (start <= it->first) {
-                // Truncate beginning of segment
-                _length -= seqlen(it->first, end);
-                it->first = end + 1;
-            } else {
+    // While the current segment overlaps the range, shorten it, cut it in half or remove it altogether
+    while (it != _lossList.end() && it->first <= end) {
+        if (it->first < start) {
+            if (end < it->second) {
                 // Cut it in half if the range we are removing is contained within one segment
                 _length -= seqlen(start, end);
                 auto temp = it->second;
                 it->second = start - 1;
-                _lossList.insert(++it, make_pair(end + 1, temp));
+                _lossList.emplace_hint(next(it), end + 1, temp);
+                return;
             }
+
+            // Beginning of segment not contained, modify end of segment.
+            // Will only occur on the first loop
+            _length -= seqlen(start, it->second);
+            it->second = start - 1;
+            ++it;
+        } else if (end < it->second) {
+            // Truncate beginning of segment, nothing after it can overlap
+            _length -= seqlen(it->first, end);
+            moveRangeStart(it, end + 1);
+            return;
+        } else {
+            // Segment is contained, update new length and erase it.
+            _length -= seqlen(it->first, it->second);
+            it = _lossList.erase(it);
         }
     }
 }
 
 SequenceNumber LossList::getFirstSequenceNumber() const {
     Q_ASSERT_X(getLength() > 0, "LossList::getFirstSequenceNumber()", "Trying to get first element of an empty list");
-    return _lossList.front().first;
+    return _lossList.begin()->first;
 }
 
 SequenceNumber LossList::popFirstSequenceNumber() {
-    auto front = getFirstSequenceNumber();
-    remove(front);
+    Q_ASSERT_X(getLength() > 0, "LossList::popFirstSequenceNumber()", "Trying to pop first element of an empty list");
+
+    auto it = _lossList.begin();
+    auto front = it->first;
+
+    if (it->first == it->second) {
+        _lossList.erase(it);
+    } else {
+        moveRangeStart(it, front + 1);
+    }
+    _length -= 1;
+
     return front;
 }
 
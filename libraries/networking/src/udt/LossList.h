@@ -12,14 +12,18 @@
 #ifndef hifi_LossList_h
 #define hifi_LossList_h
 
-#include <list>
+#include <map>
 
 #include "SequenceNumber.h"
 
 namespace udt {
 
 class ControlPacket;
-    
+
+// Lost sequence numbers kept as disjoint ranges in a map keyed by range start (first -> last),
+// so that finding the range a sequence number falls in is logarithmic in the number of holes.
+// Like the rest of udt, ordering relies on SequenceNumber's wrap-around comparison,
+// so everything in the list must be within SequenceNumber::THRESHOLD of everything else.
 class LossList {
 public:
     LossList() {}
@@ -30,7 +34,7 @@ public:
     void append(SequenceNumber seq);
     void append(SequenceNumber start, SequenceNumber end);
     
-    // inserts anywhere - MUCH slower
+    // inserts anywhere - slower
     void insert(SequenceNumber start, SequenceNumber end);
     
     bool remove(SequenceNumber seq);
@@ -44,7 +48,12 @@ public:
     void write(ControlPacket& packet, int maxPairs = -1);
     
 private:
-    std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
+    using Ranges = std::map<SequenceNumber, SequenceNumber>;
+
+    // replaces the start of a range, which as the map key can't be changed in place
+    Ranges::iterator moveRangeStart(Ranges::iterator it, SequenceNumber newStart);
+
+    Ranges _lossList;
     int _length { 0 };
 };
     
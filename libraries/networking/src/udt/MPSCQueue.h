@@ -0,0 +1,186 @@
+//
+//  MPSCQueue.h
+//  libraries/networking/src/udt
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_MPSCQueue_h
+#define hifi_MPSCQueue_h
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace udt {
+
+// Multi-producer single-consumer FIFO.
+// The common case goes through a bounded lock-free ring (one sequence number per slot, no allocation per item).
+// Bursts that don't fit in the ring spill into a locked overflow list, so push never fails or blocks on the consumer.
+// Items pushed by one thread are popped in the order that thread pushed them.
+// push() is safe from any thread, pop() and isEmpty() must only be called from the one consumer thread.
+template <typename T>
+class MPSCQueue {
+public:
+    // capacity is rounded up to a power of two
+    MPSCQueue(size_t capacity);
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    void push(T value);
+    bool pop(T& value);
+
+    bool isEmpty() const;
+
+    size_t getCapacity() const { return _mask + 1; }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    bool tryPushToRing(T& value);
+    bool tryPopFromRing(T& value);
+
+    static size_t roundUpToPowerOfTwo(size_t value);
+
+    const size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    // producers and the consumer each get their own cache line for their position
+    alignas(64) std::atomic<size_t> _enqueuePosition { 0 };
+    alignas(64) size_t _dequeuePosition { 0 };
+
+    alignas(64) std::atomic<int> _overflowSize { 0 };
+    std::mutex _overflowMutex;
+    std::list<T> _overflow;
+};
+
+template <typename T>
+size_t MPSCQueue<T>::roundUpToPowerOfTwo(size_t value) {
+    size_t powerOfTwo = 2;
+    while (powerOfTwo < value) {
+        powerOfTwo <<= 1;
+    }
+    return powerOfTwo;
+}
+
+template <typename T>
+MPSCQueue<T>::MPSCQueue(size_t capacity) :
+    _mask(roundUpToPowerOfTwo(capacity) - 1),
+    _slots(new Slot[_mask + 1])
+{
+    for (size_t i = 0; i <= _mask; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+void MPSCQueue<T>::push(T value) {
+    // once anything has spilled over, keep spilling until the consumer has caught up on it
+    // so that items from any one producer never overtake each other
+    if (_overflowSize.load(std::memory_order_acquire) == 0 && tryPushToRing(value)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    _overflow.push_back(std::move(value));
+    _overflowSize.fetch_add(1, std::memory_order_release);
+}
+
+template <typename T>
+bool MPSCQueue<T>::pop(T& value) {
+    // everything still in the ring was pushed before the current overflow started, so drain it first
+    if (tryPopFromRing(value)) {
+        return true;
+    }
+
+    if (_overflowSize.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    // a producer has claimed the slot at the head of the ring but not finished writing it - the items behind it,
+    // and anything their producers went on to push into the overflow, can't be popped before it, so wait for it
+    while (_enqueuePosition.load(std::memory_order_acquire) != _dequeuePosition) {
+        if (tryPopFromRing(value)) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    if (_overflow.empty()) {
+        return false;
+    }
+
+    value = std::move(_overflow.front());
+    _overflow.pop_front();
+    _overflowSize.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool MPSCQueue<T>::isEmpty() const {
+    auto& slot = _slots[_dequeuePosition & _mask];
+    bool isRingEmpty = slot.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1;
+    return isRingEmpty && _overflowSize.load(std::memory_order_acquire) == 0;
+}
+
+template <typename T>
+bool MPSCQueue<T>::tryPushToRing(T& value) {
+    size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true) {
+        auto& slot = _slots[position & _mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        auto difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)position;
+
+        if (difference == 0) {
+            // the slot is free for this position - claim it
+            if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                slot.value = std::move(value);
+                slot.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+            // another producer got there first, compare_exchange_weak has re-loaded the position
+        } else if (difference < 0) {
+            // the consumer hasn't freed this slot yet, the ring is full
+            return false;
+        } else {
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool MPSCQueue<T>::tryPopFromRing(T& value) {
+    auto& slot = _slots[_dequeuePosition & _mask];
+
+    if (slot.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1) {
+        // empty, or the producer that claimed this slot hasn't finished writing it
+        return false;
+    }
+
+    value = std::move(slot.value);
+
+    // hand the slot back to producers for the next time around the ring
+    slot.sequence.store(_dequeuePosition + _mask + 1, std::memory_order_release);
+    ++_dequeuePosition;
+
+    return true;
+}
+
+} // namespace udt
+
+#endif // hifi_MPSCQueue_h
@@ -0,0 +1,76 @@
+//
+//  PacketBufferPool.cpp
+//  libraries/networking/src/udt
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPool.h"
+
+using namespace udt;
+
+void PacketBufferDeleter::operator()(char* buffer) const {
+    if (pool) {
+        pool->release(buffer);
+    } else {
+        delete[] buffer;
+    }
+}
+
+std::shared_ptr<PacketBufferPool> PacketBufferPool::create(int bufferSize, int maxIdleBuffers) {
+    return std::shared_ptr<PacketBufferPool>(new PacketBufferPool(bufferSize, maxIdleBuffers));
+}
+
+PacketBufferPool::PacketBufferPool(int bufferSize, int maxIdleBuffers) :
+    _bufferSize(bufferSize),
+    _maxIdleBuffers(maxIdleBuffers)
+{
+    _idleBuffers.reserve(_maxIdleBuffers);
+}
+
+PacketBufferPool::~PacketBufferPool() {
+    // every outstanding buffer holds a reference to the pool, so by now they have all come back
+    for (auto buffer : _idleBuffers) {
+        delete[] buffer;
+    }
+}
+
+PacketBuffer PacketBufferPool::acquire() {
+    char* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_idleBuffersMutex);
+        if (!_idleBuffers.empty()) {
+            buffer = _idleBuffers.back();
+            _idleBuffers.pop_back();
+        }
+    }
+
+    if (!buffer) {
+        // the pool is dry, grow it - the buffer will be kept on release if there is room for it
+        buffer = new char[_bufferSize];
+    }
+
+    return PacketBuffer(buffer, PacketBufferDeleter(shared_from_this()));
+}
+
+int PacketBufferPool::getNumIdleBuffers() const {
+    std::lock_guard<std::mutex> lock(_idleBuffersMutex);
+    return (int)_idleBuffers.size();
+}
+
+void PacketBufferPool::release(char* buffer) {
+    {
+        std::lock_guard<std::mutex> lock(_idleBuffersMutex);
+        if ((int)_idleBuffers.size() < _maxIdleBuffers) {
+            _idleBuffers.push_back(buffer);
+            return;
+        }
+    }
+
+    // we already have as many idle buffers as we want to hold on to
+    delete[] buffer;
+}
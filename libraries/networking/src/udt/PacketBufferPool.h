@@ -0,0 +1,70 @@
+//
+//  PacketBufferPool.h
+//  libraries/networking/src/udt
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_PacketBufferPool_h
+#define hifi_PacketBufferPool_h
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace udt {
+
+class PacketBufferPool;
+
+// Deleter for packet buffers - hands the memory back to the pool it came from, or frees it
+// if the buffer was allocated outside of a pool. Implicitly constructible from the default
+// deleter so that a std::unique_ptr<char[]> can be passed wherever a PacketBuffer is expected.
+struct PacketBufferDeleter {
+    PacketBufferDeleter() = default;
+    PacketBufferDeleter(const std::default_delete<char[]>&) {}
+    PacketBufferDeleter(std::shared_ptr<PacketBufferPool> pool) : pool(std::move(pool)) {}
+
+    void operator()(char* buffer) const;
+
+    std::shared_ptr<PacketBufferPool> pool;
+};
+
+using PacketBuffer = std::unique_ptr<char[], PacketBufferDeleter>;
+
+// Thread-safe free list of fixed size receive buffers.
+// Buffers are handed out by acquire() and come back when the owning packet is destroyed,
+// which can happen on any thread.
+class PacketBufferPool : public std::enable_shared_from_this<PacketBufferPool> {
+public:
+    static std::shared_ptr<PacketBufferPool> create(int bufferSize, int maxIdleBuffers);
+    ~PacketBufferPool();
+
+    int getBufferSize() const { return _bufferSize; }
+
+    PacketBuffer acquire();
+
+    int getNumIdleBuffers() const;
+
+private:
+    PacketBufferPool(int bufferSize, int maxIdleBuffers);
+
+    void release(char* buffer);
+
+    const int _bufferSize;
+    const int _maxIdleBuffers;
+
+    mutable std::mutex _idleBuffersMutex;
+    std::vector<char*> _idleBuffers;
+
+    friend struct PacketBufferDeleter;
+};
+
+} // namespace udt
+
+#endif // hifi_PacketBufferPool_h
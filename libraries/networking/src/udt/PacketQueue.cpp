@@ -15,53 +15,77 @@
 
 using namespace udt;
 
-PacketQueue::PacketQueue(MessageNumber messageNumber) : _currentMessageNumber(messageNumber) {
-    _channels.emplace_front(new std::list<PacketPointer>());
-    _currentChannel = _channels.begin();
+// sized to absorb a typical burst without spilling into the locked overflow
+static const size_t MAIN_CHANNEL_RING_CAPACITY = 1024;
+static const size_t QUEUED_CHANNELS_RING_CAPACITY = 64;
+
+PacketQueue::PacketQueue(MessageNumber messageNumber) :
+    _currentMessageNumber(messageNumber),
+    _mainChannel(MAIN_CHANNEL_RING_CAPACITY),
+    _queuedChannels(QUEUED_CHANNELS_RING_CAPACITY)
+{
+    _currentChannel = _channels.end();
 }
 
 MessageNumber PacketQueue::getNextMessageNumber() {
     static const MessageNumber MAX_MESSAGE_NUMBER = MessageNumber(1) << MESSAGE_NUMBER_SIZE;
-    _currentMessageNumber = (_currentMessageNumber + 1) % MAX_MESSAGE_NUMBER;
-    return _currentMessageNumber;
+
+    MessageNumber currentMessageNumber = _currentMessageNumber.load();
+    MessageNumber nextMessageNumber;
+    do {
+        nextMessageNumber = (currentMessageNumber + 1) % MAX_MESSAGE_NUMBER;
+    } while (!_currentMessageNumber.compare_exchange_weak(currentMessageNumber, nextMessageNumber));
+
+    return nextMessageNumber;
 }
 
 bool PacketQueue::isEmpty() const {
-    LockGuard locker(_packetsLock);
+    return _mainChannel.isEmpty() && _channels.empty() && _queuedChannels.isEmpty();
+}
 
-    // Only the main channel and it is empty
-    return _channels.size() == 1 && _channels.front()->empty();
+void PacketQueue::adoptQueuedChannels() {
+    Channel channel;
+    while (_queuedChannels.pop(channel)) {
+        // new channels go to the back of the rotation, list iterators (including _currentChannel) stay valid
+        _channels.push_back(std::move(channel));
+    }
 }
 
 PacketQueue::PacketPointer PacketQueue::takePacket() {
-    LockGuard locker(_packetsLock);
+    adoptQueuedChannels();
 
-    if (isEmpty()) {
-        return PacketPointer();
-    }
+    PacketPointer packet;
 
-    // handle the case where we are looking at the first channel and it is empty
-    if (_currentChannel == _channels.begin() && (*_currentChannel)->empty()) {
-        ++_currentChannel;
+    if (_isAtMainChannel) {
+        _isAtMainChannel = false;
+        _currentChannel = _channels.begin();
+
+        // handle the case where the main channel is empty by moving straight on to the first packet list channel
+        _mainChannel.pop(packet);
     }
 
-    // at this point the current channel should always not be at the end and should also not be empty
-    Q_ASSERT(_currentChannel != _channels.end());
+    if (!packet) {
+        if (_currentChannel == _channels.end()) {
+            // nothing in the packet list channels either (a packet could still be on its way into the main channel)
+            _isAtMainChannel = true;
+            return packet;
+        }
 
-    auto& channel = *_currentChannel;
+        auto& channel = *_currentChannel;
 
-    Q_ASSERT(!channel->empty());
+        Q_ASSERT(!channel->empty());
 
-    // Take front packet
-    auto packet = std::move(channel->front());
-    channel->pop_front();
+        // Take front packet
+        packet = std::move(channel->front());
+        channel->pop_front();
 
-    // Remove now empty channel (Don't remove the main channel)
-    if (channel->empty() && _currentChannel != _channels.begin()) {
-        // erase the current channel and slide the iterator to the next channel
-        _currentChannel = _channels.erase(_currentChannel);
-    } else {
-        ++_currentChannel;
+        // Remove now empty channel
+        if (channel->empty()) {
+            // erase the current channel and slide the iterator to the next channel
+            _currentChannel = _channels.erase(_currentChannel);
+        } else {
+            ++_currentChannel;
+        }
     }
 
     // push forward our number of channels taken from
@@ -73,15 +97,14 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
 
     if (_currentChannel == _channels.end() || _channelsVisitedCount >= MAX_CHANNELS_SENT_CONCURRENTLY) {
         _channelsVisitedCount = 0;
-        _currentChannel = _channels.begin();
+        _isAtMainChannel = true;
     }
 
     return packet;
 }
 
 void PacketQueue::queuePacket(PacketPointer packet) {
-    LockGuard locker(_packetsLock);
-    _channels.front()->push_back(std::move(packet));
+    _mainChannel.push(std::move(packet));
 }
 
 void PacketQueue::queuePacketList(PacketListPointer packetList) {
@@ -89,7 +112,10 @@ void PacketQueue::queuePacketList(PacketListPointer packetList) {
         packetList->preparePackets(getNextMessageNumber());
     }
 
-    LockGuard locker(_packetsLock);
-    _channels.emplace_back(new std::list<PacketPointer>());
-    _channels.back()->swap(packetList->_packets);
+    Channel channel { new RawChannel() };
+    channel->swap(packetList->_packets);
+
+    if (!channel->empty()) {
+        _queuedChannels.push(std::move(channel));
+    }
 }
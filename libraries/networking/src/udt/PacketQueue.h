@@ -12,11 +12,13 @@
 #ifndef hifi_PacketQueue_h
 #define hifi_PacketQueue_h
 
+#include <atomic>
 #include <list>
 #include <vector>
 #include <memory>
 #include <mutex>
 
+#include "MPSCQueue.h"
 #include "Packet.h"
 
 namespace udt {
@@ -25,9 +27,10 @@ class PacketList;
     
 using MessageNumber = uint32_t;
     
+// Packets and packet lists can be queued from any thread, takePacket (and isEmpty) are only called by the SendQueue thread.
+// Queueing is lock-free: new packets and new packet list channels go through MPSC rings,
+// and the round-robin state over the channels is only ever touched by the taking thread.
 class PacketQueue {
-    using Mutex = std::recursive_mutex;
-    using LockGuard = std::lock_guard<Mutex>;
     using PacketPointer = std::unique_ptr<Packet>;
     using PacketListPointer = std::unique_ptr<PacketList>;
     using RawChannel = std::list<PacketPointer>;
@@ -35,6 +38,8 @@ class PacketQueue {
     using Channels = std::list<Channel>;
     
 public:
+    using Mutex = std::mutex;
+
     PacketQueue(MessageNumber messageNumber = 0);
     void queuePacket(PacketPointer packet);
     void queuePacketList(PacketListPointer packetList);
@@ -42,18 +47,26 @@ public:
     bool isEmpty() const;
     PacketPointer takePacket();
     
+    // Not taken when queueing - the SendQueue holds it while deciding to sleep on an empty queue
+    // and producers briefly take it before waking a sleeping SendQueue, so a wake-up can't be missed
     Mutex& getLock() { return _packetsLock; }
 
     MessageNumber getCurrentMessageNumber() const { return _currentMessageNumber; }
     
 private:
     MessageNumber getNextMessageNumber();
+    void adoptQueuedChannels();
 
-    MessageNumber _currentMessageNumber { 0 };
+    std::atomic<MessageNumber> _currentMessageNumber { 0 };
     
-    mutable Mutex _packetsLock; // Protects the packets to be sent.
-    Channels _channels; // One channel per packet list + Main channel
+    Mutex _packetsLock;
+
+    MPSCQueue<PacketPointer> _mainChannel; // Packets queued on their own
+    MPSCQueue<Channel> _queuedChannels; // Packet lists queued since the last takePacket
+
+    Channels _channels; // One channel per packet list, owned by the taking thread
 
+    bool _isAtMainChannel { true };
     Channels::iterator _currentChannel;
     unsigned int _channelsVisitedCount { 0 };
 };
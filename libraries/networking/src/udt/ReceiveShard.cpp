@@ -0,0 +1,218 @@
+//
+//  ReceiveShard.cpp
+//  libraries/networking/src/udt
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ReceiveShard.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(Q_OS_LINUX)
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "../NetworkLogging.h"
+#include "Constants.h"
+
+using namespace udt;
+
+#if defined(Q_OS_LINUX)
+
+int udt::receiveDatagramBatch(int socketDescriptor, PacketBufferPool& bufferPool,
+                              ReceiveBatch& batch, ReceivedDatagrams& datagrams) {
+    const int bufferSize = bufferPool.getBufferSize();
+    const int overflowSize = std::max(MAX_UDP_DATAGRAM_SIZE_BYTES - bufferSize, 0);
+
+    std::array<mmsghdr, RECEIVE_BATCH_SIZE_PACKETS> messages;
+    std::array<std::array<iovec, 2>, RECEIVE_BATCH_SIZE_PACKETS> vectors;
+    std::array<sockaddr_storage, RECEIVE_BATCH_SIZE_PACKETS> senderAddresses;
+
+    // buffers that did not get used by the last batch are still here, only top up the ones handed out
+    batch.buffers.resize(RECEIVE_BATCH_SIZE_PACKETS);
+
+    if (!batch.overflow && overflowSize > 0) {
+        batch.overflow.reset(new char[RECEIVE_BATCH_SIZE_PACKETS * overflowSize]);
+    }
+
+    for (int i = 0; i < RECEIVE_BATCH_SIZE_PACKETS; ++i) {
+        if (!batch.buffers[i]) {
+            batch.buffers[i] = bufferPool.acquire();
+        }
+
+        vectors[i][0].iov_base = batch.buffers[i].get();
+        vectors[i][0].iov_len = bufferSize;
+        vectors[i][1].iov_base = batch.overflow.get() + i * overflowSize;
+        vectors[i][1].iov_len = overflowSize;
+
+        memset(&messages[i], 0, sizeof(mmsghdr));
+        messages[i].msg_hdr.msg_name = &senderAddresses[i];
+        messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        messages[i].msg_hdr.msg_iov = vectors[i].data();
+        messages[i].msg_hdr.msg_iovlen = overflowSize > 0 ? 2 : 1;
+    }
+
+    int numReceived = recvmmsg(socketDescriptor, messages.data(), RECEIVE_BATCH_SIZE_PACKETS, MSG_DONTWAIT, nullptr);
+
+    if (numReceived <= 0) {
+        // EAGAIN/EWOULDBLOCK - nothing left to read
+        return 0;
+    }
+
+    // the whole batch came off the socket together, so it shares a receive time
+    auto receiveTime = p_high_resolution_clock::now();
+
+    for (int i = 0; i < numReceived; ++i) {
+        auto& header = messages[i].msg_hdr;
+        qint64 sizeRead = messages[i].msg_len;
+
+        if ((header.msg_flags & MSG_TRUNC) || sizeRead <= 0) {
+            // larger than any UDP payload (or empty) - drop it and keep the buffer for the next batch
+            ++batch.numDroppedDatagrams;
+            continue;
+        }
+
+        ReceivedDatagram datagram;
+        if (sizeRead <= bufferSize) {
+            datagram.buffer = std::move(batch.buffers[i]);
+        } else {
+            // spilled into the overflow buffer - stitch it together in a buffer of its own, as the single read path does
+            datagram.buffer = PacketBuffer(new char[sizeRead]);
+            memcpy(datagram.buffer.get(), batch.buffers[i].get(), bufferSize);
+            memcpy(datagram.buffer.get() + bufferSize, vectors[i][1].iov_base, sizeRead - bufferSize);
+        }
+        datagram.size = sizeRead;
+        datagram.senderSockAddr = HifiSockAddr(reinterpret_cast<const sockaddr*>(header.msg_name));
+        datagram.receiveTime = receiveTime;
+        datagrams.push_back(std::move(datagram));
+    }
+
+    return numReceived;
+}
+
+int udt::openReusePortSocket(const QHostAddress& address, quint16 port) {
+    if (address.protocol() != QAbstractSocket::IPv4Protocol) {
+        return -1;
+    }
+
+    int socketDescriptor = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+    if (socketDescriptor == -1) {
+        return -1;
+    }
+
+    int enabled = 1;
+    int receiveBufferSize = UDP_RECEIVE_BUFFER_SIZE_BYTES;
+    int mtuDiscovery = IP_PMTUDISC_DONT;
+    setsockopt(socketDescriptor, SOL_SOCKET, SO_RCVBUF, &receiveBufferSize, sizeof(receiveBufferSize));
+    setsockopt(socketDescriptor, IPPROTO_IP, IP_MTU_DISCOVER, &mtuDiscovery, sizeof(mtuDiscovery));
+
+    sockaddr_in bindAddress;
+    memset(&bindAddress, 0, sizeof(bindAddress));
+    bindAddress.sin_family = AF_INET;
+    bindAddress.sin_addr.s_addr = htonl(address.toIPv4Address());
+    bindAddress.sin_port = htons(port);
+
+    if (setsockopt(socketDescriptor, SOL_SOCKET, SO_REUSEPORT, &enabled, sizeof(enabled)) == -1
+        || ::bind(socketDescriptor, reinterpret_cast<const sockaddr*>(&bindAddress), sizeof(bindAddress)) == -1) {
+        qCWarning(networking) << "udt::openReusePortSocket could not bind to" << address << port << "-" << errno;
+        close(socketDescriptor);
+        return -1;
+    }
+
+    return socketDescriptor;
+}
+
+#else
+
+int udt::receiveDatagramBatch(int socketDescriptor, PacketBufferPool& bufferPool,
+                              ReceiveBatch& batch, ReceivedDatagrams& datagrams) {
+    return 0;
+}
+
+int udt::openReusePortSocket(const QHostAddress& address, quint16 port) {
+    return -1;
+}
+
+#endif
+
+ReceiveShard::ReceiveShard(int socketDescriptor, std::shared_ptr<PacketBufferPool> bufferPool,
+                           std::atomic<quint64>& numDroppedDatagrams) :
+    _socketDescriptor(socketDescriptor),
+    _bufferPool(bufferPool),
+    _batch(numDroppedDatagrams)
+{
+
+}
+
+ReceiveShard::~ReceiveShard() {
+    if (isStillRunning() && isThreaded()) {
+        terminate();
+    }
+
+#if defined(Q_OS_LINUX)
+    if (_socketDescriptor != -1) {
+        close(_socketDescriptor);
+    }
+#endif
+}
+
+bool ReceiveShard::process() {
+#if defined(Q_OS_LINUX)
+    // wake up regularly even when idle so that terminate() isn't held up waiting for traffic
+    static const int POLL_TIMEOUT_MSECS = 100;
+
+    pollfd pollDescriptor;
+    pollDescriptor.fd = _socketDescriptor;
+    pollDescriptor.events = POLLIN;
+    pollDescriptor.revents = 0;
+
+    if (poll(&pollDescriptor, 1, POLL_TIMEOUT_MSECS) <= 0) {
+        return true;
+    }
+
+    ReceivedDatagrams datagrams;
+    while (isStillRunning()
+           && receiveDatagramBatch(_socketDescriptor, *_bufferPool, _batch, datagrams) == RECEIVE_BATCH_SIZE_PACKETS) {
+        // a full batch means there are likely more waiting - keep draining before handing them over
+    }
+
+    if (!datagrams.empty()) {
+        bool wasEmpty = false;
+        {
+            std::lock_guard<std::mutex> lock(_datagramsMutex);
+            wasEmpty = _datagrams.empty();
+            if (wasEmpty) {
+                _datagrams.swap(datagrams);
+            } else {
+                std::move(datagrams.begin(), datagrams.end(), std::back_inserter(_datagrams));
+            }
+        }
+
+        if (wasEmpty) {
+            emit datagramsReceived();
+        }
+    }
+
+    return true;
+#else
+    // sharded receive needs SO_REUSEPORT load balancing, which we only rely on under Linux
+    return false;
+#endif
+}
+
+ReceivedDatagrams ReceiveShard::takeDatagrams() {
+    ReceivedDatagrams datagrams;
+    std::lock_guard<std::mutex> lock(_datagramsMutex);
+    datagrams.swap(_datagrams);
+    return datagrams;
+}
@@ -0,0 +1,91 @@
+//
+//  ReceiveShard.h
+//  libraries/networking/src/udt
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_ReceiveShard_h
+#define hifi_ReceiveShard_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <GenericThread.h>
+#include <PortableHighResolutionClock.h>
+
+#include "../HifiSockAddr.h"
+#include "PacketBufferPool.h"
+
+namespace udt {
+
+struct ReceivedDatagram {
+    PacketBuffer buffer;
+    qint64 size { 0 };
+    HifiSockAddr senderSockAddr;
+    p_high_resolution_clock::time_point receiveTime;
+};
+
+using ReceivedDatagrams = std::vector<ReceivedDatagram>;
+
+// Per-reader state kept between recvmmsg calls.
+// Each message is scattered into a pooled buffer followed by its own slice of the overflow buffer, so that
+// datagrams larger than the pool's buffers are read whole (up to MAX_UDP_DATAGRAM_SIZE_BYTES), the same as
+// the single datagram read path. The overflow buffer is only touched by oversized datagrams.
+struct ReceiveBatch {
+    ReceiveBatch(std::atomic<quint64>& numDroppedDatagrams) : numDroppedDatagrams(numDroppedDatagrams) {}
+
+    std::vector<PacketBuffer> buffers;
+    std::unique_ptr<char[]> overflow;
+
+    // counts datagrams that were pulled off the socket but could not be handed on - truncated or empty
+    std::atomic<quint64>& numDroppedDatagrams;
+};
+
+// Pulls up to RECEIVE_BATCH_SIZE_PACKETS datagrams off the descriptor with a single non-blocking recvmmsg call
+// and appends them to datagrams. Buffers not consumed by a call stay in the batch for the next one.
+// Returns the number of datagrams the call pulled off the socket, including any that were dropped.
+int receiveDatagramBatch(int socketDescriptor, PacketBufferPool& bufferPool,
+                         ReceiveBatch& batch, ReceivedDatagrams& datagrams);
+
+// Opens a UDP socket with SO_REUSEPORT set and binds it, so that the kernel spreads inbound flows
+// across every socket bound to the same port. Returns -1 on failure, or on platforms other than Linux.
+int openReusePortSocket(const QHostAddress& address, quint16 port);
+
+// One extra receive thread reading its own SO_REUSEPORT socket.
+// The datagrams it reads are handed back to the udt::Socket thread, which still owns all connection processing.
+class ReceiveShard : public GenericThread {
+    Q_OBJECT
+public:
+    ReceiveShard(int socketDescriptor, std::shared_ptr<PacketBufferPool> bufferPool,
+                 std::atomic<quint64>& numDroppedDatagrams);
+    virtual ~ReceiveShard();
+
+    virtual bool process() override;
+
+    ReceivedDatagrams takeDatagrams();
+
+signals:
+    // emitted when datagrams arrive and none were waiting to be taken
+    void datagramsReceived();
+
+private:
+    int _socketDescriptor { -1 };
+    std::shared_ptr<PacketBufferPool> _bufferPool;
+    ReceiveBatch _batch;
+
+    std::mutex _datagramsMutex;
+    ReceivedDatagrams _datagrams;
+};
+
+} // namespace udt
+
+#endif // hifi_ReceiveShard_h
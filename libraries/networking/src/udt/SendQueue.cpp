@@ -109,7 +109,7 @@ void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     _packets.queuePacket(std::move(packet));
     
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
+    notifyPacketsQueued();
     
     if (!thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
@@ -120,13 +120,29 @@ void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     _packets.queuePacketList(std::move(packetList));
     
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
+    notifyPacketsQueued();
     
     if (!thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
 
+void SendQueue::notifyPacketsQueued() {
+    // pairs with the fence in isInactive: either the send thread's last empty check sees the packets we just queued,
+    // or we see that it may be going to sleep - producers only touch the lock and the condition in the second case
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!_isWaitingForPackets.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    {
+        // the send thread holds the packets lock from its last empty check until it is waiting on the condition,
+        // passing through it here means the notify can't land in between
+        std::lock_guard<PacketQueue::Mutex> locker(_packets.getLock());
+    }
+    _emptyCondition.notify_one();
+}
+
 void SendQueue::stop() {
     
     _state = State::Stopped;
@@ -284,7 +300,19 @@ void SendQueue::run() {
         // (this is according to the current flow window size) then we send out a new packet
         auto newPacketCount = 0;
         if (!attemptedToSendPacket) {
-            newPacketCount = maybeSendNewPacket();
+            if (_socket->isBatchedSendEnabled()) {
+                // if we've fallen behind the packet send period, catch up with one batched write
+                // instead of going around this loop once per packet
+                int maxNewPackets = SEND_BATCH_SIZE_PACKETS;
+                if (_packetSendPeriod > 0) {
+                    auto timeBehind = duration_cast<microseconds>(p_high_resolution_clock::now() - nextPacketTimestamp);
+                    maxNewPackets = 1 + (int)(std::max(timeBehind.count(), (microseconds::rep)0) / _packetSendPeriod);
+                    maxNewPackets = std::min(maxNewPackets, SEND_BATCH_SIZE_PACKETS);
+                }
+                newPacketCount = maybeSendNewPackets(maxNewPackets);
+            } else {
+                newPacketCount = maybeSendNewPacket();
+            }
             attemptedToSendPacket = (newPacketCount > 0);
         }
         
@@ -301,7 +329,7 @@ void SendQueue::run() {
 
         if (_packetSendPeriod > 0) {
             // push the next packet timestamp forwards by the current packet send period
-            auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * _packetSendPeriod;
+            auto nextPacketDelta = std::max(newPacketCount, 1) * _packetSendPeriod;
             nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
 
             // sleep as long as we need for next packet send, if we can
@@ -379,6 +407,70 @@ int SendQueue::maybeSendNewPacket() {
     return 0;
 }
 
+int SendQueue::maybeSendNewPackets(int maxPackets) {
+    if (maxPackets <= 1) {
+        return maybeSendNewPacket();
+    }
+
+    std::vector<std::unique_ptr<Packet>> newPackets;
+    while ((int)newPackets.size() < maxPackets && !isFlowWindowFull() && !_packets.isEmpty()) {
+        std::unique_ptr<Packet> packet = _packets.takePacket();
+        Q_ASSERT(packet);
+
+        packet->writeSequenceNumber(getNextSequenceNumber());
+        newPackets.push_back(std::move(packet));
+    }
+
+    if (newPackets.size() <= 1) {
+        for (auto& packet : newPackets) {
+            auto sequenceNumber = packet->getSequenceNumber();
+            sendNewPacketAndAddToSentList(move(packet), sequenceNumber);
+        }
+        return (int)newPackets.size();
+    }
+
+    std::vector<const BasePacket*> datagrams;
+    datagrams.reserve(newPackets.size());
+    for (auto& packet : newPackets) {
+        datagrams.push_back(packet.get());
+    }
+
+    _lastPacketSentAt = std::chrono::high_resolution_clock::now();
+
+    int numSyscalls = 0;
+    int numWritten = _socket->writeDatagrams(datagrams, _destination, &numSyscalls);
+
+    emit packetsBatched(numWritten, numSyscalls);
+
+    auto sentTime = p_high_resolution_clock::now();
+    for (auto& packet : newPackets) {
+        emit packetSent(packet->getWireSize(), packet->getPayloadSize(), packet->getSequenceNumber(), sentTime);
+    }
+
+    int numPackets = (int)newPackets.size();
+    auto lastSequenceNumber = newPackets.back()->getSequenceNumber();
+    auto firstUnsentSequenceNumber = numWritten < numPackets ? newPackets[numWritten]->getSequenceNumber()
+                                                             : lastSequenceNumber;
+
+    {
+        // Insert the packets we have just sent in the sent list
+        QWriteLocker locker(&_sentLock);
+        for (auto& packet : newPackets) {
+            auto& entry = _sentPackets[packet->getSequenceNumber()];
+            entry.first = 0; // No resend
+            entry.second.swap(packet);
+        }
+    }
+
+    if (numWritten < numPackets) {
+        // this is a short-circuit loss - whatever did not make it onto the wire goes straight to the loss list
+        std::lock_guard<std::mutex> nakLocker(_naksLock);
+        _naks.append(firstUnsentSequenceNumber, lastSequenceNumber);
+    }
+
+    return numPackets;
+}
+
 bool SendQueue::maybeResendPacket() {
     
     // the following while makes sure that we find a packet to re-send, if there is one
@@ -471,9 +563,15 @@ bool SendQueue::isInactive(bool attemptedToSendPacket) {
         
         // If that is still the case we should use a condition_variable_any to sleep until we have data to handle.
         // To confirm that the queue of packets and the NAKs list are still both empty we'll need to use the DoubleLock
-        using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
+        using DoubleLock = DoubleLock<PacketQueue::Mutex, std::mutex>;
         DoubleLock doubleLock(_packets.getLock(), _naksLock);
         DoubleLock::Lock locker(doubleLock, std::try_to_lock);
+
+        if (locker.owns_lock()) {
+            // let producers know they have to wake us before we make the last empty check, see notifyPacketsQueued
+            _isWaitingForPackets.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
         
         if (locker.owns_lock() && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
             // The packets queue and loss list mutexes are now both locked and they're both empty
@@ -497,6 +595,7 @@ bool SendQueue::isInactive(bool attemptedToSendPacket) {
 
                     // we have the lock again - Make sure to unlock it
                     locker.unlock();
+                    _isWaitingForPackets.store(false, std::memory_order_relaxed);
                     
                     // Deactivate queue
                     deactivate();
@@ -542,6 +641,8 @@ bool SendQueue::isInactive(bool attemptedToSendPacket) {
                 }
             }
         }
+
+        _isWaitingForPackets.store(false, std::memory_order_relaxed);
     }
     
     return false;
@@ -80,6 +80,7 @@ public slots:
 signals:
     void packetSent(int wireSize, int payloadSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint);
     void packetRetransmitted(int wireSize, int payloadSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint);
+    void packetsBatched(int numPackets, int numSyscalls);
     
     void queueInactive();
 
@@ -95,11 +96,13 @@ private:
     SendQueue(SendQueue&& other) = delete;
     
     void sendHandshake();
+    void notifyPacketsQueued();
     
     int sendPacket(const Packet& packet);
     bool sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket, SequenceNumber sequenceNumber);
     
     int maybeSendNewPacket(); // Figures out what packet to send next
+    int maybeSendNewPackets(int maxPackets); // Sends up to maxPackets new packets in one batched write
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
     bool isInactive(bool attemptedToSendPacket);
@@ -139,6 +142,7 @@ private:
     std::condition_variable _handshakeACKCondition;
     
     std::condition_variable_any _emptyCondition;
+    std::atomic<bool> _isWaitingForPackets { false }; // Set by the send thread while it may sleep on _emptyCondition
 
     std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
 
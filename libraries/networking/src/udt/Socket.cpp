@@ -11,10 +11,22 @@
 
 #include "Socket.h"
 
-#ifdef Q_OS_ANDROID
+#if defined(Q_OS_ANDROID) || defined(Q_OS_LINUX)
 #include <sys/socket.h>
 #endif
 
+#if defined(Q_OS_LINUX)
+#include <netinet/udp.h>
+#include <unistd.h>
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#endif
+
+#include <array>
+#include <cerrno>
+
+#include <QtCore/QProcessEnvironment>
 #include <QtCore/QThread>
 
 #include <shared/QtHelpers.h>
@@ -38,13 +50,37 @@ using namespace udt;
 #include <netinet/in.h>
 #endif
 
+static const QString BATCHED_RECEIVE_FLAG("HIFI_UDT_BATCHED_RECEIVE");
+static const QString BATCHED_SEND_FLAG("HIFI_UDT_BATCHED_SEND");
+static const QString SEGMENTATION_OFFLOAD_FLAG("HIFI_UDT_SEND_GSO");
+// number of receive sockets to bind - the extra SO_REUSEPORT sockets are IPv4 only, IPv6 stays on the single socket
+static const QString RECEIVE_SHARDS_ENV("HIFI_UDT_RECEIVE_SHARDS");
+
+// room for a full UDP payload at the standard ethernet MTU - larger datagrams get a buffer of their own
+static const int RECEIVE_BUFFER_SIZE_BYTES = 1500 - UDP_IPV4_HEADER_SIZE;
 
 Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     QObject(parent),
     _udpSocket(parent),
     _readyReadBackupTimer(new QTimer(this)),
-    _shouldChangeSocketOptions(shouldChangeSocketOptions)
+    _shouldChangeSocketOptions(shouldChangeSocketOptions),
+    _receiveBufferPool(PacketBufferPool::create(RECEIVE_BUFFER_SIZE_BYTES, RECEIVE_BUFFER_POOL_MAX_IDLE_PACKETS))
 {
+#if defined(Q_OS_LINUX)
+    auto environment = QProcessEnvironment::systemEnvironment();
+    _isBatchedReceiveEnabled = environment.contains(BATCHED_RECEIVE_FLAG);
+    _isBatchedSendEnabled = environment.contains(BATCHED_SEND_FLAG);
+    _isSegmentationOffloadEnabled = environment.contains(SEGMENTATION_OFFLOAD_FLAG);
+
+    if (environment.contains(RECEIVE_SHARDS_ENV)) {
+        bool ok = false;
+        int numReceiveShards = environment.value(RECEIVE_SHARDS_ENV).toInt(&ok);
+        if (ok && numReceiveShards > 0) {
+            _numReceiveShards = numReceiveShards;
+        }
+    }
+#endif
+
     connect(&_udpSocket, &QUdpSocket::readyRead, this, &Socket::readPendingDatagrams);
 
     // make sure we hear about errors and state changes from the underlying socket
@@ -58,9 +94,34 @@ Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     _readyReadBackupTimer->start(READY_READ_BACKUP_CHECK_MSECS);
 }
 
+Socket::~Socket() {
+#if defined(Q_OS_LINUX)
+    stopReceiveShards();
+#endif
+}
+
 void Socket::bind(const QHostAddress& address, quint16 port) {
 
+#if defined(Q_OS_LINUX)
+    bool isBound = false;
+    if (_numReceiveShards > 1) {
+        // every socket sharing the port needs SO_REUSEPORT set before it binds, so open the primary one ourselves
+        stopReceiveShards();
+        int socketDescriptor = openReusePortSocket(address, port);
+        if (socketDescriptor != -1) {
+            isBound = _udpSocket.setSocketDescriptor(socketDescriptor, QAbstractSocket::BoundState);
+            if (!isBound) {
+                ::close(socketDescriptor);
+            }
+        }
+    }
+
+    if (!isBound) {
+        _udpSocket.bind(address, port);
+    }
+#else
     _udpSocket.bind(address, port);
+#endif
 
     if (_shouldChangeSocketOptions) {
         setSystemBufferSizes();
@@ -78,6 +139,13 @@ void Socket::bind(const QHostAddress& address, quint16 port) {
         }
 #endif
     }
+
+#if defined(Q_OS_LINUX)
+    if (isBound) {
+        // the extra receive sockets join the primary one on whatever port it actually got
+        bindReceiveShards(address, _udpSocket.localPort());
+    }
+#endif
 }
 
 void Socket::rebind() {
@@ -198,10 +266,57 @@ qint64 Socket::writePacketList(std::unique_ptr<PacketList> packetList, const Hif
     }
 
     // Unerliable and Unordered
-    qint64 totalBytesSent = 0;
+    std::vector<std::unique_ptr<Packet>> packets;
+    packets.reserve(packetList->getNumPackets());
     while (!packetList->_packets.empty()) {
-        totalBytesSent += writePacket(packetList->takeFront<Packet>(), sockAddr);
+        packets.push_back(packetList->takeFront<Packet>());
     }
+    return writePackets(std::move(packets), sockAddr);
+}
+
+qint64 Socket::writePackets(std::vector<std::unique_ptr<Packet>> packets, const HifiSockAddr& sockAddr) {
+    if (packets.empty()) {
+        return 0;
+    }
+
+    if (packets.size() == 1 || !_isBatchedSendEnabled) {
+        qint64 totalBytesSent = 0;
+        for (auto& packet : packets) {
+            totalBytesSent += writePacket(std::move(packet), sockAddr);
+        }
+        return totalBytesSent;
+    }
+
+    std::vector<const BasePacket*> datagrams;
+    datagrams.reserve(packets.size());
+
+    {
+        // grab all the sequence numbers for this burst with a single lock
+        Lock lock(_unreliableSequenceNumbersMutex);
+        auto& sequenceNumber = _unreliableSequenceNumbers[sockAddr];
+        for (auto& packet : packets) {
+            Q_ASSERT_X(!packet->isReliable(), "Socket::writePackets", "Cannot send a reliable packet unreliably");
+            packet->writeSequenceNumber(++sequenceNumber);
+            datagrams.push_back(packet.get());
+        }
+    }
+
+    int numSyscalls = 0;
+    int numWritten = writeDatagrams(datagrams, sockAddr, &numSyscalls);
+
+    qint64 totalBytesSent = 0;
+    auto connection = findOrCreateConnection(sockAddr, true);
+    for (int i = 0; i < numWritten; ++i) {
+        if (connection) {
+            connection->recordSentUnreliablePackets(packets[i]->getWireSize(), packets[i]->getPayloadSize());
+        }
+        totalBytesSent += packets[i]->getDataSize();
+    }
+
+    if (connection && numSyscalls > 0) {
+        connection->recordSentBatch(numWritten, numSyscalls);
+    }
+
     return totalBytesSent;
 }
 
@@ -270,6 +385,154 @@ qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& soc
     return bytesWritten;
 }
 
+int Socket::writeDatagrams(const std::vector<const BasePacket*>& packets, const HifiSockAddr& sockAddr, int* numSyscalls) {
+    int numWritten = 0;
+    int syscalls = 0;
+
+#if defined(Q_OS_LINUX)
+    if (_isBatchedSendEnabled && packets.size() > 1 && sockAddr.getAddress().protocol() == QAbstractSocket::IPv4Protocol) {
+        numWritten = writeDatagramsBatch(packets, sockAddr, syscalls);
+
+        if (numSyscalls) {
+            *numSyscalls = syscalls;
+        }
+        return numWritten;
+    }
+#endif
+
+    for (auto packet : packets) {
+        ++syscalls;
+        if (writeDatagram(packet->getData(), packet->getDataSize(), sockAddr) < 0) {
+            break;
+        }
+        ++numWritten;
+    }
+
+    if (numSyscalls) {
+        *numSyscalls = syscalls;
+    }
+    return numWritten;
+}
+
+#if defined(Q_OS_LINUX)
+
+int Socket::writeDatagramsBatch(const std::vector<const BasePacket*>& packets, const HifiSockAddr& sockAddr,
+                                int& numSyscalls) {
+    // don't attempt to write the datagrams if we're unbound, same as writeDatagram
+    if (_udpSocket.state() != QAbstractSocket::BoundState) {
+        qCDebug(networking) << "Attempt to writeDatagrams when in unbound state to" << sockAddr;
+        return 0;
+    }
+
+    auto socketDescriptor = _udpSocket.socketDescriptor();
+
+    sockaddr_in destination;
+    memset(&destination, 0, sizeof(destination));
+    destination.sin_family = AF_INET;
+    destination.sin_addr.s_addr = htonl(sockAddr.getAddress().toIPv4Address());
+    destination.sin_port = htons(sockAddr.getPort());
+
+    // room for the UDP_SEGMENT control message of each GSO send
+    union SegmentControl {
+        char buffer[CMSG_SPACE(sizeof(uint16_t))];
+        cmsghdr align;
+    };
+
+    std::array<mmsghdr, SEND_BATCH_SIZE_PACKETS> messages;
+    std::array<iovec, SEND_BATCH_SIZE_PACKETS> vectors;
+    std::array<SegmentControl, SEND_BATCH_SIZE_PACKETS> controls;
+    std::array<int, SEND_BATCH_SIZE_PACKETS> packetsPerMessage;
+
+    const int numPackets = (int)packets.size();
+    int numWritten = 0;
+
+    while (numWritten < numPackets) {
+        bool useSegmentation = _isSegmentationOffloadEnabled;
+
+        int numMessages = 0;
+        int numVectors = 0;
+        int nextPacket = numWritten;
+
+        while (nextPacket < numPackets && numVectors < SEND_BATCH_SIZE_PACKETS) {
+            auto& message = messages[numMessages];
+            memset(&message, 0, sizeof(mmsghdr));
+            message.msg_hdr.msg_name = &destination;
+            message.msg_hdr.msg_namelen = sizeof(destination);
+            message.msg_hdr.msg_iov = &vectors[numVectors];
+
+            // with GSO the kernel splits one send into segments of the size of the first packet,
+            // so a run can only continue while every packet but the last is exactly that size
+            const qint64 segmentSize = packets[nextPacket]->getDataSize();
+            qint64 lastSize = segmentSize;
+            qint64 messageSize = 0;
+            int numSegments = 0;
+
+            do {
+                auto packet = packets[nextPacket];
+                vectors[numVectors].iov_base = const_cast<char*>(packet->getData());
+                vectors[numVectors].iov_len = packet->getDataSize();
+
+                lastSize = packet->getDataSize();
+                messageSize += lastSize;
+                ++numVectors;
+                ++numSegments;
+                ++nextPacket;
+            } while (useSegmentation && nextPacket < numPackets && numVectors < SEND_BATCH_SIZE_PACKETS
+                     && lastSize == segmentSize && packets[nextPacket]->getDataSize() <= segmentSize
+                     && messageSize + packets[nextPacket]->getDataSize() <= MAX_SEGMENTATION_OFFLOAD_BYTES);
+
+            message.msg_hdr.msg_iovlen = numSegments;
+
+            if (numSegments > 1) {
+                auto& control = controls[numMessages];
+                message.msg_hdr.msg_control = control.buffer;
+                message.msg_hdr.msg_controllen = sizeof(control.buffer);
+
+                auto controlMessage = CMSG_FIRSTHDR(&message.msg_hdr);
+                controlMessage->cmsg_level = SOL_UDP;
+                controlMessage->cmsg_type = UDP_SEGMENT;
+                controlMessage->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                uint16_t gsoSize = (uint16_t)segmentSize;
+                memcpy(CMSG_DATA(controlMessage), &gsoSize, sizeof(gsoSize));
+            }
+
+            packetsPerMessage[numMessages] = numSegments;
+            ++numMessages;
+        }
+
+        int numSent = sendmmsg(socketDescriptor, messages.data(), numMessages, 0);
+        ++numSyscalls;
+
+        if (numSent < 0) {
+            int sendError = errno;
+
+            if (useSegmentation && (sendError == EIO || sendError == EINVAL || sendError == ENOPROTOOPT)) {
+                // the kernel or the NIC can't do UDP GSO - stop asking for it and re-send this batch without it
+                qCDebug(networking) << "udt::writeDatagramsBatch UDP segmentation offload unavailable (" << sendError
+                    << ") - disabling it";
+                _isSegmentationOffloadEnabled = false;
+                continue;
+            }
+
+            HIFI_FCDEBUG(networking(), "udt::writeDatagramsBatch error" << sendError << "writing to" << sockAddr);
+            break;
+        }
+
+        for (int i = 0; i < numSent; ++i) {
+            numWritten += packetsPerMessage[i];
+        }
+
+        if (numSent < numMessages) {
+            // the socket send buffer is full, the rest of the burst is left to the caller
+            break;
+        }
+    }
+
+    return numWritten;
+}
+
+#endif
+
 Connection* Socket::findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreate) {
     Lock connectionsLock(_connectionsHashMutex);
     auto it = _connectionsHash.find(sockAddr);
@@ -393,8 +656,13 @@ void Socket::readPendingDatagrams() {
         // setup a HifiSockAddr to read into
         HifiSockAddr senderSockAddr;
 
-        // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        // setup a buffer to read the packet into - from the pool, unless this datagram is too large for it
+        PacketBuffer buffer;
+        if (packetSizeWithHeader <= _receiveBufferPool->getBufferSize()) {
+            buffer = _receiveBufferPool->acquire();
+        } else {
+            buffer = PacketBuffer(new char[packetSizeWithHeader]);
+        }
 
         // pull the datagram
         auto sizeRead = _udpSocket.readDatagram(buffer.get(), packetSizeWithHeader,
@@ -410,73 +678,178 @@ void Socket::readPendingDatagrams() {
             continue;
         }
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
+        processDatagram(std::move(buffer), packetSizeWithHeader, senderSockAddr, receiveTime);
 
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this HifiSockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
-            }
+#if defined(Q_OS_LINUX)
+        if (_isBatchedReceiveEnabled) {
+            // the read through QUdpSocket above has re-enabled its read notifier,
+            // so we can now drain whatever else is pending straight from the descriptor, many datagrams per call
+            while (system_clock::now() <= abortTime && readPendingDatagramsBatch()) {}
+        }
+#endif
+    }
+}
 
-            continue;
+#if defined(Q_OS_LINUX)
+
+// Pulls up to RECEIVE_BATCH_SIZE_PACKETS datagrams with a single recvmmsg call.
+// Returns true if the batch was filled, meaning there are likely more datagrams waiting.
+bool Socket::readPendingDatagramsBatch() {
+    auto socketDescriptor = _udpSocket.socketDescriptor();
+    if (socketDescriptor == -1) {
+        return false;
+    }
+
+    ReceivedDatagrams datagrams;
+    int numReceived = receiveDatagramBatch(socketDescriptor, *_receiveBufferPool, _receiveBatch, datagrams);
+
+    if (numReceived == 0) {
+        return false;
+    }
+
+    // we're reading packets so re-start the readyRead backup timer
+    _readyReadBackupTimer->start();
+
+    processReceivedDatagrams(datagrams);
+
+    return numReceived == RECEIVE_BATCH_SIZE_PACKETS;
+}
+
+void Socket::bindReceiveShards(const QHostAddress& address, quint16 port) {
+    stopReceiveShards();
+
+    if (_numReceiveShards <= 1 || _udpSocket.state() != QAbstractSocket::BoundState) {
+        return;
+    }
+
+    if (address.protocol() != QAbstractSocket::IPv4Protocol) {
+        qCDebug(networking) << "Socket::bindReceiveShards extra receive sockets are IPv4 only, receiving on"
+            << address << "with a single socket";
+        return;
+    }
+
+    for (int i = 1; i < _numReceiveShards; ++i) {
+        int socketDescriptor = openReusePortSocket(address, port);
+        if (socketDescriptor == -1) {
+            qCWarning(networking) << "Socket::bindReceiveShards could only open" << _receiveShards.size()
+                << "of" << (_numReceiveShards - 1) << "extra receive sockets on port" << port;
+            break;
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        auto shard = std::unique_ptr<ReceiveShard>(new ReceiveShard(socketDescriptor, _receiveBufferPool,
+                                                                   _numDroppedDatagrams));
+        shard->setObjectName(QString("UDT Receive Shard %1").arg(i));
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+        // datagrams come back to this thread for processing - connections are only ever touched from here
+        connect(shard.get(), &ReceiveShard::datagramsReceived, this, &Socket::processReceiveShardDatagrams,
+                Qt::QueuedConnection);
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+        shard->initialize();
+        _receiveShards.push_back(std::move(shard));
+    }
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
-            }
+    qCDebug(networking) << "Socket receiving on port" << port << "with" << (_receiveShards.size() + 1) << "sockets";
+}
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+void Socket::stopReceiveShards() {
+    // destroying a shard terminates its thread and closes its socket
+    _receiveShards.clear();
+}
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+#endif
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+// Dispatches what the receive shards have read. This runs on the Socket thread like all other dispatch,
+// so shards take the recvmmsg calls and buffer handling off this thread but not the connection processing.
+void Socket::processReceiveShardDatagrams() {
+    for (auto& shard : _receiveShards) {
+        auto datagrams = shard->takeDatagrams();
+        if (!datagrams.empty()) {
+            // we're reading packets so re-start the readyRead backup timer
+            _readyReadBackupTimer->start();
+
+            processReceivedDatagrams(datagrams);
+        }
+    }
+}
+
+void Socket::processReceivedDatagrams(ReceivedDatagrams& datagrams) {
+    for (auto& datagram : datagrams) {
+        // save information for this packet, in case it is the one that sticks readyRead
+        _lastPacketSizeRead = datagram.size;
+        _lastPacketSockAddr = datagram.senderSockAddr;
+
+        processDatagram(std::move(datagram.buffer), datagram.size, datagram.senderSockAddr, datagram.receiveTime);
+    }
+}
+
+void Socket::processDatagram(PacketBuffer buffer, qint64 size, const HifiSockAddr& senderSockAddr,
+                             p_high_resolution_clock::time_point receiveTime) {
+    auto it = _unfilteredHandlers.find(senderSockAddr);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this HifiSockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
+        }
+
+        return;
+    }
+
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+        controlPacket->setReceiveTime(receiveTime);
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
+
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+        packet->setReceiveTime(receiveTime);
+
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
+
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
+
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
@@ -14,10 +14,13 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
+#include <atomic>
 #include <mutex>
 #include <list>
+#include <vector>
 
 #include <QtCore/QObject>
 #include <QtCore/QTimer>
@@ -26,6 +29,8 @@
 #include "../HifiSockAddr.h"
 #include "TCPVegasCC.h"
 #include "Connection.h"
+#include "PacketBufferPool.h"
+#include "ReceiveShard.h"
 
 //#define UDT_CONNECTION_DEBUG
 
@@ -56,6 +61,7 @@ public:
     using StatsVector = std::vector<std::pair<HifiSockAddr, ConnectionStats::Stats>>;
     
     Socket(QObject* object = 0, bool shouldChangeSocketOptions = true);
+    ~Socket();
     
     quint16 localPort() const { return _udpSocket.localPort(); }
     
@@ -66,6 +72,13 @@ public:
     qint64 writePacketList(std::unique_ptr<PacketList> packetList, const HifiSockAddr& sockAddr);
     qint64 writeDatagram(const char* data, qint64 size, const HifiSockAddr& sockAddr);
     qint64 writeDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr);
+
+    // Write a burst of unreliable packets to one destination, coalesced into as few syscalls as possible
+    qint64 writePackets(std::vector<std::unique_ptr<Packet>> packets, const HifiSockAddr& sockAddr);
+
+    // Returns how many of the leading packets made it onto the wire, numSyscalls is set to the number of sends it took
+    int writeDatagrams(const std::vector<const BasePacket*>& packets, const HifiSockAddr& sockAddr,
+                       int* numSyscalls = nullptr);
     
     void bind(const QHostAddress& address, quint16 port = 0);
     void rebind(quint16 port);
@@ -84,6 +97,28 @@ public:
     void setCongestionControlFactory(std::unique_ptr<CongestionControlVirtualFactory> ccFactory);
     void setConnectionMaxBandwidth(int maxBandwidth);
 
+    // when enabled (Linux only) pending datagrams are pulled off the socket with recvmmsg, many per syscall
+    void setBatchedReceiveEnabled(bool enabled) { _isBatchedReceiveEnabled = enabled; }
+    bool isBatchedReceiveEnabled() const { return _isBatchedReceiveEnabled; }
+
+    // when enabled (Linux only) bursts written with writePackets/writeDatagrams go out through sendmmsg,
+    // and runs of equally sized packets are handed to the kernel as one UDP segmentation offload (GSO) send
+    void setBatchedSendEnabled(bool enabled) { _isBatchedSendEnabled = enabled; }
+    bool isBatchedSendEnabled() const { return _isBatchedSendEnabled; }
+    void setSegmentationOffloadEnabled(bool enabled) { _isSegmentationOffloadEnabled = enabled; }
+    bool isSegmentationOffloadEnabled() const { return _isSegmentationOffloadEnabled; }
+
+    // when more than one (Linux only) the port is bound by that many SO_REUSEPORT sockets, the extra ones each
+    // read on their own thread - takes effect on the next bind
+    // only the receive syscalls are spread across threads: connections aren't thread-safe, so every datagram is still
+    // dispatched (connection processing, packet filter and packet handler) on the Socket thread
+    // IPv4 only: when bound to any other address the socket falls back to a single receive path
+    void setNumReceiveShards(int numReceiveShards) { _numReceiveShards = std::max(numReceiveShards, 1); }
+    int getNumReceiveShards() const { return _numReceiveShards; }
+
+    // datagrams the batched and sharded receive paths pulled off their sockets but had to drop (truncated or empty)
+    quint64 getNumDroppedDatagrams() const { return _numDroppedDatagrams; }
+
     void messageReceived(std::unique_ptr<Packet> packet);
     void messageFailed(Connection* connection, Packet::MessageNumber messageNumber);
     
@@ -103,6 +138,7 @@ public slots:
 
 private slots:
     void readPendingDatagrams();
+    void processReceiveShardDatagrams();
     void checkForReadyReadBackup();
 
     void handleSocketError(QAbstractSocket::SocketError socketError);
@@ -111,6 +147,16 @@ private slots:
 private:
     void setSystemBufferSizes();
     Connection* findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreation = false);
+
+    void processDatagram(PacketBuffer buffer, qint64 size, const HifiSockAddr& senderSockAddr,
+                         p_high_resolution_clock::time_point receiveTime);
+    void processReceivedDatagrams(ReceivedDatagrams& datagrams);
+#if defined(Q_OS_LINUX)
+    bool readPendingDatagramsBatch();
+    void bindReceiveShards(const QHostAddress& address, quint16 port);
+    void stopReceiveShards();
+    int writeDatagramsBatch(const std::vector<const BasePacket*>& packets, const HifiSockAddr& sockAddr, int& numSyscalls);
+#endif
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
     ConnectionStats::Stats sampleStatsForConnection(const HifiSockAddr& destination);
@@ -146,6 +192,16 @@ private:
     int _lastPacketSizeRead { 0 };
     SequenceNumber _lastReceivedSequenceNumber;
     HifiSockAddr _lastPacketSockAddr;
+
+    std::shared_ptr<PacketBufferPool> _receiveBufferPool;
+    std::atomic<quint64> _numDroppedDatagrams { 0 };
+    ReceiveBatch _receiveBatch { _numDroppedDatagrams };
+    bool _isBatchedReceiveEnabled { false };
+    std::atomic<bool> _isBatchedSendEnabled { false };
+    std::atomic<bool> _isSegmentationOffloadEnabled { false };
+
+    int _numReceiveShards { 1 };
+    std::vector<std::unique_ptr<ReceiveShard>> _receiveShards;
     
     friend UDTTest;
 };
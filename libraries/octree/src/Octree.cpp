@@ -14,6 +14,7 @@
 #include <cstring>
 #include <cstdio>
 #include <cmath>
+#include <limits>
 #include <fstream> // to load voxels from file
 
 #include <QDataStream>
@@ -46,13 +47,14 @@
 #include <PathUtils.h>
 #include <ViewFrustum.h>
 
+#include "OctreeBinaryFormat.h"
 #include "OctreeConstants.h"
 #include "OctreeLogging.h"
 #include "OctreeQueryNode.h"
 #include "OctreeUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
-QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz"};
+QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz", "bin"};
 
 Octree::Octree(bool shouldReaverage) :
     _rootElement(NULL),
@@ -671,8 +673,17 @@ OctreeElementPointer Octree::getElementEnclosingPoint(const glm::vec3& point, Oc
 
 bool Octree::readFromFile(const char* fileName) {
     QString qFileName = findMostRecentFileExtension(fileName, PERSIST_EXTENSIONS);
+    return readFromPersistFile(qFileName);
+}
+
+bool Octree::readFromPersistFile(const QString& qFileName) {
+    // go by the contents of a binary file rather than its extension, since the domain-server replaces our
+    // persist file with its gzipped json
+    if (OctreeBinaryFormat::isBinaryFile(qFileName)) {
+        return readFromBinaryFile(qFileName);
+    }
 
-    if (qFileName.endsWith(".json.gz")) {
+    if (qFileName.endsWith(".json.gz") || qFileName.endsWith(".bin")) {
         return readJSONFromGzippedFile(qFileName);
     }
 
@@ -693,20 +704,112 @@ bool Octree::readFromFile(const char* fileName) {
     return success;
 }
 
+bool Octree::readFromBinaryFile(const QString& qFileName) {
+    QFile file(qFileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Cannot open binary octree file for reading: " << qFileName;
+        return false;
+    }
+
+    // map rather than read the file, the contents are decoded in place
+    qint64 fileSize = file.size();
+    const uchar* data = file.map(0, fileSize);
+    if (!data) {
+        qCritical() << "Cannot map binary octree file: " << qFileName << file.errorString();
+        return false;
+    }
+
+    bool success = false;
+    if (fileSize <= std::numeric_limits<int>::max()) {
+        success = readFromBinaryData(QByteArray::fromRawData((const char*)data, (int)fileSize));
+    } else {
+        qCritical() << "Binary octree file is too large: " << qFileName;
+    }
+
+    file.unmap(const_cast<uchar*>(data));
+    return success;
+}
+
+bool Octree::readFromBinaryData(const QByteArray& data) {
+    OctreeBinaryReader reader((const unsigned char*)data.constData(), data.size());
+    if (!reader.readHeader()) {
+        qCritical() << "Binary octree data has no valid header";
+        return false;
+    }
+
+    const auto& header = reader.getHeader();
+    if (header.packetType != expectedDataPacketType() || header.packetVersion != expectedVersion()) {
+        // the contents are encoded for a different version of the data packets, and can't be decoded by this one
+        qCritical() << "Binary octree data was written for" << (int)header.packetType << "version"
+            << (int)header.packetVersion << "and can't be read, expected" << (int)expectedDataPacketType() << "version"
+            << (int)expectedVersion();
+        return false;
+    }
+
+    return readFromBinary(reader);
+}
+
+bool Octree::readFromPersistLogFile(const QString& qFileName) {
+    QFile file(qFileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Cannot open persist log for reading: " << qFileName;
+        return false;
+    }
+
+    qint64 fileSize = file.size();
+    if (fileSize > std::numeric_limits<int>::max()) {
+        qCritical() << "Persist log is too large: " << qFileName;
+        return false;
+    }
+    const uchar* data = file.map(0, fileSize);
+    if (!data) {
+        qCritical() << "Cannot map persist log: " << qFileName << file.errorString();
+        return false;
+    }
+
+    bool success = false;
+    OctreeBinaryReader reader(data, fileSize);
+    if (!reader.readHeader()) {
+        qCritical() << "Persist log has no valid header: " << qFileName;
+    } else {
+        // a log is only good for the snapshot it follows on from
+        const auto& header = reader.getHeader();
+        if (header.packetType != expectedDataPacketType() || header.packetVersion != expectedVersion()) {
+            qCritical() << "Persist log was written for" << (int)header.packetType << "version"
+                << (int)header.packetVersion << "and can't be read";
+        } else if (header.id != _persistID || header.dataVersion != _persistDataVersion) {
+            qCWarning(octree) << "Persist log follows on from" << header.id << header.dataVersion << "rather than the loaded"
+                << _persistID << _persistDataVersion;
+        } else {
+            success = readFromPersistLog(reader);
+        }
+    }
+
+    file.unmap(const_cast<uchar*>(data));
+    return success;
+}
+
 bool Octree::readJSONFromGzippedFile(QString qFileName) {
     QFile file(qFileName);
     if (!file.open(QIODevice::ReadOnly)) {
         qCritical() << "Cannot open gzipped json file for reading: " << qFileName;
         return false;
     }
+    quint64 startRead = usecTimestampNow();
     QByteArray compressedJsonData = file.readAll();
     QByteArray jsonData;
 
+    quint64 startUnzip = usecTimestampNow();
     if (!gunzip(compressedJsonData, jsonData)) {
         qCritical() << "json File not in gzip format: " << qFileName;
         return false;
     }
 
+    quint64 end = usecTimestampNow();
+    qCDebug(octree) << "Read" << compressedJsonData.size() << "bytes from" << qFileName << "- read:"
+        << (float)(startUnzip - startRead) / USECS_PER_MSEC << "msecs, unzip:" << (float)(end - startUnzip) / USECS_PER_MSEC
+        << "msecs";
+
     QDataStream jsonStream(jsonData);
     return readJSONFromStream(-1, jsonStream);
 }
@@ -785,6 +888,9 @@ bool Octree::readFromStream(
     if (firstChar == (char) PacketType::EntityData) {
         qCWarning(octree) << "Reading from binary SVO no longer supported";
         return false;
+    } else if (OctreeBinaryFormat::isBinary(device->peek(OctreeBinaryFormat::MAGIC.size()))) {
+        qCDebug(octree) << "Reading from binary octree Stream length:" << streamLength;
+        return readFromBinaryData(device->readAll());
     } else {
         qCDebug(octree) << "Reading from JSON SVO Stream length:" << streamLength;
         return readJSONFromStream(streamLength, inputStream, marketplaceID);
@@ -837,6 +943,7 @@ bool Octree::readJSONFromStream(
         jsonBuffer += QByteArray(rawData, got);
     }
 
+    quint64 startParse = usecTimestampNow();
     OctreeEntitiesFileParser octreeParser;
     octreeParser.setEntitiesString(jsonBuffer);
     QVariantMap asMap;
@@ -844,6 +951,8 @@ bool Octree::readJSONFromStream(
         qCritical() << "Couldn't parse Entities JSON:" << octreeParser.getErrorString().c_str();
         return false;
     }
+    qCDebug(octree) << "Parsed" << jsonBuffer.size() << "bytes of entities JSON in"
+        << (float)(usecTimestampNow() - startParse) / USECS_PER_MSEC << "msecs";
 
     if (!marketplaceID.isEmpty()) {
         addMarketplaceIDToDocumentEntities(asMap, marketplaceID);
@@ -865,6 +974,8 @@ bool Octree::writeToFile(const char* fileName, const OctreeElementPointer& eleme
         success = writeToJSONFile(cFileName, element);
     } else if (persistAsFileType == "json.gz") {
         success = writeToJSONFile(cFileName, element, true);
+    } else if (persistAsFileType == "bin") {
+        success = writeToBinaryFile(cFileName, element);
     } else {
         qCDebug(octree) << "unable to write octree to file of type" << persistAsFileType;
     }
@@ -970,6 +1081,23 @@ bool Octree::writeToJSONFile(const char* fileName, const OctreeElementPointer& e
     return success;
 }
 
+bool Octree::writeToBinaryFile(const char* fileName, const OctreeElementPointer& element) {
+    qCDebug(octree, "Saving binary octree to file %s...", fileName);
+
+    OctreeBinaryFormat::Header header;
+    header.packetType = expectedDataPacketType();
+    header.packetVersion = expectedVersion();
+    header.dataVersion = _persistDataVersion;
+    header.id = _persistID;
+
+    // the contents go straight to the file as they are encoded
+    OctreeBinaryWriter writer(fileName);
+    if (!writer.open(header) || !writeToBinary(writer, element ? element : _rootElement)) {
+        return false;
+    }
+    return writer.commit();
+}
+
 uint64_t Octree::getOctreeElementsCount() {
     uint64_t nodeCount = 0;
     recurseTreeWithOperation(countOctreeElementsOperation, &nodeCount);
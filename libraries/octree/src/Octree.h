@@ -33,6 +33,9 @@
 class ReadBitstreamToTreeParams;
 class Octree;
 class OctreeElement;
+class OctreeBinaryReader;
+class OctreeBinaryWriter;
+class OctreePersistLog;
 class OctreePacketData;
 class Shape;
 using OctreePointer = std::shared_ptr<Octree>;
@@ -99,6 +102,9 @@ public:
     }
 
     std::function<void(const QUuid& dataID, quint64 itemLastEdited)> trackSend { [](const QUuid&, quint64){} };
+
+    // reuse (and keep) an item's encoded data while it is unchanged, for servers sending the same items to many viewers
+    bool useEncodeCache { false };
 };
 
 class ReadBitstreamToTreeParams {
@@ -213,15 +219,27 @@ public:
     virtual bool writeToMap(QVariantMap& entityDescription, OctreeElementPointer element, bool skipDefaultValues,
                             bool skipThoseWithBadParents) = 0;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) = 0;
+    bool writeToBinaryFile(const char* filename, const OctreeElementPointer& element = nullptr);
+    virtual bool writeToBinary(OctreeBinaryWriter& writer, const OctreeElementPointer& element) { return false; }
 
     // Octree importers
     bool readFromFile(const char* filename);
+    bool readFromPersistFile(const QString& filename); // reads filename as is, rather than the newest of its persist types
     bool readFromURL(const QString& url, const bool isObservable = true, const qint64 callerId = -1); // will support file urls as well...
     bool readFromStream(uint64_t streamLength, QDataStream& inputStream, const QString& marketplaceID="");
     bool readSVOFromStream(uint64_t streamLength, QDataStream& inputStream);
     bool readJSONFromStream(uint64_t streamLength, QDataStream& inputStream, const QString& marketplaceID="");
     bool readJSONFromGzippedFile(QString qFileName);
     virtual bool readFromMap(QVariantMap& entityDescription) = 0;
+    bool readFromBinaryFile(const QString& filename);
+    bool readFromBinaryData(const QByteArray& data);
+    virtual bool readFromBinary(OctreeBinaryReader& reader) { return false; }
+
+    // the persist log, only the changes a tree tracks while asked to can be written to it
+    virtual void setTrackPersistChanges(bool track) { }
+    virtual bool writeToPersistLog(OctreePersistLog& log) { return false; }
+    bool readFromPersistLogFile(const QString& filename);
+    virtual bool readFromPersistLog(OctreeBinaryReader& reader) { return false; }
 
     uint64_t getOctreeElementsCount();
 
@@ -250,6 +268,8 @@ public:
         _persistID = id;
         _persistDataVersion = dataVersion;
     }
+    QUuid getPersistID() const { return _persistID; }
+    int getPersistDataVersion() const { return _persistDataVersion; }
 
     virtual void resetEditStats() { }
     virtual quint64 getAverageDecodeTime() const { return 0; }
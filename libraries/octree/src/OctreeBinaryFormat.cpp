@@ -0,0 +1,163 @@
+//
+//  OctreeBinaryFormat.cpp
+//  libraries/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeBinaryFormat.h"
+
+#include <cstring>
+
+#include <QtCore/QFile>
+
+#include "OctreeLogging.h"
+
+static const int NUM_BYTES_RFC4122_UUID = 16;
+
+const QByteArray OctreeBinaryFormat::MAGIC { "HFOCTBIN" };
+const int OctreeBinaryFormat::HEADER_SIZE = 8 + sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint16_t)
+    + sizeof(int64_t) + NUM_BYTES_RFC4122_UUID;
+
+namespace {
+    template <typename T>
+    void appendValue(QByteArray& data, const T& value) {
+        data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    T readValue(const unsigned char*& data) {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return value;
+    }
+
+    bool headerFromData(const unsigned char* data, qint64 size, OctreeBinaryFormat::Header& header) {
+        if (size < OctreeBinaryFormat::HEADER_SIZE ||
+            memcmp(data, OctreeBinaryFormat::MAGIC.constData(), OctreeBinaryFormat::MAGIC.size()) != 0) {
+            return false;
+        }
+        data += OctreeBinaryFormat::MAGIC.size();
+
+        uint32_t formatVersion = readValue<uint32_t>(data);
+        if (formatVersion != OctreeBinaryFormat::FORMAT_VERSION) {
+            qCWarning(octree) << "Unsupported binary octree format version" << formatVersion;
+            return false;
+        }
+
+        header.packetType = (PacketType)readValue<uint8_t>(data);
+        header.packetVersion = (PacketVersion)readValue<uint8_t>(data);
+        readValue<uint16_t>(data); // reserved
+        header.dataVersion = readValue<int64_t>(data);
+        header.id = QUuid::fromRfc4122(QByteArray::fromRawData((const char*)data, NUM_BYTES_RFC4122_UUID));
+        return true;
+    }
+}
+
+bool OctreeBinaryFormat::isBinary(const QByteArray& data) {
+    return data.startsWith(MAGIC);
+}
+
+bool OctreeBinaryFormat::isBinaryFile(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    return isBinary(file.read(MAGIC.size()));
+}
+
+QByteArray OctreeBinaryFormat::headerToByteArray(const Header& header) {
+    QByteArray data = MAGIC;
+    appendValue(data, FORMAT_VERSION);
+    appendValue(data, (uint8_t)header.packetType);
+    appendValue(data, (uint8_t)header.packetVersion);
+    appendValue(data, (uint16_t)0); // reserved
+    appendValue(data, header.dataVersion);
+    data.append(header.id.toRfc4122());
+    return data;
+}
+
+bool OctreeBinaryFormat::readHeader(const QByteArray& data, Header& header) {
+    return headerFromData((const unsigned char*)data.constData(), data.size(), header);
+}
+
+bool OctreeBinaryFormat::readHeaderFromFile(const QString& fileName, Header& header) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    return readHeader(file.read(HEADER_SIZE), header);
+}
+
+bool OctreeBinaryWriter::open(const OctreeBinaryFormat::Header& header) {
+    if (!_file.open(QIODevice::WriteOnly)) {
+        qCritical() << "Failed to open binary octree file for writing:" << _file.fileName();
+        return false;
+    }
+    QByteArray data = OctreeBinaryFormat::headerToByteArray(header);
+    _failed = _file.write(data) != data.size();
+    return !_failed;
+}
+
+bool OctreeBinaryWriter::writeBlock(const QByteArray& block) {
+    if (_failed || block.isEmpty()) {
+        return !_failed;
+    }
+    uint32_t blockSize = block.size();
+    _failed = _file.write((const char*)&blockSize, sizeof(blockSize)) != sizeof(blockSize)
+        || _file.write(block) != block.size();
+    return !_failed;
+}
+
+bool OctreeBinaryWriter::commit() {
+    uint32_t endMarker = 0;
+    _failed = _failed || _file.write((const char*)&endMarker, sizeof(endMarker)) != sizeof(endMarker);
+    if (_failed) {
+        qCritical() << "Failed to write binary octree file:" << _file.errorString();
+        _file.cancelWriting();
+        return false;
+    }
+
+    if (!_file.commit()) {
+        qCritical() << "Failed to commit binary octree file:" << _file.errorString();
+        return false;
+    }
+    return true;
+}
+
+bool OctreeBinaryReader::readHeader() {
+    if (!headerFromData(_data, _size, _header)) {
+        return false;
+    }
+    _offset = OctreeBinaryFormat::HEADER_SIZE;
+    return true;
+}
+
+bool OctreeBinaryReader::readBlock(const unsigned char*& block, int& blockSize) {
+    if (_isAtEnd || _offset + (qint64)sizeof(uint32_t) > _size) {
+        return false;
+    }
+
+    const unsigned char* data = _data + _offset;
+    uint32_t size = readValue<uint32_t>(data);
+    _offset += sizeof(uint32_t);
+
+    if (size == 0) {
+        _isAtEnd = true;
+        return false;
+    }
+    if (_offset + size > _size) {
+        qCWarning(octree) << "Binary octree data is truncated";
+        return false;
+    }
+
+    block = data;
+    blockSize = (int)size;
+    _offset += size;
+    return true;
+}
@@ -0,0 +1,89 @@
+//
+//  OctreeBinaryFormat.h
+//  libraries/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeBinaryFormat_h
+#define hifi_OctreeBinaryFormat_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QSaveFile>
+#include <QtCore/QUuid>
+
+#include <udt/PacketHeaders.h>
+
+// Binary snapshot of an octree's contents, the "bin" persist file type.
+//   The contents are stored in the same encoding the octree sends to clients, so a snapshot is written while walking
+//   the tree without building an intermediate document, and is read straight out of a memory mapped file.
+//   That encoding changes with the data packet version, so a snapshot can only be read by a server speaking the
+//   same version it was written with - use the json persist file types to carry content across versions.
+//
+//   Layout (native byte order):
+//     header      magic "HFOCTBIN", format version, data packet type and version, data version, id
+//     blocks      uint32 size followed by that many bytes of octree specific payload, as many as needed
+//     end         uint32 zero
+namespace OctreeBinaryFormat {
+    extern const QByteArray MAGIC;
+    const uint32_t FORMAT_VERSION = 1;
+    extern const int HEADER_SIZE;
+
+    struct Header {
+        PacketType packetType { PacketType::Unknown };
+        PacketVersion packetVersion { 0 };
+        int64_t dataVersion { 0 };
+        QUuid id;
+    };
+
+    bool isBinary(const QByteArray& data);
+    bool isBinaryFile(const QString& fileName);
+
+    QByteArray headerToByteArray(const Header& header);
+    bool readHeader(const QByteArray& data, Header& header);
+
+    // reads just the header, so a persist file can be identified without loading it
+    bool readHeaderFromFile(const QString& fileName, Header& header);
+}
+
+class OctreeBinaryWriter {
+public:
+    OctreeBinaryWriter(const QString& fileName) : _file(fileName) { }
+
+    bool open(const OctreeBinaryFormat::Header& header);
+    bool writeBlock(const QByteArray& block);
+
+    // writes the end marker and atomically replaces the file, nothing is written to it if this isn't called
+    bool commit();
+
+private:
+    QSaveFile _file;
+    bool _failed { false };
+};
+
+class OctreeBinaryReader {
+public:
+    // data must outlive the reader
+    OctreeBinaryReader(const unsigned char* data, qint64 size) : _data(data), _size(size) { }
+
+    bool readHeader();
+    const OctreeBinaryFormat::Header& getHeader() const { return _header; }
+
+    // returns false at the end marker, or if the data is truncated - check isAtEnd() to tell them apart
+    bool readBlock(const unsigned char*& block, int& blockSize);
+    bool isAtEnd() const { return _isAtEnd; }
+    qint64 getBytesLeft() const { return _size - _offset; }
+
+private:
+    const unsigned char* _data;
+    qint64 _size;
+    qint64 _offset { 0 };
+    bool _isAtEnd { false };
+    OctreeBinaryFormat::Header _header;
+};
+
+#endif // hifi_OctreeBinaryFormat_h
@@ -9,6 +9,7 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 
 #include "OctreeDataUtils.h"
+#include "OctreeBinaryFormat.h"
 #include "OctreeEntitiesFileParser.h"
 
 #include <Gzip.h>
@@ -30,6 +31,18 @@ bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromMap(const QVariantMap& ma
 }
 
 bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromData(QByteArray data) {
+    if (OctreeBinaryFormat::isBinary(data)) {
+        // only the info is available without decoding the contents, which takes a tree
+        OctreeBinaryFormat::Header header;
+        if (!OctreeBinaryFormat::readHeader(data, header)) {
+            return false;
+        }
+        id = header.id;
+        dataVersion = header.dataVersion;
+        version = header.packetVersion;
+        return true;
+    }
+
     QByteArray jsonData;
     if (gunzip(data, jsonData)) {
         data = jsonData;
@@ -11,13 +11,17 @@
 
 #include "OctreeEntitiesFileParser.h"
 
+#include <atomic>
 #include <sstream>
 #include <cctype>
+#include <vector>
 
 #include <QUuid>
 #include <QJsonDocument>
 #include <QJsonObject>
 
+#include <ThreadHelpers.h>
+
 
 using std::string;
 
@@ -219,6 +223,9 @@ bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray) {
         return false;
     }
 
+    // Find where each entity object starts and ends, which is quick, then have QJsonDocument parse them in parallel.
+    std::vector<std::pair<int, int>> entitySpans; // start and length
+    std::vector<int> entityLines;
     while (true) {
         if (nextToken() != '{') {
             _errorString = "Entity array item is not an object";
@@ -230,23 +237,50 @@ bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray) {
             return false;
         }
 
-        QByteArray jsonEntity = _entitiesContents.mid(_position - 1, matchingBrace - _position + 1);
-        QJsonDocument entity = QJsonDocument::fromJson(jsonEntity);
-        if (entity.isNull()) {
-            _errorString = "Ill-formed entity";
-            return false;
-        }
-
-        entitiesArray.append(entity.object());
+        entitySpans.emplace_back(_position - 1, matchingBrace - _position + 1);
+        entityLines.push_back(_line);
         _position = matchingBrace;
         char c = nextToken();
         if (c == ']') {
-            return true;
+            break;
         } else if (c != ',') {
             _errorString = "Entity array item incorrectly terminated";
             return false;
         }
     }
+
+    const int MIN_ENTITIES_PER_THREAD = 256;
+    int numEntities = (int)entitySpans.size();
+    std::vector<QJsonObject> entities(numEntities);
+    std::atomic<int> firstIllFormedEntity { numEntities };
+
+    auto parseEntities = [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            QByteArray jsonEntity = QByteArray::fromRawData(_entitiesContents.constData() + entitySpans[i].first,
+                                                            entitySpans[i].second);
+            QJsonDocument entity = QJsonDocument::fromJson(jsonEntity);
+            if (entity.isNull()) {
+                int illFormedEntity = firstIllFormedEntity;
+                while (i < illFormedEntity && !firstIllFormedEntity.compare_exchange_weak(illFormedEntity, i)) { }
+                return;
+            }
+            entities[i] = entity.object();
+        }
+    };
+
+    forEachRangeInParallel(numEntities, MIN_ENTITIES_PER_THREAD, parseEntities);
+
+    if (firstIllFormedEntity < numEntities) {
+        _position = entitySpans[firstIllFormedEntity].first + 1;
+        _line = entityLines[firstIllFormedEntity];
+        _errorString = "Ill-formed entity";
+        return false;
+    }
+
+    entitiesArray.reserve(numEntities);
+    for (const auto& entity : entities) {
+        entitiesArray.append(entity);
+    }
     return true;
 }
 
@@ -0,0 +1,60 @@
+//
+//  OctreePersistLog.cpp
+//  libraries/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreePersistLog.h"
+
+#include "OctreeLogging.h"
+
+bool OctreePersistLog::reset(const OctreeBinaryFormat::Header& header) {
+    _buffer.clear();
+    _file.close();
+    if (!_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(octree) << "Failed to open persist log" << _file.fileName() << _file.errorString();
+        return false;
+    }
+
+    QByteArray data = OctreeBinaryFormat::headerToByteArray(header);
+    if (_file.write(data) != data.size() || !_file.flush()) {
+        qCWarning(octree) << "Failed to write persist log" << _file.fileName() << _file.errorString();
+        _file.close();
+        return false;
+    }
+    _size = data.size();
+    return true;
+}
+
+void OctreePersistLog::append(uint8_t recordType, const QByteArray& record) {
+    uint32_t blockSize = sizeof(recordType) + record.size();
+    _buffer.append((const char*)&blockSize, sizeof(blockSize));
+    _buffer.append((const char*)&recordType, sizeof(recordType));
+    _buffer.append(record);
+}
+
+bool OctreePersistLog::flush() {
+    if (!_file.isOpen()) {
+        _buffer.clear();
+        return false;
+    }
+    if (_buffer.isEmpty()) {
+        return true;
+    }
+
+    bool success = _file.write(_buffer) == _buffer.size() && _file.flush();
+    _buffer.clear();
+    if (!success) {
+        // whatever made it to disk may end part way through a record, nothing appended after that could be read back
+        qCWarning(octree) << "Failed to write persist log" << _file.fileName() << _file.errorString();
+        _file.close();
+        return false;
+    }
+    _size = _file.size();
+    return true;
+}
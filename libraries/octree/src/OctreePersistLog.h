@@ -0,0 +1,46 @@
+//
+//  OctreePersistLog.h
+//  libraries/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreePersistLog_h
+#define hifi_OctreePersistLog_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+
+#include "OctreeBinaryFormat.h"
+
+// Append-only log of the changes made to an octree since it was last saved in full.
+//   Saving just what changed costs in proportion to the edit rate rather than to the size of the octree. The log starts
+//   with the header of the snapshot it follows on from, and is only replayed on top of that snapshot, followed by one
+//   block per record in the layout of OctreeBinaryFormat, without the end marker. What a record holds is up to the octree.
+class OctreePersistLog {
+public:
+    OctreePersistLog(const QString& fileName) : _file(fileName) { }
+
+    // truncates the log, so that it follows on from the snapshot with this header
+    bool reset(const OctreeBinaryFormat::Header& header);
+
+    // records are buffered until they are flushed
+    void append(uint8_t recordType, const QByteArray& record);
+    bool flush();
+
+    bool isOpen() const { return _file.isOpen(); }
+    bool isEmpty() const { return _size <= OctreeBinaryFormat::HEADER_SIZE; }
+    qint64 getSize() const { return _size; }
+    QString getFileName() const { return _file.fileName(); }
+
+private:
+    QFile _file;
+    QByteArray _buffer;
+    qint64 _size { 0 };
+};
+
+#endif // hifi_OctreePersistLog_h
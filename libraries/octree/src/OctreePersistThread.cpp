@@ -11,6 +11,7 @@
 
 #include "OctreePersistThread.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -23,28 +24,36 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QFile>
+#include <QFileInfo>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QRegExp>
+#include <QTemporaryDir>
 
 #include <NumericalConstants.h>
 #include <PerfStat.h>
 #include <PathUtils.h>
 #include <Gzip.h>
 
+#include "OctreeBinaryFormat.h"
 #include "OctreeLogging.h"
 #include "OctreeUtils.h"
 #include "OctreeDataUtils.h"
 
 constexpr std::chrono::seconds OctreePersistThread::DEFAULT_PERSIST_INTERVAL { 30 };
+constexpr std::chrono::minutes OctreePersistThread::DEFAULT_SNAPSHOT_INTERVAL { 10 };
 constexpr std::chrono::milliseconds TIME_BETWEEN_PROCESSING { 10 };
 
 constexpr int MAX_OCTREE_REPLACEMENT_BACKUP_FILES_COUNT { 20 };
 constexpr int64_t MAX_OCTREE_REPLACEMENT_BACKUP_FILES_SIZE_BYTES { 50 * 1000 * 1000 };
 
+// a persist log smaller than this is never worth saving all of the octree over
+constexpr qint64 MIN_PERSIST_LOG_SIZE_FOR_SNAPSHOT { 1000 * 1000 };
+
 OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& filename, std::chrono::milliseconds persistInterval,
-                                         bool debugTimestampNow, QString persistAsFileType) :
+                                         bool debugTimestampNow, QString persistAsFileType, bool usePersistLog,
+                                         std::chrono::milliseconds snapshotInterval) :
     _tree(tree),
     _filename(filename),
     _persistInterval(persistInterval),
@@ -53,7 +62,10 @@ OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& file
     _loadTimeUSecs(0),
     _debugTimestampNow(debugTimestampNow),
     _lastTimeDebug(0),
-    _persistAsFileType(persistAsFileType)
+    _persistAsFileType(persistAsFileType),
+    _usePersistLog(usePersistLog),
+    _snapshotInterval(snapshotInterval),
+    _lastSnapshot(std::chrono::steady_clock::now())
 {
     // in case the persist filename has an extension that doesn't match the file type
     QString sansExt = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS);
@@ -72,9 +84,26 @@ void OctreePersistThread::start() {
     auto packet = NLPacket::create(PacketType::OctreeDataFileRequest, -1, true, false);
 
     OctreeUtils::RawOctreeData data;
+    OctreeBinaryFormat::Header binaryHeader;
     qCDebug(octree) << "Reading octree data from" << _filename;
     QFile file(_filename);
-    if (file.open(QIODevice::ReadOnly)) {
+    if (OctreeBinaryFormat::readHeaderFromFile(_filename, binaryHeader)) {
+        // a binary file is loaded straight from disk later on, all we need from it now is its header
+        if (binaryHeader.packetType == _tree->expectedDataPacketType() &&
+            binaryHeader.packetVersion == _tree->expectedVersion()) {
+            qCDebug(octree) << "Current octree data: ID(" << binaryHeader.id << ") DataVersion(" << binaryHeader.dataVersion << ")";
+            packet->writePrimitive(true);
+            auto id = binaryHeader.id.toRfc4122();
+            packet->write(id);
+            packet->writePrimitive((OctreeUtils::Version)binaryHeader.dataVersion);
+        } else {
+            // we can't read it, so get the domain-server's copy, and keep this one around rather than overwrite it
+            qCWarning(octree) << "Octree data in" << _filename << "was written for data packet version"
+                << (int)binaryHeader.packetVersion << "and can't be read";
+            backupCurrentFile();
+            packet->writePrimitive(false);
+        }
+    } else if (file.open(QIODevice::ReadOnly)) {
         QByteArray jsonData(file.readAll());
         file.close();
         if (!gunzip(jsonData, _cachedJSONData)) {
@@ -168,6 +197,10 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 
     _tree->clearDirtyBit(); // the tree is clean since we just loaded it
 
+    if (_usePersistLog) {
+        replayPersistLog();
+    }
+
     unsigned long nodeCount = OctreeElement::getNodeCount();
     unsigned long internalNodeCount = OctreeElement::getInternalNodeCount();
     unsigned long leafNodeCount = OctreeElement::getLeafNodeCount();
@@ -206,6 +239,8 @@ QString OctreePersistThread::getPersistFileMimeType() const {
         return "application/json";
     } if (_persistAsFileType == "json.gz") {
         return "application/zip";
+    } if (_persistAsFileType == "bin") {
+        return "application/octet-stream";
     }
     return "";
 }
@@ -224,11 +259,16 @@ void OctreePersistThread::replaceData(QByteArray data) {
 
 // Return true if current file is backed up successfully or doesn't exist.
 bool OctreePersistThread::backupCurrentFile() {
+    // the persist log only makes sense on top of the file it follows on from, so it goes with it
+    return backupFile(_filename) && backupFile(getPersistLogFilename());
+}
+
+bool OctreePersistThread::backupFile(const QString& filename) {
     // first take the current models file and move it to a different filename, appended with the timestamp
-    QFile currentFile { _filename };
+    QFile currentFile { filename };
     if (currentFile.exists()) {
         static const QString FILENAME_TIMESTAMP_FORMAT = "yyyyMMdd-hhmmss";
-        auto backupFileName = _filename + ".backup." + QDateTime::currentDateTime().toString(FILENAME_TIMESTAMP_FORMAT);
+        auto backupFileName = filename + ".backup." + QDateTime::currentDateTime().toString(FILENAME_TIMESTAMP_FORMAT);
 
         if (currentFile.rename(backupFileName)) {
             qDebug() << "Moved previous models file to" << backupFileName;
@@ -258,11 +298,42 @@ void OctreePersistThread::process() {
 
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
-    persist();
+    if (_persistLog && !_persistLog->isEmpty()) {
+        // leave nothing in the persist log to replay on the next start
+        _tree->setDirtyBit();
+    }
+    persist(true);
     qCDebug(octree) << "Persist thread done with about to finish...";
 }
 
 QByteArray OctreePersistThread::getPersistFileContents() const {
+    if (_usePersistLog && _initialLoadComplete) {
+        // the file is followed by a log of what changed since, which is no use without the file, so hand out all of the
+        // tree as it is now instead
+        return writeTreeToPersistFileType();
+    }
+    return readPersistFile();
+}
+
+QByteArray OctreePersistThread::writeTreeToPersistFileType() const {
+    QByteArray contents;
+    QTemporaryDir directory;
+    if (!directory.isValid()) {
+        qCWarning(octree) << "Failed to create a directory to save the octree to";
+        return contents;
+    }
+
+    QString fileName = directory.filePath("octree." + _persistAsFileType);
+    if (_tree->writeToFile(fileName.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
+        QFile file(fileName);
+        if (file.open(QIODevice::ReadOnly)) {
+            contents = file.readAll();
+        }
+    }
+    return contents;
+}
+
+QByteArray OctreePersistThread::readPersistFile() const {
     QByteArray fileContents;
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
@@ -301,40 +372,145 @@ void OctreePersistThread::cleanupOldReplacementBackups() {
     qDebug() << "Found" << count << "backups";
 }
 
-void OctreePersistThread::persist() {
+void OctreePersistThread::persist(bool forceSnapshot) {
     if (_tree->isDirty() && _initialLoadComplete) {
 
+        if (_persistLog && !forceSnapshot && !isSnapshotDue()) {
+            // cleared first, so that anything that changes while the changes so far are written leaves the tree dirty
+            _tree->clearDirtyBit();
+            if (_tree->writeToPersistLog(*_persistLog)) {
+                return;
+            }
+            qCWarning(octree) << "Failed to write persist log" << _persistLog->getFileName() << "- saving all of the octree";
+        }
+
+        if (writeSnapshot() && _persistAsFileType == "json.gz") {
+            // what we just saved is already what the domain-server keeps
+            sendEntityDataToDS(readPersistFile());
+        } else {
+            sendLatestEntityDataToDS();
+        }
+    }
+}
+
+bool OctreePersistThread::writeSnapshot() {
+    if (_persistLog) {
+        // log everything up to now, in case the snapshot can't be written and the log still has to be replayed on the last one
+        _tree->writeToPersistLog(*_persistLog);
+    }
+
+    _tree->withWriteLock([&] {
+        qCDebug(octree) << "pruning Octree before saving...";
+        _tree->pruneTree();
+        qCDebug(octree) << "DONE pruning Octree before saving...";
+    });
+
+    _tree->incrementPersistDataVersion();
+
+    qCDebug(octree) << "Saving Octree data to:" << _filename;
+    bool success = _tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType);
+    if (success) {
+        _tree->clearDirtyBit(); // tree is clean after saving
+        qCDebug(octree) << "DONE persisting Octree data to" << _filename;
+
+        _lastSnapshot = std::chrono::steady_clock::now();
+        _snapshotSize = QFileInfo(_filename).size();
+        if (_persistLog) {
+            startPersistLog();
+        }
+    } else {
+        qCWarning(octree) << "Failed to persist Octree data to" << _filename;
+    }
+    return success;
+}
+
+bool OctreePersistThread::isSnapshotDue() const {
+    if (!_persistLog->isOpen()) {
+        return true;
+    }
+    if (std::chrono::steady_clock::now() - _lastSnapshot > _snapshotInterval) {
+        return true;
+    }
+    // once the log is bigger than the snapshot it's cheaper to load the octree from a new one
+    return _persistLog->getSize() > std::max(_snapshotSize, MIN_PERSIST_LOG_SIZE_FOR_SNAPSHOT);
+}
+
+QString OctreePersistThread::getPersistLogFilename() const {
+    // the same log for every persist file type, it's tied to whichever snapshot it follows on from by its header
+    return fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS) + ".log";
+}
+
+void OctreePersistThread::replayPersistLog() {
+    _persistLog.reset(new OctreePersistLog(getPersistLogFilename()));
+    _snapshotSize = QFileInfo(_filename).size();
+
+    // the log can only follow on from a snapshot in the file we save to
+    bool needsSnapshot = !QFile::exists(_filename);
+
+    QFileInfo logFile { _persistLog->getFileName() };
+    if (logFile.exists() && logFile.size() > OctreeBinaryFormat::HEADER_SIZE) {
+        qCDebug(octree) << "Replaying persist log" << logFile.absoluteFilePath();
+        bool replayed = false;
         _tree->withWriteLock([&] {
-            qCDebug(octree) << "pruning Octree before saving...";
+            PerformanceWarning warn(true, "Replaying Persist Log", true);
+            replayed = _tree->readFromPersistLogFile(logFile.absoluteFilePath());
             _tree->pruneTree();
-            qCDebug(octree) << "DONE pruning Octree before saving...";
         });
+        if (!replayed) {
+            // don't throw away what couldn't be replayed
+            backupFile(logFile.absoluteFilePath());
+        }
 
-        _tree->incrementPersistDataVersion();
+        // start the new log from what we have now
+        needsSnapshot = true;
+    }
 
-        qCDebug(octree) << "Saving Octree data to:" << _filename;
-        if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
-            _tree->clearDirtyBit(); // tree is clean after saving
-            qCDebug(octree) << "DONE persisting Octree data to" << _filename;
-        } else {
-            qCWarning(octree) << "Failed to persist Octree data to" << _filename;
+    _tree->setTrackPersistChanges(true);
+    if (needsSnapshot) {
+        _tree->setDirtyBit();
+        if (!writeSnapshot()) {
+            _tree->setTrackPersistChanges(false);
+            _persistLog.reset();
         }
+    } else {
+        startPersistLog();
+    }
+}
 
-        sendLatestEntityDataToDS();
+void OctreePersistThread::startPersistLog() {
+    OctreeBinaryFormat::Header header;
+    header.packetType = _tree->expectedDataPacketType();
+    header.packetVersion = _tree->expectedVersion();
+    header.dataVersion = _tree->getPersistDataVersion();
+    header.id = _tree->getPersistID();
+
+    if (!_persistLog->reset(header)) {
+        qCWarning(octree) << "Persist log is unavailable, saving all of the octree every time";
+        _tree->setTrackPersistChanges(false);
+        _persistLog.reset();
     }
 }
 
 void OctreePersistThread::sendLatestEntityDataToDS() {
-    qDebug() << "Sending latest entity data to DS";
-    auto nodeList = DependencyManager::get<NodeList>();
-    const DomainHandler& domainHandler = nodeList->getDomainHandler();
-
     QByteArray data;
     if (_tree->toJSON(&data, nullptr, true)) {
-        auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
-        message->write(data);
-        nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
+        sendEntityDataToDS(data);
     } else {
         qCWarning(octree) << "Failed to persist octree to DS";
     }
 }
+
+void OctreePersistThread::sendEntityDataToDS(const QByteArray& data) {
+    if (data.isEmpty()) {
+        qCWarning(octree) << "Failed to persist octree to DS";
+        return;
+    }
+
+    qDebug() << "Sending latest entity data to DS";
+    auto nodeList = DependencyManager::get<NodeList>();
+    const DomainHandler& domainHandler = nodeList->getDomainHandler();
+
+    auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
+    message->write(data);
+    nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
+}
@@ -14,9 +14,12 @@
 #ifndef hifi_OctreePersistThread_h
 #define hifi_OctreePersistThread_h
 
+#include <memory>
+
 #include <QString>
 #include <GenericThread.h>
 #include "Octree.h"
+#include "OctreePersistLog.h"
 
 class OctreePersistThread : public QObject {
     Q_OBJECT
@@ -31,12 +34,16 @@ public:
     };
 
     static const std::chrono::seconds DEFAULT_PERSIST_INTERVAL;
+    static const std::chrono::minutes DEFAULT_SNAPSHOT_INTERVAL;
 
+    // with a persist log, only what changed is saved every persistInterval, and all of the octree every snapshotInterval
     OctreePersistThread(OctreePointer tree,
                         const QString& filename,
                         std::chrono::milliseconds persistInterval = DEFAULT_PERSIST_INTERVAL,
                         bool debugTimestampNow = false,
-                        QString persistAsFileType = "json.gz");
+                        QString persistAsFileType = "json.gz",
+                        bool usePersistLog = false,
+                        std::chrono::milliseconds snapshotInterval = DEFAULT_SNAPSHOT_INTERVAL);
 
     bool isInitialLoadComplete() const { return _initialLoadComplete; }
     quint64 getLoadElapsedTime() const { return _loadTimeUSecs; }
@@ -58,12 +65,21 @@ protected slots:
     void handleOctreeDataFileReply(QSharedPointer<ReceivedMessage> message);
 
 protected:
-    void persist();
+    void persist(bool forceSnapshot = false);
+    bool writeSnapshot();
+    bool isSnapshotDue() const;
+    void replayPersistLog();
+    void startPersistLog();
+    QString getPersistLogFilename() const;
+    bool backupFile(const QString& filename);
     bool backupCurrentFile();
+    QByteArray readPersistFile() const;
+    QByteArray writeTreeToPersistFileType() const;
     void cleanupOldReplacementBackups();
 
     void replaceData(QByteArray data);
     void sendLatestEntityDataToDS();
+    void sendEntityDataToDS(const QByteArray& data); // gzipped json
 
 private:
     OctreePointer _tree;
@@ -79,6 +95,12 @@ private:
 
     QString _persistAsFileType;
     QByteArray _cachedJSONData;
+
+    bool _usePersistLog;
+    std::chrono::milliseconds _snapshotInterval;
+    std::chrono::steady_clock::time_point _lastSnapshot;
+    qint64 _snapshotSize { 0 };
+    std::unique_ptr<OctreePersistLog> _persistLog;
 };
 
 #endif // hifi_OctreePersistThread_h
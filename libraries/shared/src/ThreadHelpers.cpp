@@ -8,7 +8,12 @@
 
 #include "ThreadHelpers.h"
 
+#include <algorithm>
+#include <vector>
+
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtCore/QDebug>
+#include <QtCore/QThreadPool>
 
 // Support for viewing the thread name in the debugger.  
 // Note, Qt actually does this for you but only in debug builds
@@ -78,3 +83,22 @@ void moveToNewNamedThread(QObject* object, const QString& name, std::function<vo
 void moveToNewNamedThread(QObject* object, const QString& name, QThread::Priority priority) {
     moveToNewNamedThread(object, name, [](QThread*){}, []{}, priority);
 }
+
+void forEachRangeInParallel(int count, int minPerRange, const std::function<void(int begin, int end)>& function) {
+    int numRanges = std::max(1, std::min(QThread::idealThreadCount(), count / std::max(minPerRange, 1)));
+
+    std::vector<QFuture<void>> futures;
+    for (int i = 1; i < numRanges; ++i) {
+        int begin = (count * i) / numRanges;
+        int end = (count * (i + 1)) / numRanges;
+        futures.push_back(QtConcurrent::run(QThreadPool::globalInstance(), [&function, begin, end] {
+            function(begin, end);
+        }));
+    }
+    function(0, count / numRanges);
+
+    // a range no pool thread got to yet is run here
+    for (auto& future : futures) {
+        future.waitForFinished();
+    }
+}
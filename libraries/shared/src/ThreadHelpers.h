@@ -44,6 +44,10 @@ void moveToNewNamedThread(QObject* object, const QString& name,
 void moveToNewNamedThread(QObject* object, const QString& name, 
     QThread::Priority priority = QThread::InheritPriority);
 
+// Splits [0, count) into consecutive ranges of at least minPerRange items, at most one per core, and calls
+// function(begin, end) for each, on the global QThreadPool and the calling thread. Returns once all are done.
+void forEachRangeInParallel(int count, int minPerRange, const std::function<void(int begin, int end)>& function);
+
 class ConditionalGuard {
 public:
     void trigger() {
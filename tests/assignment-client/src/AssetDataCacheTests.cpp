@@ -0,0 +1,126 @@
+//
+//  AssetDataCacheTests.cpp
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetDataCacheTests.h"
+
+#include <QtCore/QFile>
+
+#include <AssetDataCache.h>
+
+QTEST_MAIN(AssetDataCacheTests)
+
+static const int ASSET_SIZE = 100; // bytes
+
+void AssetDataCacheTests::initTestCase() {
+    QVERIFY(_directory.isValid());
+}
+
+QString AssetDataCacheTests::writeAsset(const QString& hash, int size) {
+    QString filePath = _directory.filePath(hash);
+    QFile file(filePath);
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(QByteArray(size, hash.at(0).toLatin1()));
+    }
+    return filePath;
+}
+
+void AssetDataCacheTests::mapsAssets() {
+    AssetDataCache cache;
+    cache.setMaxSize(10 * ASSET_SIZE);
+    QString filePath = writeAsset("a", ASSET_SIZE);
+
+    auto asset = cache.get("a", filePath);
+    QVERIFY((bool)asset);
+    QCOMPARE(asset->getSize(), (qint64)ASSET_SIZE);
+    QCOMPARE(QByteArray(asset->getData(), asset->getSize()), QByteArray(ASSET_SIZE, 'a'));
+    QCOMPARE(cache.get("a", filePath), asset);
+
+    QVERIFY(!cache.get("missing", _directory.filePath("missing")));
+
+    auto stats = cache.getStats();
+    QCOMPARE(stats["1. Cached Assets"].toInt(), 1);
+    QCOMPARE(stats["4. Hits"].toInt(), 1);
+    QCOMPARE(stats["5. Misses"].toInt(), 2);
+}
+
+void AssetDataCacheTests::evictsLeastRecentlyUsedBySize() {
+    AssetDataCache cache;
+    cache.setMaxSize(3 * ASSET_SIZE - 1);
+    QString a = writeAsset("a", ASSET_SIZE);
+    QString b = writeAsset("b", ASSET_SIZE);
+    QString c = writeAsset("c", ASSET_SIZE);
+
+    auto assetA = cache.get("a", a);
+    auto assetB = cache.get("b", b);
+    QCOMPARE(cache.get("a", a), assetA); // a is now the most recently requested
+    auto assetC = cache.get("c", c);
+
+    QCOMPARE(cache.getStats()["6. Evictions"].toInt(), 1);
+    QCOMPARE(cache.get("a", a), assetA);
+    QCOMPARE(cache.get("c", c), assetC);
+    QVERIFY(cache.get("b", b) != assetB);
+}
+
+void AssetDataCacheTests::evictsLeastRecentlyUsedByCount() {
+    AssetDataCache cache;
+    cache.setMaxSize(100 * ASSET_SIZE);
+    cache.setMaxEntries(2);
+    QString a = writeAsset("a", ASSET_SIZE);
+    QString b = writeAsset("b", ASSET_SIZE);
+    QString c = writeAsset("c", ASSET_SIZE);
+
+    auto assetA = cache.get("a", a);
+    auto assetB = cache.get("b", b);
+    QCOMPARE(cache.get("a", a), assetA);
+    auto assetC = cache.get("c", c);
+
+    auto stats = cache.getStats();
+    QCOMPARE(stats["1. Cached Assets"].toInt(), 2);
+    QCOMPARE(stats["6. Evictions"].toInt(), 1);
+    QCOMPARE(cache.get("a", a), assetA);
+    QCOMPARE(cache.get("c", c), assetC);
+    QVERIFY(cache.get("b", b) != assetB);
+
+    // lowering the limit evicts right away
+    cache.setMaxEntries(1);
+    QCOMPARE(cache.getStats()["1. Cached Assets"].toInt(), 1);
+}
+
+void AssetDataCacheTests::skipsAssetsOverTheLimit() {
+    AssetDataCache cache;
+    cache.setMaxSize(ASSET_SIZE);
+    QString large = writeAsset("large", 2 * ASSET_SIZE);
+
+    // still served, just not kept
+    auto asset = cache.get("large", large);
+    QVERIFY((bool)asset);
+    QCOMPARE(asset->getSize(), (qint64)(2 * ASSET_SIZE));
+    QVERIFY(cache.get("large", large) != asset);
+    QCOMPARE(cache.getStats()["1. Cached Assets"].toInt(), 0);
+
+    // as is everything with the cache off
+    QString a = writeAsset("a", ASSET_SIZE);
+    cache.setMaxEntries(0);
+    auto assetA = cache.get("a", a);
+    QVERIFY((bool)assetA);
+    QVERIFY(cache.get("a", a) != assetA);
+}
+
+void AssetDataCacheTests::removesAssets() {
+    AssetDataCache cache;
+    cache.setMaxSize(10 * ASSET_SIZE);
+    QString a = writeAsset("a", ASSET_SIZE);
+
+    auto asset = cache.get("a", a);
+    cache.remove("a");
+    QCOMPARE(cache.getStats()["1. Cached Assets"].toInt(), 0);
+    QVERIFY(cache.get("a", a) != asset);
+}
@@ -0,0 +1,34 @@
+//
+//  AssetDataCacheTests.h
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetDataCacheTests_h
+#define hifi_AssetDataCacheTests_h
+
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+
+class AssetDataCacheTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void mapsAssets();
+    void evictsLeastRecentlyUsedBySize();
+    void evictsLeastRecentlyUsedByCount();
+    void skipsAssetsOverTheLimit();
+    void removesAssets();
+
+private:
+    QString writeAsset(const QString& hash, int size);
+
+    QTemporaryDir _directory;
+};
+
+#endif // hifi_AssetDataCacheTests_h
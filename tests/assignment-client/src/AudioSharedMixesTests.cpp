@@ -0,0 +1,173 @@
+//
+//  AudioSharedMixesTests.cpp
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSharedMixesTests.h"
+
+#include <glm/glm.hpp>
+
+#include <AudioConstants.h>
+#include <AudioSharedMixes.h>
+
+QTEST_MAIN(AudioSharedMixesTests)
+
+static const QString CODEC_NAME = "pcm";
+
+// one listener's view of a source, each listener has its own HRTF for it
+struct Listener {
+    AudioHRTF hrtf;
+    std::vector<StreamToMix> streams;
+
+    void hear(Node::LocalID sourceID, const StreamID& streamID, float azimuthDegrees, float distance, float gain) {
+        NodeIDStreamID nodeStreamID(QUuid(), sourceID, streamID);
+        streams.push_back({ nodeStreamID, nullptr, &hrtf, StreamToMix::HRTF, glm::radians(azimuthDegrees), distance, gain });
+    }
+};
+
+// runs frames until the listeners' groups could be shared, and returns the mix each listener got in the last one
+static std::vector<AudioSharedMixes::Mix*> joinFrames(AudioSharedMixes& sharedMixes, std::vector<Listener*> listeners,
+                                                      int numFrames, const std::vector<QString>& codecNames = {}) {
+    std::vector<AudioSharedMixes::Mix*> mixes(listeners.size(), nullptr);
+    for (int frame = 0; frame < numFrames; ++frame) {
+        sharedMixes.beginFrame();
+        for (size_t i = 0; i < listeners.size(); ++i) {
+            QString codecName = i < codecNames.size() ? codecNames[i] : CODEC_NAME;
+            mixes[i] = sharedMixes.join(codecName, CodecPluginPointer(), listeners[i]->streams);
+        }
+    }
+    return mixes;
+}
+
+void AudioSharedMixesTests::groupsListenersWithinErrorBounds() {
+    AudioSharedMixes sharedMixes;
+    sharedMixes.setErrorBounds(5.0f, 1.0f);
+    StreamID streamID = QUuid::createUuid();
+
+    Listener a, b, c, d;
+    a.hear(1, streamID, 30.0f, 2.0f, 0.5f);
+    b.hear(1, streamID, 31.0f, 2.0f, 0.5f); // within the azimuth bound
+    c.hear(1, streamID, 120.0f, 2.0f, 0.5f); // far off to the side
+    d.hear(1, streamID, 30.0f, 2.0f, 0.05f); // 20dB quieter
+
+    auto mixes = joinFrames(sharedMixes, { &a, &b, &c, &d }, AudioSharedMixes::MIN_SHARED_FRAMES + 1);
+    QVERIFY(mixes[0] != nullptr);
+    QCOMPARE(mixes[1], mixes[0]);
+    QVERIFY(mixes[2] == nullptr);
+    QVERIFY(mixes[3] == nullptr);
+
+    // the group mixes at the bucket centre, which is within the bound of both listeners
+    const auto& parameters = mixes[0]->parameters[0];
+    QVERIFY(fabsf(parameters.azimuth - a.streams[0].azimuth) <= glm::radians(5.0f));
+    QVERIFY(fabsf(parameters.azimuth - b.streams[0].azimuth) <= glm::radians(5.0f));
+    QVERIFY(fabsf(20.0f * log10f(parameters.gain / 0.5f)) <= 1.0f);
+}
+
+void AudioSharedMixesTests::groupsStreamsInAnyOrder() {
+    AudioSharedMixes sharedMixes;
+    StreamID first = QUuid::createUuid();
+    StreamID second = QUuid::createUuid();
+
+    Listener a, b;
+    a.hear(1, first, 0.0f, 1.0f, 1.0f);
+    a.hear(2, second, 90.0f, 4.0f, 0.25f);
+    b.hear(2, second, 90.0f, 4.0f, 0.25f);
+    b.hear(1, first, 0.0f, 1.0f, 1.0f);
+
+    auto mixes = joinFrames(sharedMixes, { &a, &b }, AudioSharedMixes::MIN_SHARED_FRAMES + 1);
+    QVERIFY(mixes[0] != nullptr);
+    QCOMPARE(mixes[1], mixes[0]);
+
+    // both listeners' streams are sorted into the group's order
+    QCOMPARE(b.streams[0].nodeStreamID.nodeLocalID, a.streams[0].nodeStreamID.nodeLocalID);
+    QCOMPARE(b.streams[1].nodeStreamID.nodeLocalID, a.streams[1].nodeStreamID.nodeLocalID);
+    QCOMPARE(b.streams[0].hrtf, &b.hrtf);
+}
+
+void AudioSharedMixesTests::keepsCodecsApart() {
+    AudioSharedMixes sharedMixes;
+    StreamID streamID = QUuid::createUuid();
+
+    Listener a, b;
+    a.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+    b.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+
+    auto mixes = joinFrames(sharedMixes, { &a, &b }, AudioSharedMixes::MIN_SHARED_FRAMES + 1, { "pcm", "opus" });
+    QVERIFY(mixes[0] == nullptr);
+    QVERIFY(mixes[1] == nullptr);
+}
+
+void AudioSharedMixesTests::keepsLoneListenersUnshared() {
+    AudioSharedMixes sharedMixes;
+    StreamID streamID = QUuid::createUuid();
+
+    Listener a;
+    a.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+
+    auto mixes = joinFrames(sharedMixes, { &a }, 10 * AudioSharedMixes::MIN_SHARED_FRAMES);
+    QVERIFY(mixes[0] == nullptr);
+}
+
+void AudioSharedMixesTests::sharesOnlyStableGroups() {
+    AudioSharedMixes sharedMixes;
+    StreamID streamID = QUuid::createUuid();
+
+    Listener a, b;
+    a.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+    b.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+
+    // not shared until the group has had both listeners for long enough
+    auto mixes = joinFrames(sharedMixes, { &a, &b }, AudioSharedMixes::MIN_SHARED_FRAMES);
+    QVERIFY(mixes[0] == nullptr);
+    QVERIFY(mixes[1] == nullptr);
+
+    mixes = joinFrames(sharedMixes, { &a, &b }, 1);
+    QVERIFY(mixes[0] != nullptr);
+    QVERIFY(mixes[0]->isShared());
+    QCOMPARE(mixes[1], mixes[0]);
+
+    // once one listener leaves the other goes back to mixing on its own, and the group drops its state
+    AudioSharedMixes::Mix* mix = mixes[0];
+    mixes = joinFrames(sharedMixes, { &a }, 2);
+    QVERIFY(mixes[0] == nullptr);
+    QVERIFY(!mix->isShared());
+
+    // and coming back starts the count over
+    mixes = joinFrames(sharedMixes, { &a, &b }, AudioSharedMixes::MIN_SHARED_FRAMES);
+    QVERIFY(mixes[0] == nullptr);
+    mixes = joinFrames(sharedMixes, { &a, &b }, 1);
+    QVERIFY(mixes[0] != nullptr);
+}
+
+void AudioSharedMixesTests::fansOutOneEncode() {
+    AudioSharedMixes sharedMixes;
+    StreamID streamID = QUuid::createUuid();
+
+    Listener a, b, c;
+    a.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+    b.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+    c.hear(1, streamID, 0.0f, 1.0f, 1.0f);
+
+    auto mixes = joinFrames(sharedMixes, { &a, &b, &c }, AudioSharedMixes::MIN_SHARED_FRAMES + 1);
+    AudioSharedMixes::Mix* mix = mixes[0];
+    QVERIFY(mix != nullptr);
+    QCOMPARE(mixes[1], mix);
+    QCOMPARE(mixes[2], mix);
+
+    // without a codec the encode is the mix itself, and every listener sends the same buffer
+    QByteArray decodedBuffer(AudioConstants::NETWORK_FRAME_BYTES_STEREO, 1);
+    mix->encode(decodedBuffer);
+    QCOMPARE(mix->encodedBuffer, decodedBuffer);
+
+    // going silent flushes once, then sends nothing
+    mix->encodeSilence();
+    QCOMPARE(mix->encodedBuffer, QByteArray(AudioConstants::NETWORK_FRAME_BYTES_STEREO, 0));
+    mix->encodeSilence();
+    QVERIFY(mix->encodedBuffer.isEmpty());
+}
@@ -0,0 +1,28 @@
+//
+//  AudioSharedMixesTests.h
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSharedMixesTests_h
+#define hifi_AudioSharedMixesTests_h
+
+#include <QtTest/QtTest>
+
+class AudioSharedMixesTests : public QObject {
+    Q_OBJECT
+private slots:
+    void groupsListenersWithinErrorBounds();
+    void groupsStreamsInAnyOrder();
+    void keepsCodecsApart();
+    void keepsLoneListenersUnshared();
+    void sharesOnlyStableGroups();
+    void fansOutOneEncode();
+};
+
+#endif // hifi_AudioSharedMixesTests_h
@@ -0,0 +1,151 @@
+//
+//  OctreeSendThreadPoolTests.cpp
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeSendThreadPoolTests.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <thread>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+#include <OctreeSendThreadPool.h>
+
+QTEST_MAIN(OctreeSendThreadPoolTests)
+
+// stands in for an OctreeSendThread, counting how often and where it is processed
+class TestSendTask : public QObject, public OctreeSendPoolTask {
+public:
+    TestSendTask(quint64 interval, int numProcessesUntilDone = -1, quint64 processingTime = 0) :
+        _interval(interval), _numProcessesUntilDone(numProcessesUntilDone), _processingTime(processingTime) {}
+
+    bool processPooled() override {
+        _isProcessing = true;
+        _processingThread = QThread::currentThread();
+        if (_processingTime > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(_processingTime));
+        }
+        int numProcessed = ++_numProcessed;
+        _nextProcessTime = usecTimestampNow() + _interval;
+        _isProcessing = false;
+        return _numProcessesUntilDone < 0 || numProcessed < _numProcessesUntilDone;
+    }
+    quint64 getNextProcessTime() const override { return _nextProcessTime; }
+    QObject* getPoolObject() override { return this; }
+
+    std::atomic<int> _numProcessed { 0 };
+    std::atomic<bool> _isProcessing { false };
+    std::atomic<QThread*> _processingThread { nullptr };
+
+private:
+    const quint64 _interval;
+    const int _numProcessesUntilDone;
+    const quint64 _processingTime;
+    std::atomic<quint64> _nextProcessTime { 0 };
+};
+
+void OctreeSendThreadPoolTests::processesWhenDue() {
+    OctreeSendThreadPool pool(1);
+    const quint64 INTERVAL = 10 * USECS_PER_MSEC;
+    TestSendTask task(INTERVAL);
+    pool.add(&task);
+
+    QTRY_VERIFY_WITH_TIMEOUT(task._numProcessed > 0, 1000);
+    QThread* worker = task._processingThread;
+    QVERIFY(worker != QThread::currentThread());
+    QCOMPARE(task.thread(), worker);
+
+    // about one process per interval, not one per worker wake up
+    int numProcessed = task._numProcessed;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    int numProcessedInInterval = task._numProcessed - numProcessed;
+    QVERIFY(numProcessedInInterval >= 5);
+    QVERIFY(numProcessedInInterval <= 25);
+
+    pool.remove(&task);
+}
+
+void OctreeSendThreadPoolTests::dropsFinishedTasks() {
+    OctreeSendThreadPool pool(2);
+    const int NUM_PROCESSES = 3;
+    TestSendTask task(USECS_PER_MSEC, NUM_PROCESSES);
+    pool.add(&task);
+
+    QTRY_COMPARE_WITH_TIMEOUT((int)task._numProcessed, NUM_PROCESSES, 1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    QCOMPARE((int)task._numProcessed, NUM_PROCESSES);
+
+    // removing a task that has already been dropped is fine
+    pool.remove(&task);
+}
+
+void OctreeSendThreadPoolTests::wakesForNewTasks() {
+    OctreeSendThreadPool pool(1);
+
+    // let the worker go to sleep with nothing to do, the task is due right away so it has to be woken for it
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TestSendTask task(USECS_PER_SECOND);
+    quint64 addTime = usecTimestampNow();
+    pool.add(&task);
+
+    QTRY_VERIFY_WITH_TIMEOUT(task._numProcessed > 0, 1000);
+    QVERIFY(usecTimestampNow() - addTime < 50 * USECS_PER_MSEC);
+
+    pool.remove(&task);
+}
+
+void OctreeSendThreadPoolTests::spreadsTasksOverWorkers() {
+    const int NUM_WORKERS = 3;
+    const int NUM_TASKS_PER_WORKER = 2;
+    OctreeSendThreadPool pool(NUM_WORKERS);
+    QCOMPARE(pool.numThreads(), NUM_WORKERS);
+
+    std::vector<std::unique_ptr<TestSendTask>> tasks;
+    for (int i = 0; i < NUM_WORKERS * NUM_TASKS_PER_WORKER; ++i) {
+        tasks.emplace_back(new TestSendTask(5 * USECS_PER_MSEC));
+        pool.add(tasks.back().get());
+    }
+
+    std::map<QThread*, int> numTasksPerWorker;
+    for (auto& task : tasks) {
+        QVERIFY(task->thread() != QThread::currentThread());
+        ++numTasksPerWorker[task->thread()];
+    }
+    QCOMPARE((int)numTasksPerWorker.size(), NUM_WORKERS);
+    for (auto& workerTasks : numTasksPerWorker) {
+        QCOMPARE(workerTasks.second, NUM_TASKS_PER_WORKER);
+    }
+
+    for (auto& task : tasks) {
+        QTRY_VERIFY_WITH_TIMEOUT(task->_numProcessed > 0, 1000);
+        QCOMPARE((QThread*)task->_processingThread, task->thread());
+        pool.remove(task.get());
+    }
+}
+
+void OctreeSendThreadPoolTests::removeWaitsForProcessing() {
+    OctreeSendThreadPool pool(1);
+    const quint64 PROCESSING_TIME = 20 * USECS_PER_MSEC;
+    TestSendTask task(0, -1, PROCESSING_TIME);
+    pool.add(&task);
+
+    QTRY_VERIFY_WITH_TIMEOUT(task._isProcessing, 1000);
+    pool.remove(&task);
+    QVERIFY(!task._isProcessing);
+
+    // and it is not processed again after
+    int numProcessed = task._numProcessed;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    QCOMPARE((int)task._numProcessed, numProcessed);
+}
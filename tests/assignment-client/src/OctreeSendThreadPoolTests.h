@@ -0,0 +1,27 @@
+//
+//  OctreeSendThreadPoolTests.h
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeSendThreadPoolTests_h
+#define hifi_OctreeSendThreadPoolTests_h
+
+#include <QtTest/QtTest>
+
+class OctreeSendThreadPoolTests : public QObject {
+    Q_OBJECT
+private slots:
+    void processesWhenDue();
+    void dropsFinishedTasks();
+    void wakesForNewTasks();
+    void spreadsTasksOverWorkers();
+    void removeWaitsForProcessing();
+};
+
+#endif // hifi_OctreeSendThreadPoolTests_h
@@ -0,0 +1,168 @@
+//
+//  SharedDiffTraversalsTests.cpp
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SharedDiffTraversalsTests.h"
+
+#include <chrono>
+#include <thread>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <EntityPriorityQueue.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <GLMHelpers.h>
+#include <NodeList.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <ViewFrustum.h>
+
+#include <SharedDiffTraversals.h>
+
+QTEST_MAIN(SharedDiffTraversalsTests)
+
+static const uint64_t TRAVERSAL_TIME_BUDGET = USECS_PER_SECOND;
+
+// a view from position looking down -z
+static DiffTraversal::View makeView(const glm::vec3& position) {
+    ViewFrustum viewFrustum;
+    viewFrustum.setProjection(glm::perspective(PI / 2.0f, 1.0f, 0.1f, 100.0f));
+    viewFrustum.setPosition(position);
+    viewFrustum.setOrientation(glm::quat());
+    viewFrustum.setCenterRadius(1.0f);
+    viewFrustum.calculate();
+
+    DiffTraversal::View view;
+    view.viewFrustums.push_back(ConicalViewFrustum(viewFrustum));
+    view.startTime = usecTimestampNow();
+    return view;
+}
+
+static EntityTreeElementPointer getRoot(const EntityTreePointer& tree) {
+    return std::static_pointer_cast<EntityTreeElement>(tree->getRoot());
+}
+
+static EntityTreePointer makeTree() {
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    tree->setIsServer(true);
+    return tree;
+}
+
+void SharedDiffTraversalsTests::initTestCase() {
+    // entities are only constructed when there's a NodeList
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+}
+
+void SharedDiffTraversalsTests::sharesSameTraversal() {
+    auto tree = makeTree();
+    SharedDiffTraversals traversals;
+    QVERIFY(!traversals.isEnabled());
+
+    auto view = makeView(glm::vec3(0.0f));
+    auto nearbyView = makeView(glm::vec3(1.0f, 0.0f, 0.0f));
+    auto farView = makeView(glm::vec3(100.0f, 0.0f, 0.0f));
+    DiffTraversal::View noCompletedView;
+
+    auto traversal = traversals.get(DiffTraversal::First, view, noCompletedView, getRoot(tree));
+    QCOMPARE(traversal->getType(), DiffTraversal::First);
+    QCOMPARE(traversals.get(DiffTraversal::First, nearbyView, noCompletedView, getRoot(tree)), traversal);
+    QVERIFY(traversals.get(DiffTraversal::First, farView, noCompletedView, getRoot(tree)) != traversal);
+
+    QCOMPARE(traversals.getNumTraversals(), (uint64_t)2);
+    QCOMPARE(traversals.getNumShared(), (uint64_t)1);
+}
+
+void SharedDiffTraversalsTests::keepsTypesApart() {
+    auto tree = makeTree();
+    SharedDiffTraversals traversals;
+
+    auto view = makeView(glm::vec3(0.0f));
+    auto completedView = makeView(glm::vec3(50.0f, 0.0f, 0.0f));
+    DiffTraversal::View noCompletedView;
+
+    auto first = traversals.get(DiffTraversal::First, view, noCompletedView, getRoot(tree));
+    auto differential = traversals.get(DiffTraversal::Differential, view, completedView, getRoot(tree));
+    QVERIFY(differential != first);
+    QCOMPARE(differential->getType(), DiffTraversal::Differential);
+    QCOMPARE(traversals.get(DiffTraversal::First, view, noCompletedView, getRoot(tree)), first);
+    QCOMPARE(traversals.get(DiffTraversal::Differential, view, completedView, getRoot(tree)), differential);
+}
+
+void SharedDiffTraversalsTests::keepsCompletedViewsApart() {
+    auto tree = makeTree();
+    SharedDiffTraversals traversals;
+
+    auto view = makeView(glm::vec3(0.0f));
+    auto completedView = makeView(glm::vec3(50.0f, 0.0f, 0.0f));
+    auto nearbyCompletedView = makeView(glm::vec3(51.0f, 0.0f, 0.0f));
+    auto otherCompletedView = makeView(glm::vec3(-50.0f, 0.0f, 0.0f));
+
+    auto traversal = traversals.get(DiffTraversal::Differential, view, completedView, getRoot(tree));
+    QCOMPARE(traversals.get(DiffTraversal::Differential, view, nearbyCompletedView, getRoot(tree)), traversal);
+    QVERIFY(traversals.get(DiffTraversal::Differential, view, otherCompletedView, getRoot(tree)) != traversal);
+}
+
+void SharedDiffTraversalsTests::recordsEntitiesInView() {
+    auto tree = makeTree();
+
+    // a row of boxes in front of the view, and one behind it
+    const int NUM_IN_VIEW = 10;
+    QSet<EntityItemID> inViewIDs;
+    for (int i = 0; i < NUM_IN_VIEW; ++i) {
+        EntityItemProperties properties;
+        properties.setType(EntityTypes::Box);
+        properties.setPosition(glm::vec3((float)i - 5.0f, 0.0f, -10.0f));
+        EntityItemID entityID(QUuid::createUuid());
+        QVERIFY((bool)tree->addEntity(entityID, properties));
+        inViewIDs.insert(entityID);
+    }
+    EntityItemProperties behindProperties;
+    behindProperties.setType(EntityTypes::Box);
+    behindProperties.setPosition(glm::vec3(0.0f, 0.0f, 50.0f));
+    EntityItemID behindID(QUuid::createUuid());
+    QVERIFY((bool)tree->addEntity(behindID, behindProperties));
+
+    SharedDiffTraversals traversals;
+    auto view = makeView(glm::vec3(0.0f));
+    auto traversal = traversals.get(DiffTraversal::First, view, DiffTraversal::View(), getRoot(tree));
+    QVERIFY(!traversal->isFinished());
+    QVERIFY(traversal->traverse(TRAVERSAL_TIME_BUDGET));
+    QVERIFY(traversal->isFinished());
+
+    QSet<EntityItemID> sendableIDs;
+    for (const auto& result : traversal->getResults()) {
+        auto entity = result.entity.lock();
+        QVERIFY((bool)entity);
+        QCOMPARE(result.priority, traversal->getView().computePriority(entity));
+        if (result.priority != PrioritizedEntity::DO_NOT_SEND) {
+            sendableIDs.insert(entity->getEntityItemID());
+        }
+    }
+    QCOMPARE(sendableIDs, inViewIDs);
+}
+
+void SharedDiffTraversalsTests::dropsStaleTraversals() {
+    auto tree = makeTree();
+    SharedDiffTraversals traversals;
+    auto view = makeView(glm::vec3(0.0f));
+    DiffTraversal::View noCompletedView;
+
+    auto traversal = traversals.get(DiffTraversal::First, view, noCompletedView, getRoot(tree));
+    QVERIFY(traversal->traverse(TRAVERSAL_TIME_BUDGET));
+
+    // a finished traversal is only handed out to clients asking in the same frame
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    QVERIFY(traversals.get(DiffTraversal::First, view, noCompletedView, getRoot(tree)) != traversal);
+}
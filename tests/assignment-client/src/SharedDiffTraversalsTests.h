@@ -0,0 +1,28 @@
+//
+//  SharedDiffTraversalsTests.h
+//  tests/assignment-client/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SharedDiffTraversalsTests_h
+#define hifi_SharedDiffTraversalsTests_h
+
+#include <QtTest/QtTest>
+
+class SharedDiffTraversalsTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void sharesSameTraversal();
+    void keepsTypesApart();
+    void keepsCompletedViewsApart();
+    void recordsEntitiesInView();
+    void dropsStaleTraversals();
+};
+
+#endif // hifi_SharedDiffTraversalsTests_h
@@ -0,0 +1,145 @@
+//
+//  AudioDSPTests.cpp
+//  tests/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioDSPTests.h"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <AudioConstants.h>
+#include <AudioGate.h>
+#include <AudioLimiter.h>
+#include <AudioReverb.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(AudioDSPTests)
+
+static const int MAX_TEST_FRAMES = 300;
+
+static void randomSamples(std::mt19937& random, std::vector<float>& samples, float amplitude) {
+    std::uniform_real_distribution<float> distribution(-amplitude, amplitude);
+    for (auto& sample : samples) {
+        sample = distribution(random);
+    }
+}
+
+void AudioDSPTests::limiterKernelsTest() {
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> gainDistribution(0.0f, 32768.0f);
+    std::uniform_real_distribution<float> ditherDistribution(-1.0f, 1.0f);
+
+    // every length up to a few blocks, so the SIMD loops and their scalar tails all run
+    for (int numFrames = 1; numFrames <= MAX_TEST_FRAMES; ++numFrames) {
+        std::vector<float> input(2 * numFrames);
+        randomSamples(random, input, 4.0f);
+
+        // peaks in and out of the limiter's range, and specials
+        std::vector<float> peakInput = input;
+        for (int i = 0; i < 2 * numFrames; i += 7) {
+            uint32_t bits = (uint32_t)random();
+            memcpy(&peakInput[i], &bits, sizeof(bits));
+        }
+        peakInput[0] = 0.0f;
+        peakInput[2 * numFrames - 1] = 65536.0f;
+
+        std::vector<int32_t> expectedPeaks(numFrames);
+        std::vector<int32_t> peaks(numFrames);
+        AudioLimiterKernels::peaklog2Stereo_ref(peakInput.data(), expectedPeaks.data(), numFrames);
+        AudioLimiterKernels::peaklog2Stereo(peakInput.data(), peaks.data(), numFrames);
+        QCOMPARE(peaks, expectedPeaks);
+
+        std::vector<float> gain(numFrames);
+        std::vector<float> dither(numFrames);
+        for (int i = 0; i < numFrames; ++i) {
+            gain[i] = gainDistribution(random);
+            dither[i] = ditherDistribution(random);
+        }
+
+        std::vector<int16_t> expectedOutput(2 * numFrames);
+        std::vector<int16_t> output(2 * numFrames);
+        AudioLimiterKernels::applyGainStereo_ref(input.data(), gain.data(), dither.data(), expectedOutput.data(), numFrames);
+        AudioLimiterKernels::applyGainStereo(input.data(), gain.data(), dither.data(), output.data(), numFrames);
+        QCOMPARE(output, expectedOutput);
+    }
+}
+
+#ifdef MANUAL_TEST
+
+static const int NUM_BENCHMARK_BLOCKS = 20000;
+static const int FRAMES_PER_BLOCK = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+
+template <typename F>
+static float timeNsPerFrame(F&& block) {
+    uint64_t startTime = usecTimestampNow();
+    for (int i = 0; i < NUM_BENCHMARK_BLOCKS; ++i) {
+        block();
+    }
+    uint64_t elapsed = usecTimestampNow() - startTime;
+    return (float)(elapsed * 1000) / ((float)NUM_BENCHMARK_BLOCKS * FRAMES_PER_BLOCK);
+}
+
+void AudioDSPTests::benchmark() {
+    std::mt19937 random(1);
+
+    std::vector<float> input(2 * FRAMES_PER_BLOCK);
+    randomSamples(random, input, 2.0f);
+    std::vector<int16_t> input16(2 * FRAMES_PER_BLOCK);
+    for (int i = 0; i < 2 * FRAMES_PER_BLOCK; ++i) {
+        input16[i] = (int16_t)(input[i] * 8192.0f);
+    }
+    std::vector<float> gain(FRAMES_PER_BLOCK, 16384.0f);
+    std::vector<float> dither(FRAMES_PER_BLOCK, 0.5f);
+
+    std::vector<int32_t> peaks(FRAMES_PER_BLOCK);
+    std::vector<int16_t> output(2 * FRAMES_PER_BLOCK);
+
+    std::cout << "[kernel, refNsPerFrame, dispatchedNsPerFrame] = [" << std::endl;
+
+    std::cout << "    peaklog2Stereo, "
+        << timeNsPerFrame([&] {
+            AudioLimiterKernels::peaklog2Stereo_ref(input.data(), peaks.data(), FRAMES_PER_BLOCK);
+        }) << ", "
+        << timeNsPerFrame([&] {
+            AudioLimiterKernels::peaklog2Stereo(input.data(), peaks.data(), FRAMES_PER_BLOCK);
+        }) << std::endl;
+
+    std::cout << "    applyGainStereo, "
+        << timeNsPerFrame([&] {
+            AudioLimiterKernels::applyGainStereo_ref(input.data(), gain.data(), dither.data(), output.data(),
+                                                     FRAMES_PER_BLOCK);
+        }) << ", "
+        << timeNsPerFrame([&] {
+            AudioLimiterKernels::applyGainStereo(input.data(), gain.data(), dither.data(), output.data(),
+                                                 FRAMES_PER_BLOCK);
+        }) << std::endl;
+
+    std::cout << "];" << std::endl;
+
+    AudioLimiter limiter(AudioConstants::SAMPLE_RATE, AudioConstants::STEREO);
+    AudioGate gate(AudioConstants::SAMPLE_RATE, AudioConstants::STEREO);
+    AudioReverb reverb(AudioConstants::SAMPLE_RATE);
+
+    std::cout << "[block, nsPerFrame] = [" << std::endl;
+    std::cout << "    AudioLimiter, " << timeNsPerFrame([&] {
+        limiter.render(input.data(), output.data(), FRAMES_PER_BLOCK);
+    }) << std::endl;
+    std::cout << "    AudioGate, " << timeNsPerFrame([&] {
+        gate.render(input16.data(), output.data(), FRAMES_PER_BLOCK);
+    }) << std::endl;
+    std::cout << "    AudioReverb, " << timeNsPerFrame([&] {
+        reverb.render(input16.data(), output.data(), FRAMES_PER_BLOCK);
+    }) << std::endl;
+    std::cout << "];" << std::endl;
+}
+
+#endif // MANUAL_TEST
@@ -0,0 +1,33 @@
+//
+//  AudioDSPTests.h
+//  tests/audio/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioDSPTests_h
+#define hifi_AudioDSPTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+//#define MANUAL_TEST
+
+class AudioDSPTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test the limiter kernels this CPU dispatches to give the same bits as the reference code
+    void limiterKernelsTest();
+
+#ifdef MANUAL_TEST
+    // Report ns/frame for the DSP kernels and blocks, against the reference code where there is one
+    void benchmark();
+#endif // MANUAL_TEST
+};
+
+#endif // hifi_AudioDSPTests_h
@@ -11,6 +11,13 @@
 
 #include "AudioRingBufferTests.h"
 
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "AudioSPSCRingBuffer.h"
 #include "SharedUtil.h"
 
 // Adds an implicit cast to make sure that actual and expected are of the same type.
@@ -125,3 +132,192 @@ void AudioRingBufferTests::runAllTests() {
         assertBufferSize(ringBuffer, 0);
     }
 }
+
+void AudioRingBufferTests::spscTest() {
+    int16_t writeData[1000];
+    for (int i = 0; i < 1000; i++) { writeData[i] = i; }
+
+    int16_t readData[1000];
+
+    AudioSPSCRingBuffer ringBuffer(10, 10); // makes buffer of 100 int16_t samples
+    QCOMPARE(ringBuffer.getSampleCapacity(), 100);
+
+    // go around the ring a few times, so that reads and writes wrap at every offset
+    for (int T = 0; T < 300; T++) {
+        int writeIndexAt = 0;
+        int readIndexAt = 0;
+
+        // write 73 samples, 73 samples in buffer
+        writeIndexAt += ringBuffer.writeSamples(&writeData[writeIndexAt], 73);
+        QCOMPARE(ringBuffer.samplesAvailable(), 73);
+        QCOMPARE(ringBuffer.framesAvailable(), 7);
+
+        // read 43 samples, 30 samples in buffer
+        readIndexAt += ringBuffer.readSamples(&readData[readIndexAt], 43);
+        QCOMPARE(ringBuffer.samplesAvailable(), 30);
+
+        // write 80 samples, only 70 fit (the oldest samples are never overwritten), 100 samples in buffer (full)
+        int overflowCount = ringBuffer.getOverflowCount();
+        QCOMPARE(ringBuffer.writeSamples(&writeData[writeIndexAt], 80), 70);
+        writeIndexAt += 70;
+        QCOMPARE(ringBuffer.getOverflowCount(), overflowCount + 1);
+        QCOMPARE(ringBuffer.samplesAvailable(), 100);
+
+        // silence doesn't fit either, and isn't an overflow
+        QCOMPARE(ringBuffer.addSilentSamples(10), 0);
+        QCOMPARE(ringBuffer.getOverflowCount(), overflowCount + 1);
+
+        // read 200 samples, get 100, 0 samples in buffer (empty)
+        readIndexAt += ringBuffer.readSamples(&readData[readIndexAt], 200);
+        QCOMPARE(readIndexAt, 143);
+        QCOMPARE(ringBuffer.samplesAvailable(), 0);
+
+        // verify 143 samples of read data
+        for (int i = 0; i < 143; i++) {
+            QCOMPARE(readData[i], (int16_t)i);
+        }
+
+        // write 3 samples and 4 silent samples, skip 2 and read back "2" then the silence
+        ringBuffer.writeSamples(writeData, 3);
+        QCOMPARE(ringBuffer.addSilentSamples(4), 4);
+        ringBuffer.skipSamples(2);
+        QCOMPARE(ringBuffer.readData((char*)readData, 100 * sizeof(int16_t)), (int)(5 * sizeof(int16_t)));
+        QCOMPARE(readData[0], (int16_t)2);
+        for (int i = 1; i < 5; i++) {
+            QCOMPARE(readData[i], (int16_t)0);
+        }
+    }
+
+    // appending adds to the destination
+    AudioSPSCMixRingBuffer mixRingBuffer(10, 10);
+    float mixData[10] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    float appendData[10] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    QCOMPARE(mixRingBuffer.writeSamples(mixData, 10), 10);
+    QCOMPARE(mixRingBuffer.appendSamples(appendData, 5), 5);
+    QCOMPARE(mixRingBuffer.appendSamples(appendData + 5, 10), 5);
+    for (int i = 0; i < 10; i++) {
+        QCOMPARE(appendData[i], 1.0f);
+    }
+
+    // resizing empties the buffer
+    ringBuffer.writeSamples(writeData, 50);
+    ringBuffer.resizeForFrameSize(20);
+    QCOMPARE(ringBuffer.getSampleCapacity(), 200);
+    QCOMPARE(ringBuffer.samplesAvailable(), 0);
+    QCOMPARE(ringBuffer.getOverflowCount(), 0);
+}
+
+static const int MAX_STRESS_BLOCK_SAMPLES = 1024;
+
+// hands numSamples from a producer to a consumer thread in blocks of random sizes,
+// and returns the number of samples the consumer read out of order
+template <class Write, class Read>
+static int64_t runProducerConsumer(int64_t numSamples, Write write, Read read) {
+    std::thread producer([&] {
+        std::mt19937 random(1);
+        std::uniform_int_distribution<int> blockSize(1, MAX_STRESS_BLOCK_SAMPLES);
+        int16_t block[MAX_STRESS_BLOCK_SAMPLES];
+
+        int64_t sampleAt = 0;
+        while (sampleAt < numSamples) {
+            int numBlockSamples = (int)std::min((int64_t)blockSize(random), numSamples - sampleAt);
+            for (int i = 0; i < numBlockSamples; i++) {
+                block[i] = (int16_t)(sampleAt + i);
+            }
+
+            int numWritten = write(block, numBlockSamples);
+            sampleAt += numWritten;
+            if (numWritten < numBlockSamples) {
+                // full, give the consumer a chance (the test may well be running on one core)
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::mt19937 random(2);
+    std::uniform_int_distribution<int> blockSize(1, MAX_STRESS_BLOCK_SAMPLES);
+    int16_t block[MAX_STRESS_BLOCK_SAMPLES];
+
+    int64_t numOutOfOrder = 0;
+    int64_t sampleAt = 0;
+    while (sampleAt < numSamples) {
+        int numBlockSamples = blockSize(random);
+
+        int numRead = read(block, numBlockSamples);
+        for (int i = 0; i < numRead; i++) {
+            if (block[i] != (int16_t)(sampleAt + i)) {
+                ++numOutOfOrder;
+            }
+        }
+        sampleAt += numRead;
+        if (numRead < numBlockSamples) {
+            // empty, give the producer a chance
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    return numOutOfOrder;
+}
+
+void AudioRingBufferTests::spscStressTest() {
+    const int64_t NUM_SAMPLES = 20 * 1000 * 1000;
+
+    // an odd capacity, so that blocks wrap at every offset
+    AudioSPSCRingBuffer ringBuffer(241, 10);
+
+    int64_t numOutOfOrder = runProducerConsumer(NUM_SAMPLES, [&](const int16_t* block, int numSamples) {
+        return ringBuffer.writeSamples(block, numSamples);
+    }, [&](int16_t* block, int numSamples) {
+        return ringBuffer.readSamples(block, numSamples);
+    });
+
+    QCOMPARE(numOutOfOrder, (int64_t)0);
+    QCOMPARE(ringBuffer.samplesAvailable(), 0);
+}
+
+#ifdef MANUAL_TEST
+void AudioRingBufferTests::spscBenchmark() {
+    const int64_t NUM_SAMPLES = 200 * 1000 * 1000;
+    const int NUM_FRAME_SAMPLES = AudioConstants::NETWORK_FRAME_SAMPLES_STEREO;
+
+    std::cout << "[ringBuffer, samplesPerSec] = [" << std::endl;
+
+    {
+        AudioSPSCRingBuffer ringBuffer(NUM_FRAME_SAMPLES);
+
+        uint64_t startTime = usecTimestampNow();
+        int64_t numOutOfOrder = runProducerConsumer(NUM_SAMPLES, [&](const int16_t* block, int numSamples) {
+            return ringBuffer.writeSamples(block, numSamples);
+        }, [&](int16_t* block, int numSamples) {
+            return ringBuffer.readSamples(block, numSamples);
+        });
+        uint64_t elapsed = usecTimestampNow() - startTime;
+
+        QCOMPARE(numOutOfOrder, (int64_t)0);
+        std::cout << "    AudioSPSCRingBuffer, " << (float)NUM_SAMPLES / ((float)elapsed / USECS_PER_SECOND) << std::endl;
+    }
+
+    {
+        // the locked buffer overwrites on overflow, so only write what there is room for, like a careful producer would
+        AudioRingBuffer ringBuffer(NUM_FRAME_SAMPLES);
+        std::mutex mutex;
+
+        uint64_t startTime = usecTimestampNow();
+        int64_t numOutOfOrder = runProducerConsumer(NUM_SAMPLES, [&](const int16_t* block, int numSamples) {
+            std::lock_guard<std::mutex> lock(mutex);
+            numSamples = std::min(numSamples, ringBuffer.getSampleCapacity() - ringBuffer.samplesAvailable());
+            return ringBuffer.writeSamples(block, numSamples);
+        }, [&](int16_t* block, int numSamples) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return ringBuffer.readSamples(block, numSamples);
+        });
+        uint64_t elapsed = usecTimestampNow() - startTime;
+
+        QCOMPARE(numOutOfOrder, (int64_t)0);
+        std::cout << "    AudioRingBuffer + mutex, " << (float)NUM_SAMPLES / ((float)elapsed / USECS_PER_SECOND) << std::endl;
+    }
+
+    std::cout << "];" << std::endl;
+}
+#endif // MANUAL_TEST
@@ -16,11 +16,24 @@
 
 #include "AudioRingBuffer.h"
 
+//#define MANUAL_TEST
 
 class AudioRingBufferTests : public QObject {
     Q_OBJECT
 private slots:
     void runAllTests();
+
+    // Test the single-producer single-consumer ring buffer from one thread
+    void spscTest();
+
+    // Test a producer and a consumer thread hand every sample across in order, with random write/read sizes
+    void spscStressTest();
+
+#ifdef MANUAL_TEST
+    // Report the samples/sec a producer and consumer thread get through the SPSC and the mutex-locked ring buffers
+    void spscBenchmark();
+#endif // MANUAL_TEST
+
 private:
     void assertBufferSize(const AudioRingBuffer& buffer, int samples);
 };
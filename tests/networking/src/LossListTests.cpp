@@ -0,0 +1,218 @@
+//
+//  LossListTests.cpp
+//  tests/networking/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LossListTests.h"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <SharedUtil.h>
+#include <udt/ControlPacket.h>
+#include <udt/LossList.h>
+
+QTEST_MAIN(LossListTests)
+
+using namespace udt;
+
+using Pairs = std::vector<std::pair<SequenceNumber, SequenceNumber>>;
+
+// reads back the (first, last) pairs LossList::write puts in a control packet - the type is only a carrier here
+static Pairs writtenPairs(LossList& lossList) {
+    auto packet = ControlPacket::create(ControlPacket::ACK);
+    lossList.write(*packet);
+
+    Pairs pairs;
+    packet->seek(0);
+    while (packet->bytesLeftToRead() >= (qint64)(2 * sizeof(SequenceNumber))) {
+        SequenceNumber first, last;
+        packet->readPrimitive(&first);
+        packet->readPrimitive(&last);
+        pairs.emplace_back(first, last);
+    }
+    return pairs;
+}
+
+static SequenceNumber seq(int value) {
+    return SequenceNumber(value);
+}
+
+void LossListTests::rangesTest() {
+    LossList lossList;
+    QVERIFY(lossList.isEmpty());
+
+    lossList.append(seq(10));
+    lossList.append(seq(11));
+    lossList.append(seq(20), seq(29));
+    QCOMPARE(lossList.getLength(), 12);
+    QVERIFY(writtenPairs(lossList) == Pairs({ { seq(10), seq(11) }, { seq(20), seq(29) } }));
+
+    // bridge the gap between the two ranges, overlapping both
+    lossList.insert(seq(11), seq(20));
+    QCOMPARE(lossList.getLength(), 20);
+    QVERIFY(writtenPairs(lossList) == Pairs({ { seq(10), seq(29) } }));
+
+    // punch a hole in the middle, then remove across a range edge
+    QVERIFY(lossList.remove(seq(15)));
+    QVERIFY(!lossList.remove(seq(15)));
+    lossList.remove(seq(25), seq(40));
+    QCOMPARE(lossList.getLength(), 14);
+    QVERIFY(writtenPairs(lossList) == Pairs({ { seq(10), seq(14) }, { seq(16), seq(24) } }));
+
+    QCOMPARE(lossList.getFirstSequenceNumber(), seq(10));
+    QCOMPARE(lossList.popFirstSequenceNumber(), seq(10));
+    QCOMPARE(lossList.getFirstSequenceNumber(), seq(11));
+
+    lossList.remove(lossList.getFirstSequenceNumber(), seq(24));
+    QVERIFY(lossList.isEmpty());
+    QVERIFY(writtenPairs(lossList).empty());
+}
+
+void LossListTests::wrapAroundTest() {
+    const auto MAX = SequenceNumber::MAX;
+
+    LossList lossList;
+    lossList.append(seq(MAX - 2), seq(2));
+    QCOMPARE(lossList.getLength(), 6);
+    QCOMPARE(lossList.getFirstSequenceNumber(), seq(MAX - 2));
+
+    // remove the sequence numbers either side of the wrap
+    lossList.remove(seq(MAX), seq(0));
+    QCOMPARE(lossList.getLength(), 4);
+    QVERIFY(writtenPairs(lossList) == Pairs({ { seq(MAX - 2), seq(MAX - 1) }, { seq(1), seq(2) } }));
+
+    lossList.insert(seq(MAX - 1), seq(1));
+    QCOMPARE(lossList.getLength(), 6);
+    QVERIFY(writtenPairs(lossList) == Pairs({ { seq(MAX - 2), seq(2) } }));
+}
+
+void LossListTests::randomOperationsTest() {
+    // run once away from the wrap-around and once across it
+    for (int base : { 1000, SequenceNumber::MAX - 500 }) {
+        std::mt19937 generator(base);
+        auto at = [base](int offset) { return seq(base) + offset; };
+
+        LossList lossList;
+        std::set<int> expected;
+        int nextAppend = 0;
+
+        for (int i = 0; i < 5000; ++i) {
+            int start = generator() % (nextAppend + 1);
+
+            switch (generator() % 5) {
+                case 0: {
+                    start = nextAppend + generator() % 5;
+                    int end = start + generator() % 4;
+                    lossList.append(at(start), at(end));
+                    for (int offset = start; offset <= end; ++offset) {
+                        expected.insert(offset);
+                    }
+                    nextAppend = end + 1;
+                    break;
+                }
+                case 1: {
+                    int end = start + generator() % 10;
+                    lossList.insert(at(start), at(end));
+                    for (int offset = start; offset <= end; ++offset) {
+                        expected.insert(offset);
+                    }
+                    nextAppend = std::max(nextAppend, end + 1);
+                    break;
+                }
+                case 2:
+                    QCOMPARE(lossList.remove(at(start)), expected.erase(start) == 1);
+                    break;
+                case 3: {
+                    int end = start + generator() % 20;
+                    lossList.remove(at(start), at(end));
+                    for (int offset = start; offset <= end; ++offset) {
+                        expected.erase(offset);
+                    }
+                    break;
+                }
+                default:
+                    if (!expected.empty()) {
+                        QCOMPARE(lossList.popFirstSequenceNumber(), at(*expected.begin()));
+                        expected.erase(expected.begin());
+                    }
+                    break;
+            }
+
+            QCOMPARE(lossList.getLength(), (int)expected.size());
+        }
+
+        // the NAK pairs have to be the runs of consecutive lost sequence numbers, in order
+        Pairs expectedPairs;
+        for (auto it = expected.begin(); it != expected.end();) {
+            int first = *it;
+            int last = first;
+            while (++it != expected.end() && *it == last + 1) {
+                last = *it;
+            }
+            expectedPairs.emplace_back(at(first), at(last));
+        }
+        QVERIFY(writtenPairs(lossList) == expectedPairs);
+    }
+}
+
+#ifdef MANUAL_TEST
+
+void LossListTests::benchmark() {
+    int numHoles[] = { 1000, 10000, 100000 };
+    std::mt19937 generator(0);
+
+    std::cout << "[numHoles, appendUsec, randomRemoveUsec, insertUsec, popUsec] = [" << std::endl;
+    for (auto n : numHoles) {
+        LossList lossList;
+
+        std::vector<int> holes;
+        for (int i = 0; i < n; ++i) {
+            holes.push_back(2 * i);
+        }
+
+        // every other packet lost
+        uint64_t startTime = usecTimestampNow();
+        for (auto hole : holes) {
+            lossList.append(seq(hole));
+        }
+        uint64_t appendUsec = usecTimestampNow() - startTime;
+
+        // resends arriving out of order
+        std::shuffle(holes.begin(), holes.end(), generator);
+        startTime = usecTimestampNow();
+        for (auto hole : holes) {
+            lossList.remove(seq(hole));
+        }
+        uint64_t randomRemoveUsec = usecTimestampNow() - startTime;
+
+        // NAKs coming back out of order on the sender
+        startTime = usecTimestampNow();
+        for (auto hole : holes) {
+            lossList.insert(seq(hole), seq(hole));
+        }
+        uint64_t insertUsec = usecTimestampNow() - startTime;
+
+        // the send queue resending them all
+        startTime = usecTimestampNow();
+        while (!lossList.isEmpty()) {
+            lossList.popFirstSequenceNumber();
+        }
+        uint64_t popUsec = usecTimestampNow() - startTime;
+
+        std::cout << "    " << n << ", " << appendUsec << ", " << randomRemoveUsec << ", "
+            << insertUsec << ", " << popUsec << std::endl;
+    }
+    std::cout << "];" << std::endl;
+}
+
+#endif // MANUAL_TEST
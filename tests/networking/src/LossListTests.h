@@ -0,0 +1,39 @@
+//
+//  LossListTests.h
+//  tests/networking/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_LossListTests_h
+#define hifi_LossListTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+//#define MANUAL_TEST
+
+class LossListTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test append, insert and remove keep the expected ranges and length
+    void rangesTest();
+
+    // Test ranges spanning the sequence number wrap-around
+    void wrapAroundTest();
+
+    // Test random operations against a set of lost sequence numbers, including the NAK pairs written
+    void randomOperationsTest();
+
+#ifdef MANUAL_TEST
+    // Time worst-case loss patterns: every other packet lost, then recovered in random order
+    void benchmark();
+#endif // MANUAL_TEST
+};
+
+#endif // hifi_LossListTests_h
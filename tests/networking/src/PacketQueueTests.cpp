@@ -0,0 +1,319 @@
+//
+//  PacketQueueTests.cpp
+//  tests/networking/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketQueueTests.h"
+
+#include <iostream>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QThread>
+#include <QtNetwork/QUdpSocket>
+
+#include <SharedUtil.h>
+#include <udt/MPSCQueue.h>
+#include <udt/PacketList.h>
+#include <udt/PacketQueue.h>
+#include <udt/SendQueue.h>
+#include <udt/Socket.h>
+
+QTEST_MAIN(PacketQueueTests)
+
+using namespace udt;
+
+static std::unique_ptr<Packet> createNumberedPacket(quint32 producer, quint32 number) {
+    auto packet = Packet::create();
+    packet->writePrimitive(producer);
+    packet->writePrimitive(number);
+    return packet;
+}
+
+static void readNumberedPacket(Packet& packet, quint32& producer, quint32& number) {
+    packet.seek(0);
+    packet.readPrimitive(&producer);
+    packet.readPrimitive(&number);
+}
+
+void PacketQueueTests::concurrentQueueTest() {
+    const quint32 NUM_PRODUCERS = 4;
+    const quint32 PACKETS_PER_PRODUCER = 5000; // well past the ring capacity, so the overflow gets used too
+
+    PacketQueue queue;
+
+    std::vector<std::thread> producers;
+    for (quint32 producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&queue, producer, PACKETS_PER_PRODUCER] {
+            for (quint32 i = 0; i < PACKETS_PER_PRODUCER; ++i) {
+                queue.queuePacket(createNumberedPacket(producer, i));
+            }
+        });
+    }
+
+    std::vector<quint32> nextNumbers(NUM_PRODUCERS, 0);
+    quint32 numTaken = 0;
+    bool isInOrder = true;
+
+    while (numTaken < NUM_PRODUCERS * PACKETS_PER_PRODUCER) {
+        auto packet = queue.takePacket();
+        if (!packet) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        quint32 producer, number;
+        readNumberedPacket(*packet, producer, number);
+        isInOrder = isInOrder && producer < NUM_PRODUCERS && number == nextNumbers[producer];
+        if (producer < NUM_PRODUCERS) {
+            nextNumbers[producer] = number + 1;
+        }
+        ++numTaken;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    QVERIFY(isInOrder);
+    QVERIFY(queue.isEmpty());
+    QVERIFY(!queue.takePacket());
+}
+
+void PacketQueueTests::multiProducerOrderTest() {
+    const quint32 NUM_PRODUCERS = 8;
+    const quint32 ITEMS_PER_PRODUCER = 50000;
+
+    // a two slot ring keeps producers racing each other between the ring and the overflow
+    MPSCQueue<quint64> queue(2);
+
+    std::vector<std::thread> producers;
+    for (quint32 producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&queue, producer, ITEMS_PER_PRODUCER] {
+            for (quint32 i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                queue.push(((quint64)producer << 32) | i);
+            }
+        });
+    }
+
+    std::vector<quint32> nextNumbers(NUM_PRODUCERS, 0);
+    quint32 numTaken = 0;
+    quint32 numOutOfOrder = 0;
+
+    while (numTaken < NUM_PRODUCERS * ITEMS_PER_PRODUCER) {
+        quint64 item;
+        if (!queue.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        quint32 producer = (quint32)(item >> 32);
+        quint32 number = (quint32)item;
+        if (producer >= NUM_PRODUCERS || number != nextNumbers[producer]) {
+            ++numOutOfOrder;
+        }
+        if (producer < NUM_PRODUCERS) {
+            nextNumbers[producer] = number + 1;
+        }
+        ++numTaken;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    QCOMPARE(numOutOfOrder, (quint32)0);
+    QVERIFY(queue.isEmpty());
+}
+
+void PacketQueueTests::channelRoundRobinTest() {
+    PacketQueue queue;
+
+    for (quint32 list = 1; list <= 2; ++list) {
+        auto packetList = PacketList::create(PacketType::Unknown);
+        for (quint32 i = 0; i < 2; ++i) {
+            packetList->writePrimitive(list);
+            packetList->writePrimitive(i);
+            packetList->closeCurrentPacket();
+        }
+        queue.queuePacketList(std::move(packetList));
+    }
+
+    queue.queuePacket(createNumberedPacket(0, 0));
+    queue.queuePacket(createNumberedPacket(0, 1));
+
+    // main channel first, then one packet from each list, then back around
+    std::vector<std::pair<quint32, quint32>> expected {
+        { 0, 0 }, { 1, 0 }, { 2, 0 }, { 0, 1 }, { 1, 1 }, { 2, 1 }
+    };
+
+    for (auto& expectedPacket : expected) {
+        auto packet = queue.takePacket();
+        QVERIFY(packet);
+
+        quint32 producer, number;
+        readNumberedPacket(*packet, producer, number);
+        QCOMPARE(producer, expectedPacket.first);
+        QCOMPARE(number, expectedPacket.second);
+    }
+
+    QVERIFY(queue.isEmpty());
+}
+
+#ifdef MANUAL_TEST
+
+// the queueing scheme PacketQueue used before it went lock-free, kept here as the baseline
+class LockedPacketQueue {
+public:
+    void queuePacket(std::unique_ptr<Packet> packet) {
+        std::lock_guard<std::recursive_mutex> locker(_packetsLock);
+        _packets.push_back(std::move(packet));
+    }
+
+    std::unique_ptr<Packet> takePacket() {
+        std::lock_guard<std::recursive_mutex> locker(_packetsLock);
+        if (_packets.empty()) {
+            return std::unique_ptr<Packet>();
+        }
+        auto packet = std::move(_packets.front());
+        _packets.pop_front();
+        return packet;
+    }
+
+private:
+    std::recursive_mutex _packetsLock;
+    std::list<std::unique_ptr<Packet>> _packets;
+};
+
+template <typename Queue>
+static uint64_t timeContendedQueue(quint32 numProducers, quint32 packetsPerProducer,
+                                   const std::vector<std::unique_ptr<Packet>>& packets) {
+    Queue queue;
+
+    // packets are created up front so that the timing is only of the queue itself
+    std::vector<std::vector<std::unique_ptr<Packet>>> producerPackets(numProducers);
+    for (quint32 producer = 0; producer < numProducers; ++producer) {
+        for (quint32 i = 0; i < packetsPerProducer; ++i) {
+            producerPackets[producer].push_back(Packet::createCopy(*packets[i]));
+        }
+    }
+
+    uint64_t startTime = usecTimestampNow();
+
+    std::vector<std::thread> producers;
+    for (quint32 producer = 0; producer < numProducers; ++producer) {
+        producers.emplace_back([&queue, &producerPackets, producer] {
+            for (auto& packet : producerPackets[producer]) {
+                queue.queuePacket(std::move(packet));
+            }
+        });
+    }
+
+    std::vector<std::unique_ptr<Packet>> taken;
+    taken.reserve(numProducers * packetsPerProducer);
+    while (taken.size() < numProducers * packetsPerProducer) {
+        auto packet = queue.takePacket();
+        if (packet) {
+            taken.push_back(std::move(packet));
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    return usecTimestampNow() - startTime;
+}
+
+void PacketQueueTests::benchmark() {
+    const quint32 PACKETS_PER_PRODUCER = 100000;
+    quint32 numProducers[] = { 1, 2, 4, 8 };
+
+    std::vector<std::unique_ptr<Packet>> packets;
+    for (quint32 i = 0; i < PACKETS_PER_PRODUCER; ++i) {
+        packets.push_back(createNumberedPacket(0, i));
+    }
+
+    std::cout << "[numProducers, lockedUsec, lockFreeUsec] = [" << std::endl;
+    for (auto n : numProducers) {
+        uint64_t lockedUsec = timeContendedQueue<LockedPacketQueue>(n, PACKETS_PER_PRODUCER, packets);
+        uint64_t lockFreeUsec = timeContendedQueue<PacketQueue>(n, PACKETS_PER_PRODUCER, packets);
+        std::cout << "    " << n << ", " << lockedUsec << ", " << lockFreeUsec << std::endl;
+    }
+    std::cout << "];" << std::endl;
+}
+
+static uint64_t timeSendQueue(udt::Socket& socket, const HifiSockAddr& destination, quint32 numProducers,
+                              quint32 packetsPerProducer) {
+    // a running send thread with nothing holding it back, so producers race it the way they do in a busy connection
+    auto sendQueue = SendQueue::create(&socket, destination, SequenceNumber(), 0, true);
+    sendQueue->setPacketSendPeriod(0);
+    sendQueue->setFlowWindowSize(std::numeric_limits<int>::max());
+
+    // small packets, created up front, since the send queue keeps every packet it sends until it is ACKed
+    std::vector<std::vector<std::unique_ptr<Packet>>> producerPackets(numProducers);
+    for (quint32 producer = 0; producer < numProducers; ++producer) {
+        for (quint32 i = 0; i < packetsPerProducer; ++i) {
+            auto packet = Packet::create(sizeof(quint32) * 2);
+            packet->writePrimitive(producer);
+            packet->writePrimitive(i);
+            producerPackets[producer].push_back(std::move(packet));
+        }
+    }
+
+    uint64_t startTime = usecTimestampNow();
+
+    std::vector<std::thread> producers;
+    for (quint32 producer = 0; producer < numProducers; ++producer) {
+        producers.emplace_back([&sendQueue, &producerPackets, producer] {
+            for (auto& packet : producerPackets[producer]) {
+                sendQueue->queuePacket(std::move(packet));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    uint64_t usecs = usecTimestampNow() - startTime;
+
+    // tear down the way Connection does
+    QThread* sendQueueThread = sendQueue->thread();
+    sendQueue->stop();
+    sendQueue.release()->deleteLater();
+    sendQueueThread->quit();
+    sendQueueThread->wait();
+
+    return usecs;
+}
+
+void PacketQueueTests::sendQueueBenchmark() {
+    const quint32 PACKETS_PER_PRODUCER = 100000;
+    quint32 numProducers[] = { 1, 2, 4, 8 };
+
+    // the packets go to a socket that is never read
+    QUdpSocket sink;
+    QVERIFY(sink.bind(QHostAddress::LocalHost, 0));
+    HifiSockAddr destination(QHostAddress::LocalHost, sink.localPort());
+
+    udt::Socket socket;
+    socket.bind(QHostAddress::LocalHost, 0);
+
+    std::cout << "[numProducers, usecs, nsecsPerPacket] = [" << std::endl;
+    for (auto n : numProducers) {
+        uint64_t usecs = timeSendQueue(socket, destination, n, PACKETS_PER_PRODUCER);
+        std::cout << "    " << n << ", " << usecs << ", " << (usecs * 1000) / (n * PACKETS_PER_PRODUCER) << std::endl;
+    }
+    std::cout << "];" << std::endl;
+}
+
+#endif // MANUAL_TEST
@@ -0,0 +1,42 @@
+//
+//  PacketQueueTests.h
+//  tests/networking/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketQueueTests_h
+#define hifi_PacketQueueTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+//#define MANUAL_TEST
+
+class PacketQueueTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test packets from each producer come out in the order they went in, including past the ring capacity
+    void concurrentQueueTest();
+
+    // Test items from each producer come out of a tiny ring in order while other producers spill into the overflow
+    void multiProducerOrderTest();
+
+    // Test packet lists are taken round-robin with the main channel
+    void channelRoundRobinTest();
+
+#ifdef MANUAL_TEST
+    // Compare enqueue/dequeue throughput under contention with a std::list + recursive_mutex queue
+    void benchmark();
+
+    // Time queueing through SendQueue::queuePacket, the wake-up handshake included, with the send thread running
+    void sendQueueBenchmark();
+#endif // MANUAL_TEST
+};
+
+#endif // hifi_PacketQueueTests_h
@@ -180,3 +180,34 @@ void PacketTests::primitiveTest() {
     QCOMPARE(recvPacket->peekPrimitive(&noValue), 0);
     QCOMPARE(recvPacket->readPrimitive(&noValue), 0);
 }
+
+void PacketTests::pooledBufferTest() {
+    auto pool = udt::PacketBufferPool::create(udt::MAX_PACKET_SIZE, 1);
+    QCOMPARE(pool->getNumIdleBuffers(), 0);
+
+    auto sentPacket = NLPacket::create(PacketType::Unknown);
+    sentPacket->write("somedata");
+    auto size = sentPacket->getDataSize();
+
+    {
+        auto buffer = pool->acquire();
+        memcpy(buffer.get(), sentPacket->getData(), size);
+        auto receivedPacket = NLPacket::fromReceivedPacket(std::move(buffer), size, HifiSockAddr());
+
+        QCOMPARE(receivedPacket->getType(), PacketType::Unknown);
+        COMPARE_DATA(receivedPacket->getPayload(), "somedata", 8);
+        QCOMPARE(pool->getNumIdleBuffers(), 0);
+    }
+
+    // the packet is gone, its buffer should be back in the pool
+    QCOMPARE(pool->getNumIdleBuffers(), 1);
+
+    {
+        auto first = pool->acquire();
+        auto second = pool->acquire();
+        QCOMPARE(pool->getNumIdleBuffers(), 0);
+    }
+
+    // the pool only holds on to as many idle buffers as it was asked to
+    QCOMPARE(pool->getNumIdleBuffers(), 1);
+}
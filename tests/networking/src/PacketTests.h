@@ -36,6 +36,9 @@ private slots:
 
     // Test set/get packet type
     void packetTypeTest();
+
+    // Test packets built on pooled buffers hand them back on destruction
+    void pooledBufferTest();
 };
 
 #endif // hifi_PacketTests_h
@@ -0,0 +1,72 @@
+//
+//  BinaryPersistTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BinaryPersistTests.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <OctreeBinaryFormat.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(BinaryPersistTests)
+
+void BinaryPersistTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void BinaryPersistTests::readsBackWrittenTree() {
+    EntityTreePointer tree = makeServerEntityTree();
+
+    const int NUM_ENTITIES = 10;
+    QVector<EntityItemID> entityIDs;
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        EntityItemProperties properties;
+        properties.setType(EntityTypes::Box);
+        properties.setName(QString("box %1").arg(i));
+        properties.setPosition(glm::vec3((float)i, 1.0f, -(float)i));
+        properties.setUserData(QString("{ \"index\": %1 }").arg(i));
+        EntityItemID entityID(QUuid::createUuid());
+        QVERIFY((bool)tree->addEntity(entityID, properties));
+        entityIDs.push_back(entityID);
+    }
+    QUuid persistID = QUuid::createUuid();
+    tree->setOctreeVersionInfo(persistID, 42);
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    QString fileName = directory.filePath("models.bin");
+    QVERIFY(tree->writeToFile(fileName.toLocal8Bit().constData(), nullptr, "bin"));
+    QVERIFY(OctreeBinaryFormat::isBinaryFile(fileName));
+
+    EntityTreePointer loadedTree = makeServerEntityTree();
+    QVERIFY(loadedTree->readFromFile(fileName.toLocal8Bit().constData()));
+    QCOMPARE(loadedTree->getPersistID(), persistID);
+    QCOMPARE(loadedTree->getPersistDataVersion(), 42);
+
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        auto entity = loadedTree->findEntityByEntityItemID(entityIDs[i]);
+        QVERIFY((bool)entity);
+        QCOMPARE(entity->getName(), QString("box %1").arg(i));
+        QCOMPARE(entity->getWorldPosition(), glm::vec3((float)i, 1.0f, -(float)i));
+        QCOMPARE(entity->getUserData(), QString("{ \"index\": %1 }").arg(i));
+    }
+
+    // a truncated file is rejected rather than partially loaded
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.resize(file.size() - sizeof(uint32_t)));
+    file.close();
+
+    EntityTreePointer truncatedTree = makeServerEntityTree();
+    QVERIFY(!truncatedTree->readFromFile(fileName.toLocal8Bit().constData()));
+}
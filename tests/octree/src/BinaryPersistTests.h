@@ -0,0 +1,27 @@
+//
+//  BinaryPersistTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BinaryPersistTests_h
+#define hifi_BinaryPersistTests_h
+
+#include <QtTest/QtTest>
+
+class BinaryPersistTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test an entity tree written in the binary format reads back the same, and a truncated file is rejected
+    void readsBackWrittenTree();
+};
+
+#endif // hifi_BinaryPersistTests_h
@@ -0,0 +1,86 @@
+//
+//  EncodeCacheTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EncodeCacheTests.h"
+
+#include <EntityItem.h>
+#include <EntityTreeElement.h>
+#include <OctreePacketData.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(EncodeCacheTests)
+
+void EncodeCacheTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void EncodeCacheTests::reusesEncodeForSameEdit() {
+    EntityTreePointer tree = makeServerEntityTree();
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setName("cached");
+    properties.setPrivateUserData("private");
+    EntityItemID entityID(QUuid::createUuid());
+    EntityItemPointer entity = tree->addEntity(entityID, properties);
+    QVERIFY((bool)entity);
+
+    const int PACKET_SIZE = 16 * 1024;
+    EncodeBitstreamParams params;
+    params.useEncodeCache = true;
+    auto encode = [&](bool withPrivateUserData) {
+        OctreePacketData packetData(false, PACKET_SIZE);
+        EntityTreeElementExtraEncodeDataPointer extraEncodeData(new EntityTreeElementExtraEncodeData());
+        auto appendState = entity->appendEntityData(&packetData, params, extraEncodeData, withPrivateUserData);
+        if (appendState != OctreeElement::COMPLETED) {
+            return QByteArray();
+        }
+        return QByteArray((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+    };
+
+    quint64 hits = EntityItem::getNumEncodeCacheHits();
+    quint64 misses = EntityItem::getNumEncodeCacheMisses();
+    QByteArray first = encode(false);
+    QVERIFY(!first.isEmpty());
+    QCOMPARE(EntityItem::getNumEncodeCacheMisses(), misses + 1);
+
+    QCOMPARE(encode(false), first);
+    QCOMPARE(EntityItem::getNumEncodeCacheHits(), hits + 1);
+
+    // viewers who can see private user data get their own encode
+    QByteArray withPrivateUserData = encode(true);
+    QVERIFY(withPrivateUserData != first);
+    QCOMPARE(EntityItem::getNumEncodeCacheMisses(), misses + 2);
+    QCOMPARE(encode(true), withPrivateUserData);
+    QCOMPARE(encode(false), first);
+    QCOMPARE(EntityItem::getNumEncodeCacheHits(), hits + 3);
+
+    // an edit makes a new encode
+    EntityItemProperties editProperties;
+    editProperties.setName("edited");
+    QVERIFY(tree->updateEntity(entityID, editProperties));
+    QByteArray edited = encode(false);
+    QVERIFY(edited != first);
+    QCOMPARE(EntityItem::getNumEncodeCacheMisses(), misses + 3);
+
+    // so does the server moving the entity's query cube, which isn't an edit
+    AACube queryAACube = entity->getQueryAACube();
+    entity->setQueryAACube(AACube(queryAACube.getCorner() + glm::vec3(1.0f), queryAACube.getScale()));
+    QByteArray moved = encode(false);
+    QVERIFY(moved != edited);
+    QCOMPARE(EntityItem::getNumEncodeCacheMisses(), misses + 4);
+    QCOMPARE(encode(false), moved);
+
+    // and an encode without the cache matches the cached one
+    params.useEncodeCache = false;
+    QCOMPARE(encode(false), moved);
+    QCOMPARE(EntityItem::getNumEncodeCacheMisses(), misses + 4);
+}
@@ -0,0 +1,27 @@
+//
+//  EncodeCacheTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EncodeCacheTests_h
+#define hifi_EncodeCacheTests_h
+
+#include <QtTest/QtTest>
+
+class EncodeCacheTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test an entity's cached encode is reused for the same edit, and only for that
+    void reusesEncodeForSameEdit();
+};
+
+#endif // hifi_EncodeCacheTests_h
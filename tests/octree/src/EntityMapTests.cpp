@@ -0,0 +1,225 @@
+//
+//  EntityMapTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityMapTests.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#include <QReadWriteLock>
+
+#include <EntityItemMap.h>
+#include <SharedUtil.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(EntityMapTests)
+
+void EntityMapTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void EntityMapTests::findsEntitiesWhileEditing() {
+    EntityTreePointer tree = makeServerEntityTree();
+    std::mt19937 generator(0);
+
+    const int NUM_ENTITIES = 2000;
+    std::vector<EntityItemID> stableIDs;
+    std::vector<EntityItemID> changingIDs;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        stableIDs.push_back(addRandomBox(tree, generator));
+        changingIDs.push_back(addRandomBox(tree, generator));
+    }
+
+    // the stable entities must always be found, and any changing one that's found must be the one asked for
+    std::atomic<bool> done { false };
+    std::atomic<int> numMissing { 0 };
+    std::atomic<int> numWrong { 0 };
+    auto lookUp = [&](int seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<size_t> pick(0, NUM_ENTITIES - 1);
+        while (!done) {
+            auto& stableID = stableIDs[pick(generator)];
+            auto entity = tree->findEntityByEntityItemID(stableID);
+            if (!entity) {
+                ++numMissing;
+            } else if (entity->getEntityItemID() != stableID) {
+                ++numWrong;
+            }
+            auto& changingID = changingIDs[pick(generator)];
+            entity = tree->findEntityByEntityItemID(changingID);
+            if (entity && entity->getEntityItemID() != changingID) {
+                ++numWrong;
+            }
+        }
+    };
+    const int NUM_READERS = 4;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        readers.emplace_back(lookUp, i + 1);
+    }
+
+    // the changing IDs stay the same, so the entities are deleted and added back under them
+    std::uniform_int_distribution<size_t> pick(0, NUM_ENTITIES - 1);
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        auto& changingID = changingIDs[pick(generator)];
+        tree->withWriteLock([&] {
+            auto entity = tree->findEntityByEntityItemID(changingID);
+            if (entity) {
+                tree->deleteEntity(changingID, true);
+            } else {
+                EntityItemProperties properties;
+                properties.setType(EntityTypes::Box);
+                tree->addEntity(changingID, properties);
+            }
+        });
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    QCOMPARE((int)numMissing, 0);
+    QCOMPARE((int)numWrong, 0);
+
+    for (const auto& stableID : stableIDs) {
+        QVERIFY(tree->findEntityByEntityItemID(stableID));
+    }
+    tree->eraseAllOctreeElements();
+    for (const auto& stableID : stableIDs) {
+        QVERIFY(!tree->findEntityByEntityItemID(stableID));
+    }
+}
+
+void EntityMapTests::leavesOutTakenIDs() {
+    EntityTreePointer tree = makeServerEntityTree();
+
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    EntityItemID existingID(QUuid::createUuid());
+    EntityItemPointer existing = tree->addEntity(existingID, properties);
+    QVERIFY((bool)existing);
+
+    // only the first entity with a free ID is added
+    EntityItemID newID(QUuid::createUuid());
+    std::vector<EntityItemPointer> newEntities {
+        tree->constructEntity(newID, properties),
+        tree->constructEntity(existingID, properties),
+        tree->constructEntity(newID, properties)
+    };
+    std::vector<EntityItemPointer> addedEntities;
+    tree->withWriteLock([&] {
+        addedEntities = tree->addEntities(newEntities);
+    });
+    QCOMPARE((int)addedEntities.size(), 1);
+    QCOMPARE(addedEntities[0], newEntities[0]);
+
+    QCOMPARE(tree->findEntityByEntityItemID(existingID), existing);
+    QCOMPARE(tree->findEntityByEntityItemID(newID), newEntities[0]);
+    QVERIFY((bool)newEntities[0]->getElement());
+    QVERIFY(!newEntities[1]->getElement());
+    QVERIFY(!newEntities[2]->getElement());
+}
+
+#ifdef MANUAL_TEST
+
+namespace {
+    // how the entity tree kept its entities by ID before EntityItemMap
+    class LockedEntityMap {
+    public:
+        EntityItemPointer value(const EntityItemID& id) const {
+            QReadLocker locker(&_lock);
+            return _entities.value(id);
+        }
+        void insert(const EntityItemPointer& entity) {
+            QWriteLocker locker(&_lock);
+            _entities.insert(entity->getEntityItemID(), entity);
+        }
+        void remove(const EntityItemID& id) {
+            QWriteLocker locker(&_lock);
+            _entities.remove(id);
+        }
+
+    private:
+        mutable QReadWriteLock _lock;
+        QHash<EntityItemID, EntityItemPointer> _entities;
+    };
+
+    // returns the lookups per second made by each reader, and the edits per second made meanwhile
+    template <typename Map>
+    std::pair<float, float> timeEntityMap(Map& map, const std::vector<EntityItemPointer>& entities, int numReaders) {
+        const uint64_t DURATION_USECS = USECS_PER_SECOND;
+        std::atomic<bool> done { false };
+        std::atomic<uint64_t> numLookups { 0 };
+        auto lookUp = [&](int seed) {
+            std::mt19937 generator(seed);
+            std::uniform_int_distribution<size_t> pick(0, entities.size() - 1);
+            uint64_t lookups = 0;
+            while (!done) {
+                map.value(entities[pick(generator)]->getEntityItemID());
+                ++lookups;
+            }
+            numLookups += lookups;
+        };
+        std::vector<std::thread> readers;
+        for (int i = 0; i < numReaders; ++i) {
+            readers.emplace_back(lookUp, i + 1);
+        }
+
+        // the edit stream deletes an entity and adds it back
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<size_t> pick(0, entities.size() - 1);
+        uint64_t numEdits = 0;
+        uint64_t startTime = usecTimestampNow();
+        while (usecTimestampNow() - startTime < DURATION_USECS) {
+            const auto& entity = entities[pick(generator)];
+            map.remove(entity->getEntityItemID());
+            map.insert(entity);
+            ++numEdits;
+        }
+        done = true;
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        float seconds = (float)(usecTimestampNow() - startTime) / USECS_PER_SECOND;
+        return { (float)numLookups / (numReaders * seconds), (float)numEdits / seconds };
+    }
+}
+
+void EntityMapTests::lookUpBenchmark() {
+    EntityTreePointer tree = makeServerEntityTree();
+    std::mt19937 generator(0);
+    const int NUM_ENTITIES = 100000;
+    std::vector<EntityItemPointer> entities;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        entities.push_back(tree->findEntityByEntityItemID(addRandomBox(tree, generator)));
+    }
+
+    EntityItemMap entityMap;
+    LockedEntityMap lockedMap;
+    for (const auto& entity : entities) {
+        entityMap.insert(entity);
+        lockedMap.insert(entity);
+    }
+
+    int numReaders[] = { 1, 2, 4, 8, 16 };
+    std::cout << "[numReaders, mapLookupsPerSecPerReader, mapEditsPerSec, lockedLookupsPerSecPerReader, lockedEditsPerSec] = ["
+        << std::endl;
+    for (auto n : numReaders) {
+        auto mapRates = timeEntityMap(entityMap, entities, n);
+        auto lockedRates = timeEntityMap(lockedMap, entities, n);
+        std::cout << "    " << n << ", " << mapRates.first << ", " << mapRates.second << ", " << lockedRates.first << ", "
+            << lockedRates.second << std::endl;
+    }
+    std::cout << "];" << std::endl;
+}
+
+#endif // MANUAL_TEST
@@ -0,0 +1,38 @@
+//
+//  EntityMapTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityMapTests_h
+#define hifi_EntityMapTests_h
+
+#include <QtTest/QtTest>
+
+//#define MANUAL_TEST
+
+class EntityMapTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test entity lookups made while entities are added and deleted on another thread
+    void findsEntitiesWhileEditing();
+
+    // Test that a batch of new entities leaves out those whose IDs are taken
+    void leavesOutTakenIDs();
+
+#ifdef MANUAL_TEST
+    // Time entity lookups from growing numbers of threads while another thread adds and deletes entities, against a
+    // hash guarded by a read-write lock
+    void lookUpBenchmark();
+#endif // MANUAL_TEST
+};
+
+#endif // hifi_EntityMapTests_h
@@ -0,0 +1,56 @@
+//
+//  EntityTreeTestUtils.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityTreeTestUtils_h
+#define hifi_EntityTreeTestUtils_h
+
+#include <random>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <EntityTree.h>
+#include <NodeList.h>
+
+// entities are only constructed when there's a NodeList, call this from a test class's initTestCase
+inline void setUpEntityTreeDependencies() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+}
+
+// a server tree doesn't need permission to add entities, and deletes domain entities itself rather than asking the
+// entity server to
+inline EntityTreePointer makeServerEntityTree() {
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    tree->setIsServer(true);
+    return tree;
+}
+
+static const PickFilter PICK_ALL_ENTITIES { PickFilter::Flags().set() };
+
+static const float RANDOM_BOX_WORLD_SIZE = 1000.0f;
+
+// adds a box of random size somewhere in a RANDOM_BOX_WORLD_SIZE cube about the origin
+inline EntityItemID addRandomBox(const EntityTreePointer& tree, std::mt19937& generator) {
+    std::uniform_real_distribution<float> position(-RANDOM_BOX_WORLD_SIZE / 2.0f, RANDOM_BOX_WORLD_SIZE / 2.0f);
+    std::uniform_real_distribution<float> size(0.1f, 10.0f);
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setPosition(glm::vec3(position(generator), position(generator), position(generator)));
+    properties.setDimensions(glm::vec3(size(generator), size(generator), size(generator)));
+    EntityItemID entityID(QUuid::createUuid());
+    tree->addEntity(entityID, properties);
+    return entityID;
+}
+
+#endif // hifi_EntityTreeTestUtils_h
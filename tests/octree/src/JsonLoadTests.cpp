@@ -0,0 +1,69 @@
+//
+//  JsonLoadTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JsonLoadTests.h"
+
+#include <QTemporaryDir>
+
+#include <EntityTreeElement.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(JsonLoadTests)
+
+void JsonLoadTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void JsonLoadTests::matchesAddingOneAtATime() {
+    EntityTreePointer tree = makeServerEntityTree();
+
+    // enough entities to be split over threads, some small and some spanning large parts of the tree
+    const int NUM_ENTITIES = 2000;
+    QVector<EntityItemID> entityIDs;
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        EntityItemProperties properties;
+        properties.setType(EntityTypes::Box);
+        properties.setName(QString("box %1").arg(i));
+        properties.setPosition(glm::vec3((float)(i % 100) * 10.0f, (float)(i / 100), -(float)i));
+        properties.setDimensions(glm::vec3(i % 10 == 0 ? 1000.0f : 1.0f));
+        if (i > 0 && i % 7 == 0) {
+            properties.setParentID(entityIDs[i - 1]);
+        }
+        EntityItemID entityID(QUuid::createUuid());
+        QVERIFY((bool)tree->addEntity(entityID, properties));
+        entityIDs.push_back(entityID);
+    }
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    QString fileName = directory.filePath("models.json.gz");
+    QVERIFY(tree->writeToFile(fileName.toLocal8Bit().constData(), nullptr, "json.gz"));
+
+    EntityTreePointer loadedTree = makeServerEntityTree();
+    QVERIFY(loadedTree->readFromFile(fileName.toLocal8Bit().constData()));
+    QCOMPARE((int)loadedTree->getSpatialIndex().getNumEntities(), NUM_ENTITIES);
+
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        auto entity = tree->findEntityByEntityItemID(entityIDs[i]);
+        auto loadedEntity = loadedTree->findEntityByEntityItemID(entityIDs[i]);
+        QVERIFY((bool)loadedEntity);
+        QCOMPARE(loadedEntity->getName(), entity->getName());
+        QCOMPARE(loadedEntity->getParentID(), entity->getParentID());
+        QCOMPARE(loadedEntity->getWorldPosition(), entity->getWorldPosition());
+        QVERIFY((bool)loadedEntity->getElement());
+        QCOMPARE(loadedEntity->getElement()->getAACube(), entity->getElement()->getAACube());
+    }
+
+    // entities already in the tree aren't added again
+    QVERIFY(!loadedTree->readFromFile(fileName.toLocal8Bit().constData()));
+    QCOMPARE((int)loadedTree->getSpatialIndex().getNumEntities(), NUM_ENTITIES);
+}
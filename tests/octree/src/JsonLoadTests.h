@@ -0,0 +1,27 @@
+//
+//  JsonLoadTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_JsonLoadTests_h
+#define hifi_JsonLoadTests_h
+
+#include <QtTest/QtTest>
+
+class JsonLoadTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test a JSON load, which converts entities in parallel and adds them in one pass, matches adding them one at a time
+    void matchesAddingOneAtATime();
+};
+
+#endif // hifi_JsonLoadTests_h
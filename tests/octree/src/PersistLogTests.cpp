@@ -0,0 +1,86 @@
+//
+//  PersistLogTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PersistLogTests.h"
+
+#include <QTemporaryDir>
+
+#include <OctreeBinaryFormat.h>
+#include <OctreePersistLog.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(PersistLogTests)
+
+void PersistLogTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void PersistLogTests::replaysChangesOnSnapshot() {
+    EntityTreePointer tree = makeServerEntityTree();
+
+    auto addBox = [](const EntityTreePointer& tree, const QString& name) {
+        EntityItemProperties properties;
+        properties.setType(EntityTypes::Box);
+        properties.setName(name);
+        EntityItemID entityID(QUuid::createUuid());
+        tree->addEntity(entityID, properties);
+        return entityID;
+    };
+
+    EntityItemID keptID = addBox(tree, "kept");
+    EntityItemID editedID = addBox(tree, "edited");
+    EntityItemID deletedID = addBox(tree, "deleted");
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    QString fileName = directory.filePath("models.bin");
+    QVERIFY(tree->writeToFile(fileName.toLocal8Bit().constData(), nullptr, "bin"));
+
+    OctreeBinaryFormat::Header header;
+    header.packetType = tree->expectedDataPacketType();
+    header.packetVersion = tree->expectedVersion();
+    header.dataVersion = tree->getPersistDataVersion();
+    header.id = tree->getPersistID();
+    OctreePersistLog log(directory.filePath("models.log"));
+    QVERIFY(log.reset(header));
+    QVERIFY(log.isEmpty());
+
+    // changes after the snapshot, over two batches
+    tree->setTrackPersistChanges(true);
+    EntityItemProperties properties;
+    properties.setName("was edited");
+    QVERIFY(tree->updateEntity(editedID, properties));
+    EntityItemID addedID = addBox(tree, "added");
+    QVERIFY(tree->writeToPersistLog(log));
+    QVERIFY(!log.isEmpty());
+
+    tree->deleteEntity(deletedID, true);
+    EntityItemID addedAndDeletedID = addBox(tree, "added and deleted");
+    tree->deleteEntity(addedAndDeletedID, true);
+    QVERIFY(tree->writeToPersistLog(log));
+
+    EntityTreePointer loadedTree = makeServerEntityTree();
+    QVERIFY(loadedTree->readFromFile(fileName.toLocal8Bit().constData()));
+    QVERIFY((bool)loadedTree->findEntityByEntityItemID(deletedID));
+    QVERIFY(loadedTree->readFromPersistLogFile(log.getFileName()));
+
+    QCOMPARE(loadedTree->findEntityByEntityItemID(keptID)->getName(), QString("kept"));
+    QCOMPARE(loadedTree->findEntityByEntityItemID(editedID)->getName(), QString("was edited"));
+    QCOMPARE(loadedTree->findEntityByEntityItemID(addedID)->getName(), QString("added"));
+    QVERIFY(!loadedTree->findEntityByEntityItemID(deletedID));
+    QVERIFY(!loadedTree->findEntityByEntityItemID(addedAndDeletedID));
+
+    // a log that doesn't follow on from what's loaded isn't replayed
+    EntityTreePointer otherTree = makeServerEntityTree();
+    QVERIFY(!otherTree->readFromPersistLogFile(log.getFileName()));
+    QVERIFY(!otherTree->findEntityByEntityItemID(addedID));
+}
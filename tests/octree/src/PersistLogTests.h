@@ -0,0 +1,27 @@
+//
+//  PersistLogTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PersistLogTests_h
+#define hifi_PersistLogTests_h
+
+#include <QtTest/QtTest>
+
+class PersistLogTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test replaying the changes logged after a snapshot on top of it, and only on top of that snapshot
+    void replaysChangesOnSnapshot();
+};
+
+#endif // hifi_PersistLogTests_h
@@ -0,0 +1,225 @@
+//
+//  RayIntersectionTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "RayIntersectionTests.h"
+
+#include <iostream>
+
+#include <QFile>
+#include <QProcessEnvironment>
+#include <QTextStream>
+
+#include <EntityTreeElement.h>
+#include <GLMHelpers.h>
+#include <SharedUtil.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(RayIntersectionTests)
+
+void RayIntersectionTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void RayIntersectionTests::findsNearestHit() {
+    EntityTreePointer tree = makeServerEntityTree();
+    std::mt19937 generator(0);
+
+    const int NUM_ENTITIES = 2000;
+    std::vector<EntityItemPointer> entities;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        entities.push_back(tree->findEntityByEntityItemID(addRandomBox(tree, generator)));
+    }
+
+    std::uniform_real_distribution<float> position(-RANDOM_BOX_WORLD_SIZE / 2.0f, RANDOM_BOX_WORLD_SIZE / 2.0f);
+    QVector<PickRay> rays;
+    const int NUM_RAYS = 200;
+    for (int i = 0; i < NUM_RAYS; ++i) {
+        glm::vec3 origin(position(generator), position(generator), position(generator));
+        glm::vec3 target(position(generator), position(generator), position(generator));
+        rays.push_back(PickRay(origin, glm::normalize(target - origin)));
+    }
+    // along the axes, where the slab test has to cope with zero direction components
+    rays.push_back(PickRay(glm::vec3(0.0f), Vectors::UNIT_X));
+    rays.push_back(PickRay(glm::vec3(0.0f), -Vectors::UNIT_Y));
+    rays.push_back(PickRay(glm::vec3(0.0f), Vectors::UNIT_Z));
+
+    QVector<EntityTree::RayIntersection> intersections;
+    tree->evalRayIntersections(rays, QVector<EntityItemID>(), QVector<EntityItemID>(), PICK_ALL_ENTITIES, intersections,
+        Octree::Lock);
+    QCOMPARE(intersections.size(), rays.size());
+
+    int numHits = 0;
+    for (int i = 0; i < rays.size(); ++i) {
+        // the nearest hit of all the entities
+        OctreeElementPointer element;
+        float distance = FLT_MAX;
+        BoxFace face;
+        glm::vec3 surfaceNormal;
+        QVariantMap extraInfo;
+        EntityItemID expectedID;
+        for (const auto& entity : entities) {
+            if (EntityTreeElement::evalEntityRayIntersection(entity, rays[i].origin, rays[i].direction, element, distance,
+                    face, surfaceNormal, QVector<EntityItemID>(), QVector<EntityItemID>(), PICK_ALL_ENTITIES, extraInfo)) {
+                expectedID = entity->getEntityItemID();
+            }
+        }
+
+        QCOMPARE(intersections[i].entityID, expectedID);
+        if (!expectedID.isNull()) {
+            ++numHits;
+            QCOMPARE(intersections[i].distance, distance);
+
+            float singleDistance;
+            EntityItemID singleID = tree->evalRayIntersection(rays[i].origin, rays[i].direction, QVector<EntityItemID>(),
+                QVector<EntityItemID>(), PICK_ALL_ENTITIES, element, singleDistance, face, surfaceNormal, extraInfo,
+                Octree::Lock);
+            QCOMPARE(singleID, expectedID);
+
+            // with the entity hit discarded the ray goes on to something further away, if anything
+            singleID = tree->evalRayIntersection(rays[i].origin, rays[i].direction, QVector<EntityItemID>(),
+                QVector<EntityItemID>({ expectedID }), PICK_ALL_ENTITIES, element, singleDistance, face, surfaceNormal,
+                extraInfo, Octree::Lock);
+            QVERIFY(singleID != expectedID);
+            QVERIFY(singleID.isNull() || singleDistance >= distance);
+        }
+    }
+    QVERIFY(numHits > 0);
+}
+
+#ifdef MANUAL_TEST
+
+namespace {
+    class RayWalkArgs {
+    public:
+        glm::vec3 origin;
+        glm::vec3 direction;
+        glm::vec3 invDirection;
+        OctreeElementPointer element;
+        float distance { FLT_MAX };
+        BoxFace face;
+        glm::vec3 surfaceNormal;
+        QVariantMap extraInfo;
+        EntityItemID entityID;
+    };
+
+    // how the entity tree answered ray picks before it had a spatial index
+    bool rayWalkOperation(const OctreeElementPointer& element, void* extraData) {
+        RayWalkArgs* args = static_cast<RayWalkArgs*>(extraData);
+        auto entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+        EntityItemID entityID = entityTreeElement->evalRayIntersection(args->origin, args->direction, args->element,
+            args->distance, args->face, args->surfaceNormal, QVector<EntityItemID>(), QVector<EntityItemID>(),
+            PICK_ALL_ENTITIES, args->extraInfo);
+        if (!entityID.isNull()) {
+            args->entityID = entityID;
+            return false;
+        }
+        return true;
+    }
+
+    float rayWalkSortingOperation(const OctreeElementPointer& element, void* extraData) {
+        RayWalkArgs* args = static_cast<RayWalkArgs*>(extraData);
+        if (element->getAACube().contains(args->origin)) {
+            return 0.0f;
+        }
+        float boundDistance = FLT_MAX;
+        BoxFace face;
+        glm::vec3 surfaceNormal;
+        if (element->getAACube().findRayIntersection(args->origin, args->direction, args->invDirection, boundDistance,
+                face, surfaceNormal) && boundDistance < args->distance) {
+            return boundDistance;
+        }
+        return FLT_MAX;
+    }
+
+    EntityItemID walkRayIntersection(const EntityTreePointer& tree, const glm::vec3& origin, const glm::vec3& direction) {
+        RayWalkArgs args;
+        args.origin = origin;
+        args.direction = direction;
+        args.invDirection = glm::vec3(direction.x == 0.0f ? 0.0f : 1.0f / direction.x,
+                                      direction.y == 0.0f ? 0.0f : 1.0f / direction.y,
+                                      direction.z == 0.0f ? 0.0f : 1.0f / direction.z);
+        tree->recurseTreeWithOperationSorted(rayWalkOperation, rayWalkSortingOperation, &args);
+        return args.entityID;
+    }
+}
+
+void RayIntersectionTests::pickStreamBenchmark() {
+    EntityTreePointer tree = makeServerEntityTree();
+    std::mt19937 generator(0);
+    const int NUM_ENTITIES = 100000;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        addRandomBox(tree, generator);
+    }
+
+    QVector<PickRay> rays;
+    QString streamFileName = QProcessEnvironment::systemEnvironment().value("HIFI_PICK_STREAM");
+    if (!streamFileName.isEmpty()) {
+        QFile streamFile(streamFileName);
+        QVERIFY(streamFile.open(QIODevice::ReadOnly | QIODevice::Text));
+        QTextStream stream(&streamFile);
+        while (!stream.atEnd()) {
+            QStringList values = stream.readLine().split(' ', QString::SkipEmptyParts);
+            if (values.size() == 6) {
+                glm::vec3 origin(values[0].toFloat(), values[1].toFloat(), values[2].toFloat());
+                glm::vec3 direction(values[3].toFloat(), values[4].toFloat(), values[5].toFloat());
+                rays.push_back(PickRay(origin, glm::normalize(direction)));
+            }
+        }
+    } else {
+        // two hand lasers and a teleport arc's first segment, sweeping across the scene at 90Hz for ten seconds
+        const int NUM_FRAMES = 900;
+        const float SWEEP_RADIANS_PER_FRAME = 0.01f;
+        for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+            float angle = frame * SWEEP_RADIANS_PER_FRAME;
+            glm::vec3 forward(glm::sin(angle), -0.1f, glm::cos(angle));
+            rays.push_back(PickRay(glm::vec3(-0.2f, 1.5f, 0.0f), glm::normalize(forward + glm::vec3(0.05f, 0.0f, 0.0f))));
+            rays.push_back(PickRay(glm::vec3(0.2f, 1.5f, 0.0f), glm::normalize(forward - glm::vec3(0.05f, 0.0f, 0.0f))));
+            rays.push_back(PickRay(glm::vec3(0.2f, 1.5f, 0.0f), glm::normalize(forward + glm::vec3(0.0f, 0.5f, 0.0f))));
+        }
+    }
+    QVERIFY(!rays.isEmpty());
+
+    // the first pick builds the index
+    QVector<EntityTree::RayIntersection> intersections;
+    tree->evalRayIntersections(rays.mid(0, 1), QVector<EntityItemID>(), QVector<EntityItemID>(), PICK_ALL_ENTITIES,
+        intersections, Octree::Lock);
+
+    uint64_t startTime = usecTimestampNow();
+    for (const auto& ray : rays) {
+        OctreeElementPointer element;
+        float distance;
+        BoxFace face;
+        glm::vec3 surfaceNormal;
+        QVariantMap extraInfo;
+        tree->evalRayIntersection(ray.origin, ray.direction, QVector<EntityItemID>(), QVector<EntityItemID>(),
+            PICK_ALL_ENTITIES, element, distance, face, surfaceNormal, extraInfo, Octree::Lock);
+    }
+    uint64_t indexUsec = usecTimestampNow() - startTime;
+
+    startTime = usecTimestampNow();
+    tree->evalRayIntersections(rays, QVector<EntityItemID>(), QVector<EntityItemID>(), PICK_ALL_ENTITIES, intersections,
+        Octree::Lock);
+    uint64_t batchUsec = usecTimestampNow() - startTime;
+
+    startTime = usecTimestampNow();
+    for (const auto& ray : rays) {
+        walkRayIntersection(tree, ray.origin, ray.direction);
+    }
+    uint64_t walkUsec = usecTimestampNow() - startTime;
+
+    std::cout << "[numRays, indexUsecPerRay, batchUsecPerRay, walkUsecPerRay] = [" << std::endl;
+    std::cout << "    " << rays.size() << ", " << (float)indexUsec / rays.size() << ", " << (float)batchUsec / rays.size()
+        << ", " << (float)walkUsec / rays.size() << std::endl;
+    std::cout << "];" << std::endl;
+}
+
+#endif // MANUAL_TEST
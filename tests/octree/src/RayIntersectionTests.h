@@ -0,0 +1,36 @@
+//
+//  RayIntersectionTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_RayIntersectionTests_h
+#define hifi_RayIntersectionTests_h
+
+#include <QtTest/QtTest>
+
+//#define MANUAL_TEST
+
+class RayIntersectionTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test ray picks through the spatial index find the nearest entity hit
+    void findsNearestHit();
+
+#ifdef MANUAL_TEST
+    // Time a stream of ray picks through the spatial index against an octree walk. The stream is read from the file
+    // named by HIFI_PICK_STREAM, one "originX originY originZ directionX directionY directionZ" ray per line, or is
+    // made up of lasers sweeping across the scene if that isn't set.
+    void pickStreamBenchmark();
+#endif // MANUAL_TEST
+};
+
+#endif // hifi_RayIntersectionTests_h
@@ -0,0 +1,162 @@
+//
+//  SpatialIndexTests.cpp
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpatialIndexTests.h"
+
+#include <iostream>
+
+#include <EntityTreeElement.h>
+#include <SharedUtil.h>
+
+#include "EntityTreeTestUtils.h"
+
+QTEST_MAIN(SpatialIndexTests)
+
+namespace {
+    class SphereWalkArgs {
+    public:
+        glm::vec3 position;
+        float radius;
+        QVector<QUuid> entities;
+    };
+
+    // how the entity tree answered sphere queries before it had a spatial index
+    bool sphereWalkOperation(const OctreeElementPointer& element, void* extraData) {
+        SphereWalkArgs* args = static_cast<SphereWalkArgs*>(extraData);
+        glm::vec3 penetration;
+        if (!element->getAACube().findSpherePenetration(args->position, args->radius, penetration)) {
+            return false;
+        }
+        auto entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+        entityTreeElement->evalEntitiesInSphere(args->position, args->radius, PICK_ALL_ENTITIES, args->entities);
+        return true;
+    }
+
+    QVector<QUuid> walkEntitiesInSphere(const EntityTreePointer& tree, const glm::vec3& position, float radius) {
+        SphereWalkArgs args { position, radius, QVector<QUuid>() };
+        tree->recurseTreeWithOperation(sphereWalkOperation, &args);
+        return args.entities;
+    }
+
+    QSet<QUuid> toSet(const QVector<QUuid>& ids) {
+        QSet<QUuid> set;
+        for (const auto& id : ids) {
+            set.insert(id);
+        }
+        return set;
+    }
+}
+
+void SpatialIndexTests::initTestCase() {
+    setUpEntityTreeDependencies();
+}
+
+void SpatialIndexTests::matchesOctreeWalk() {
+    EntityTreePointer tree = makeServerEntityTree();
+    std::mt19937 generator(0);
+
+    const int NUM_ENTITIES = 2000;
+    std::vector<EntityItemID> entityIDs;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        entityIDs.push_back(addRandomBox(tree, generator));
+    }
+    QCOMPARE((int)tree->getSpatialIndex().getNumEntities(), NUM_ENTITIES);
+
+    std::uniform_real_distribution<float> position(-RANDOM_BOX_WORLD_SIZE / 2.0f, RANDOM_BOX_WORLD_SIZE / 2.0f);
+    std::uniform_real_distribution<float> radius(1.0f, 100.0f);
+    auto checkQueries = [&] {
+        const int NUM_QUERIES = 50;
+        for (int i = 0; i < NUM_QUERIES; ++i) {
+            glm::vec3 center(position(generator), position(generator), position(generator));
+            float queryRadius = radius(generator);
+
+            QVector<QUuid> found;
+            tree->evalEntitiesInSphere(center, queryRadius, PICK_ALL_ENTITIES, found);
+            QCOMPARE(toSet(found), toSet(walkEntitiesInSphere(tree, center, queryRadius)));
+
+            AABox box(center - glm::vec3(queryRadius), 2.0f * queryRadius);
+            QSet<QUuid> expected;
+            for (const auto& entityID : entityIDs) {
+                auto entity = tree->findEntityByEntityItemID(entityID);
+                bool success;
+                if (entity && entity->getAABox(success).touches(box) && success) {
+                    expected.insert(entityID);
+                }
+            }
+            tree->evalEntitiesInBox(box, PICK_ALL_ENTITIES, found);
+            QCOMPARE(toSet(found), expected);
+        }
+    };
+    checkQueries();
+
+    // move some around, and add and delete some more
+    std::uniform_int_distribution<size_t> pick(0, entityIDs.size() - 1);
+    for (int i = 0; i < NUM_ENTITIES / 4; ++i) {
+        EntityItemProperties properties;
+        properties.setPosition(glm::vec3(position(generator), position(generator), position(generator)));
+        tree->updateEntity(entityIDs[pick(generator)], properties);
+    }
+    for (int i = 0; i < NUM_ENTITIES / 4; ++i) {
+        size_t index = pick(generator);
+        tree->deleteEntity(entityIDs[index], true);
+        entityIDs[index] = addRandomBox(tree, generator);
+    }
+    QCOMPARE((int)tree->getSpatialIndex().getNumEntities(), NUM_ENTITIES);
+    checkQueries();
+
+    tree->eraseAllOctreeElements();
+    QCOMPARE((int)tree->getSpatialIndex().getNumEntities(), 0);
+}
+
+#ifdef MANUAL_TEST
+
+void SpatialIndexTests::sphereQueryBenchmark() {
+    int numEntities[] = { 10000, 100000, 1000000 };
+    const int NUM_QUERIES = 1000;
+    const float QUERY_RADIUS = 20.0f;
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> position(-RANDOM_BOX_WORLD_SIZE / 2.0f, RANDOM_BOX_WORLD_SIZE / 2.0f);
+
+    std::cout << "[numEntities, indexUsecPerQuery, walkUsecPerQuery] = [" << std::endl;
+    for (auto n : numEntities) {
+        EntityTreePointer tree = makeServerEntityTree();
+        for (int i = 0; i < n; ++i) {
+            addRandomBox(tree, generator);
+        }
+
+        std::vector<glm::vec3> centers;
+        for (int i = 0; i < NUM_QUERIES; ++i) {
+            centers.emplace_back(position(generator), position(generator), position(generator));
+        }
+
+        // the first query builds the index
+        QVector<QUuid> found;
+        tree->evalEntitiesInSphere(centers[0], QUERY_RADIUS, PICK_ALL_ENTITIES, found);
+
+        uint64_t startTime = usecTimestampNow();
+        for (const auto& center : centers) {
+            tree->evalEntitiesInSphere(center, QUERY_RADIUS, PICK_ALL_ENTITIES, found);
+        }
+        uint64_t indexUsec = usecTimestampNow() - startTime;
+
+        startTime = usecTimestampNow();
+        for (const auto& center : centers) {
+            found = walkEntitiesInSphere(tree, center, QUERY_RADIUS);
+        }
+        uint64_t walkUsec = usecTimestampNow() - startTime;
+
+        std::cout << "    " << n << ", " << (float)indexUsec / NUM_QUERIES << ", "
+            << (float)walkUsec / NUM_QUERIES << std::endl;
+    }
+    std::cout << "];" << std::endl;
+}
+
+#endif // MANUAL_TEST
@@ -0,0 +1,34 @@
+//
+//  SpatialIndexTests.h
+//  tests/octree/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SpatialIndexTests_h
+#define hifi_SpatialIndexTests_h
+
+#include <QtTest/QtTest>
+
+//#define MANUAL_TEST
+
+class SpatialIndexTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // Test the entity queries answered by the spatial index find what an octree walk does, as entities move
+    void matchesOctreeWalk();
+
+#ifdef MANUAL_TEST
+    // Time sphere queries through the spatial index against an octree walk, for growing numbers of entities
+    void sphereQueryBenchmark();
+#endif // MANUAL_TEST
+};
+
+#endif // hifi_SpatialIndexTests_h
@@ -0,0 +1,101 @@
+//
+//  EntitiesConvertApp.cpp
+//  tools/entities-convert/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitiesConvertApp.h"
+
+#include <QCommandLineParser>
+#include <QFile>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <EntityTree.h>
+#include <NodeList.h>
+
+EntitiesConvertApp::EntitiesConvertApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity Entities File Converter\n"
+        "The type of the output file is taken from its extension: .json, .json.gz or .bin");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption inputFilenameOption("i", "input file", "models.json.gz");
+    parser.addOption(inputFilenameOption);
+
+    const QCommandLineOption outputFilenameOption("o", "output file", "models.bin");
+    parser.addOption(outputFilenameOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    if (!parser.isSet(inputFilenameOption) || !parser.isSet(outputFilenameOption)) {
+        qCritical() << "Both an input and an output file are required";
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    QString inputFilename = parser.value(inputFilenameOption);
+    QString outputFilename = parser.value(outputFilenameOption);
+
+    QString outputFileType;
+    for (const auto& extension : PERSIST_EXTENSIONS) {
+        if (outputFilename.endsWith("." + extension, Qt::CaseInsensitive)) {
+            outputFileType = extension;
+        }
+    }
+    if (outputFileType.isEmpty()) {
+        qCritical() << "Unknown output file type" << outputFilename;
+        _returnCode = 1;
+        return;
+    }
+
+    if (!QFile::exists(inputFilename)) {
+        qCritical() << "Failed to open file" << inputFilename;
+        _returnCode = 2;
+        return;
+    }
+
+    // entities are only constructed when there's a NodeList, and a client tree would need permission to add them
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Unassigned);
+
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    tree->setIsServer(true);
+
+    bool success = false;
+    tree->withWriteLock([&] {
+        success = tree->readFromPersistFile(inputFilename);
+    });
+    if (!success) {
+        qCritical() << "Failed to read entities from" << inputFilename;
+        _returnCode = 2;
+        return;
+    }
+
+    if (!tree->writeToFile(outputFilename.toLocal8Bit().constData(), nullptr, outputFileType)) {
+        qCritical() << "Failed to write entities to" << outputFilename;
+        _returnCode = 3;
+        return;
+    }
+}
@@ -0,0 +1,29 @@
+//
+//  EntitiesConvertApp.h
+//  tools/entities-convert/src
+//
+//  Created by agent on 2026-10-17.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitiesConvertApp_h
+#define hifi_EntitiesConvertApp_h
+
+#include <QCoreApplication>
+
+// converts an entity server persist file between the json, json.gz and bin file types
+class EntitiesConvertApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    EntitiesConvertApp(int argc, char* argv[]);
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    int _returnCode { 0 };
+};
+
+#endif // hifi_EntitiesConvertApp_h